@@ -0,0 +1,277 @@
+#include "benchmark/benchmark.hpp"
+#include "unicorn/core.hpp"
+#include "unicorn/options.hpp"
+#include "unicorn/regex.hpp"
+#include "unicorn/string.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace RS;
+using namespace RS::Unicorn;
+using namespace RS::Unicorn::Benchmark;
+
+// Allocation counting. Replacing the global allocation functions counts
+// every heap allocation made by the library and the standard containers it
+// uses, at the cost of one relaxed atomic increment per allocation.
+
+namespace {
+
+    std::atomic<size_t> allocation_count(0);
+
+    void* counted_allocate(size_t n) {
+        allocation_count.fetch_add(1, std::memory_order_relaxed);
+        if (void* ptr = std::malloc(n ? n : 1))
+            return ptr;
+        throw std::bad_alloc();
+    }
+
+    void* counted_allocate(size_t n, std::align_val_t al) {
+        allocation_count.fetch_add(1, std::memory_order_relaxed);
+        size_t align = std::max(size_t(al), sizeof(void*));
+        size_t size = (std::max(n, size_t(1)) + align - 1) / align * align;
+        if (void* ptr = std::aligned_alloc(align, size))
+            return ptr;
+        throw std::bad_alloc();
+    }
+
+}
+
+void* operator new(size_t n) { return counted_allocate(n); }
+void* operator new[](size_t n) { return counted_allocate(n); }
+void* operator new(size_t n, const std::nothrow_t&) noexcept { try { return counted_allocate(n); } catch (...) { return nullptr; } }
+void* operator new[](size_t n, const std::nothrow_t&) noexcept { try { return counted_allocate(n); } catch (...) { return nullptr; } }
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void* operator new(size_t n, std::align_val_t al) { return counted_allocate(n, al); }
+void* operator new[](size_t n, std::align_val_t al) { return counted_allocate(n, al); }
+void* operator new(size_t n, std::align_val_t al, const std::nothrow_t&) noexcept { try { return counted_allocate(n, al); } catch (...) { return nullptr; } }
+void* operator new[](size_t n, std::align_val_t al, const std::nothrow_t&) noexcept { try { return counted_allocate(n, al); } catch (...) { return nullptr; } }
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { std::free(ptr); }
+
+namespace RS::Unicorn::Benchmark {
+
+    namespace {
+
+        struct BenchmarkInfo {
+            const char* module;
+            const char* name;
+            uint32_t corpora;
+            BenchmarkFunction function;
+        };
+
+        std::vector<BenchmarkInfo>& benchmark_list() {
+            static std::vector<BenchmarkInfo> list;
+            return list;
+        }
+
+    }
+
+    void State::start() noexcept {
+        allocs = allocation_count;
+        start_time = clock::now();
+    }
+
+    void State::stop() noexcept {
+        stop_time = clock::now();
+        allocs = allocation_count - allocs;
+    }
+
+    int add_benchmark(const char* module, const char* name, uint32_t corpora, BenchmarkFunction f) {
+        benchmark_list().push_back({module, name, corpora, f});
+        return 0;
+    }
+
+}
+
+namespace {
+
+    constexpr size_t max_iterations = 1'000'000'000;
+
+    struct Result {
+        U8string module;
+        U8string name;
+        U8string corpus;
+        size_t iterations;
+        size_t bytes;
+        double seconds;
+        size_t allocations;
+        U8string full_name() const { return module + '/' + name + '/' + corpus; }
+        double ns_per_op() const { return 1e9 * seconds / iterations; }
+        double mb_per_sec() const { return seconds > 0 ? 1e-6 * bytes * iterations / seconds : 0; }
+        double allocs_per_op() const { return double(allocations) / iterations; }
+    };
+
+    // Run a benchmark with increasing iteration counts until the timed loop
+    // takes at least the minimum time
+
+    Result run_benchmark(const BenchmarkInfo& info, const Corpus& corpus, double min_time) {
+        size_t n = 1;
+        for (;;) {
+            State state(corpus, n);
+            info.function(state);
+            double t = state.seconds();
+            if (t >= min_time || n >= max_iterations)
+                return {info.module, info.name, corpus.name, n, state.bytes(), t, state.allocations()};
+            double factor = t > 0 ? 1.4 * min_time / t : 100;
+            factor = std::clamp(factor, 2.0, 100.0);
+            n = std::min(size_t(n * factor), max_iterations);
+        }
+    }
+
+    U8string format_number(double x, int precision) {
+        char buf[64];
+        std::snprintf(buf, sizeof(buf), "%.*f", precision, x);
+        return buf;
+    }
+
+    U8string json_string(const U8string& s) {
+        return str_quote(s, Escape::json);
+    }
+
+    U8string current_time() {
+        auto t = std::time(nullptr);
+        char buf[32];
+        std::strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&t));
+        return buf;
+    }
+
+    U8string compiler_name() {
+        #if defined(__clang__)
+            return "clang " __clang_version__;
+        #elif defined(__GNUC__)
+            return "gcc " __VERSION__;
+        #elif defined(_MSC_VER)
+            return "msvc " + dec(_MSC_VER);
+        #else
+            return "unknown";
+        #endif
+    }
+
+    void write_json(std::ostream& out, const std::vector<Result>& results, double min_time) {
+        out << "{\n"
+            << "  \"context\": {\n"
+            << "    \"date\": " << json_string(current_time()) << ",\n"
+            << "    \"unicorn_version\": " << json_string(unicorn_version().str()) << ",\n"
+            << "    \"unicode_version\": " << json_string(unicode_version().str()) << ",\n"
+            << "    \"compiler\": " << json_string(compiler_name()) << ",\n"
+            << "    \"min_time\": " << format_number(min_time, 3) << "\n"
+            << "  },\n"
+            << "  \"corpora\": [\n";
+        auto& list = corpora();
+        for (size_t i = 0; i < list.size(); ++i) {
+            auto& c = list[i];
+            out << "    {\"name\": " << json_string(c.name)
+                << ", \"bytes\": " << c.text.size();
+            if (! c.encoding.empty())
+                out << ", \"encoding\": " << json_string(c.encoding)
+                    << ", \"encoded_bytes\": " << c.encoded.size();
+            out << "}" << (i + 1 < list.size() ? "," : "") << "\n";
+        }
+        out << "  ],\n"
+            << "  \"benchmarks\": [\n";
+        for (size_t i = 0; i < results.size(); ++i) {
+            auto& r = results[i];
+            out << "    {"
+                << "\"name\": " << json_string(r.full_name())
+                << ", \"module\": " << json_string(r.module)
+                << ", \"function\": " << json_string(r.name)
+                << ", \"corpus\": " << json_string(r.corpus)
+                << ", \"iterations\": " << r.iterations
+                << ", \"bytes_per_op\": " << r.bytes
+                << ", \"ns_per_op\": " << format_number(r.ns_per_op(), 1)
+                << ", \"mb_per_sec\": " << format_number(r.mb_per_sec(), 2)
+                << ", \"allocs_per_op\": " << format_number(r.allocs_per_op(), 2)
+                << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        out << "  ]\n"
+            << "}\n";
+    }
+
+    void print_result(const Result& r) {
+        std::cout << std::left << std::setw(48) << r.full_name() << std::right
+            << std::setw(14) << format_number(r.ns_per_op(), 1) << " ns"
+            << std::setw(12) << (r.bytes ? format_number(r.mb_per_sec(), 2) : U8string("-")) << " MB/s"
+            << std::setw(12) << format_number(r.allocs_per_op(), 2) << " allocs/op"
+            << std::endl;
+    }
+
+}
+
+int main(int argc, char** argv) {
+
+    try {
+
+        Options opt("Unicorn benchmarks");
+        opt.add("--filter", "Run only benchmarks whose names (module/function/corpus) match this regex", Options::abbrev="-f");
+        opt.add("--json", "Write results to this file in JSON format", Options::abbrev="-j");
+        opt.add("--list", "List the benchmarks without running them", Options::abbrev="-l", Options::boolean);
+        opt.add("--min-time", "Minimum time to spend on each benchmark in seconds", Options::abbrev="-t", Options::floating, Options::defvalue="0.5");
+        opt.add("--size", "Approximate size of each corpus in KB", Options::abbrev="-s", Options::uinteger, Options::defvalue="1024");
+        if (opt.parse(argc, argv))
+            return 0;
+
+        Regex filter(opt.get<U8string>("--filter"));
+        auto json_file = opt.get<U8string>("--json");
+        bool list_only = opt.has("--list");
+        auto min_time = opt.get<double>("--min-time");
+        auto size = opt.get<size_t>("--size");
+
+        make_corpora(1024 * size);
+        auto benchmarks = benchmark_list();
+        std::stable_sort(benchmarks.begin(), benchmarks.end(),
+            [] (auto& a, auto& b) { return U8string(a.module) < U8string(b.module); });
+        std::vector<Result> results;
+
+        for (auto& info: benchmarks) {
+            for (auto& corpus: corpora()) {
+                if (! (info.corpora & corpus.id))
+                    continue;
+                auto name = U8string(info.module) + '/' + info.name + '/' + corpus.name;
+                if (! filter.empty() && ! filter.search(name))
+                    continue;
+                if (list_only) {
+                    std::cout << name << std::endl;
+                    continue;
+                }
+                results.push_back(run_benchmark(info, corpus, min_time));
+                print_result(results.back());
+            }
+        }
+
+        if (! json_file.empty()) {
+            std::ofstream out(json_file);
+            write_json(out, results, min_time);
+            if (! out)
+                throw std::runtime_error("Failed to write " + json_file);
+        }
+
+        return 0;
+
+    }
+
+    catch (const std::exception& ex) {
+        std::cerr << "*** " << ex.what() << std::endl;
+        return 1;
+    }
+
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "unicorn/core.hpp"
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace RS::Unicorn::Benchmark {
+
+    // Benchmark corpora, generated deterministically at startup so results
+    // are comparable between runs and between releases
+
+    struct Corpus {
+        static constexpr uint32_t ascii_log  = 1ul << 0;  // Server log lines, pure ASCII
+        static constexpr uint32_t mixed_cjk  = 1ul << 1;  // Chinese, Japanese, and Korean mixed with ASCII
+        static constexpr uint32_t combining  = 1ul << 2;  // Latin letters with stacks of combining marks
+        static constexpr uint32_t emoji      = 1ul << 3;  // Emoji sequences (ZWJ, modifiers, flags, keycaps)
+        static constexpr uint32_t shift_jis  = 1ul << 4;  // Japanese text, also available in Shift-JIS
+        static constexpr uint32_t all        = ascii_log | mixed_cjk | combining | emoji | shift_jis;
+        uint32_t id = 0;
+        U8string name;
+        U8string text;       // UTF-8 text
+        U8string encoding;   // Legacy encoding name, if any
+        std::string encoded; // Text in the legacy encoding
+    };
+
+    const std::vector<Corpus>& corpora();
+    void make_corpora(size_t size);
+
+    // Benchmark state, used as the loop control in a benchmark function:
+    //
+    //     BENCHMARK(module, name, Corpus::all) {
+    //         ... setup ...
+    //         while (state.keep_running())
+    //             ... operation ...
+    //         state.set_bytes(...);
+    //     }
+    //
+    // Only the loop itself is timed. The operation count and bytes per
+    // operation are used to calculate the throughput and allocation rate.
+
+    class State {
+    public:
+        State(const Corpus& corpus, size_t iterations) noexcept: src(&corpus), iters(iterations), left(iterations) {}
+        bool keep_running() noexcept {
+            if (left == iters)
+                start();
+            if (left == 0) {
+                stop();
+                return false;
+            }
+            --left;
+            return true;
+        }
+        const Corpus& corpus() const noexcept { return *src; }
+        const U8string& text() const noexcept { return src->text; }
+        size_t iterations() const noexcept { return iters; }
+        size_t bytes() const noexcept { return nbytes; }
+        void set_bytes(size_t n) noexcept { nbytes = n; }
+        double seconds() const noexcept { return std::chrono::duration<double>(stop_time - start_time).count(); }
+        size_t allocations() const noexcept { return allocs; }
+    private:
+        using clock = std::chrono::steady_clock;
+        const Corpus* src;
+        size_t iters;
+        size_t left;
+        size_t nbytes = 0;
+        size_t allocs = 0;
+        clock::time_point start_time;
+        clock::time_point stop_time;
+        void start() noexcept;
+        void stop() noexcept;
+    };
+
+    // Registration
+
+    using BenchmarkFunction = void (*)(State&);
+
+    int add_benchmark(const char* module, const char* name, uint32_t corpora, BenchmarkFunction f);
+
+    #define BENCHMARK(module, name, corpora) \
+        static void benchmark_ ## module ## _ ## name(RS::Unicorn::Benchmark::State& state); \
+        [[maybe_unused]] static const int benchmark_registered_ ## module ## _ ## name = \
+            RS::Unicorn::Benchmark::add_benchmark(# module, # name, corpora, benchmark_ ## module ## _ ## name); \
+        static void benchmark_ ## module ## _ ## name([[maybe_unused]] RS::Unicorn::Benchmark::State& state)
+
+    // Prevent the optimizer from discarding a result
+
+    template <typename T>
+    inline void do_not_optimize(const T& t) noexcept {
+        #if defined(__GNUC__) || defined(__clang__)
+            asm volatile("" : : "r,m"(t) : "memory");
+        #else
+            static const void* volatile sink;
+            sink = &t;
+        #endif
+    }
+
+}
@@ -0,0 +1,20 @@
+#include "benchmark/benchmark.hpp"
+#include "unicorn/bidi.hpp"
+#include "unicorn/string.hpp"
+
+using namespace RS;
+using namespace RS::Unicorn;
+using namespace RS::Unicorn::Benchmark;
+
+BENCHMARK(bidi, paragraphs, Corpus::all) {
+    auto& text = state.text();
+    auto lines = str_splitv_at(text, "\n");
+    BidiParagraph para;
+    while (state.keep_running()) {
+        for (auto& line: lines) {
+            para.set_text(line);
+            do_not_optimize(para.visual_order(0, para.size()));
+        }
+    }
+    state.set_bytes(text.size());
+}
@@ -0,0 +1,41 @@
+#include "benchmark/benchmark.hpp"
+#include "unicorn/character.hpp"
+#include "unicorn/utf.hpp"
+#include <string>
+
+using namespace RS;
+using namespace RS::Unicorn;
+using namespace RS::Unicorn::Benchmark;
+
+BENCHMARK(character, general_category, Corpus::all) {
+    auto utf32 = to_utf32(state.text());
+    while (state.keep_running()) {
+        uint32_t sum = 0;
+        for (char32_t c: utf32)
+            sum += uint32_t(char_general_category(c));
+        do_not_optimize(sum);
+    }
+    state.set_bytes(state.text().size());
+}
+
+BENCHMARK(character, east_asian_width, Corpus::all) {
+    auto utf32 = to_utf32(state.text());
+    while (state.keep_running()) {
+        int sum = 0;
+        for (char32_t c: utf32)
+            sum += int(east_asian_width(c));
+        do_not_optimize(sum);
+    }
+    state.set_bytes(state.text().size());
+}
+
+BENCHMARK(character, simple_uppercase, Corpus::all) {
+    auto utf32 = to_utf32(state.text());
+    while (state.keep_running()) {
+        char32_t sum = 0;
+        for (char32_t c: utf32)
+            sum += char_to_simple_uppercase(c);
+        do_not_optimize(sum);
+    }
+    state.set_bytes(state.text().size());
+}
@@ -0,0 +1,229 @@
+#include "benchmark/benchmark.hpp"
+#include "unicorn/mbcs.hpp"
+#include "unicorn/string.hpp"
+#include "unicorn/utf.hpp"
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace RS;
+using namespace RS::Unicorn;
+
+namespace RS::Unicorn::Benchmark {
+
+    namespace {
+
+        // The generators use mt19937, whose output sequence is fixed by the
+        // standard, and do their own range reduction instead of using the
+        // standard distributions, whose results are implementation defined
+
+        class Generator {
+        public:
+            explicit Generator(uint32_t seed): rng(seed) {}
+            size_t index(size_t n) { return rng() % n; }
+            size_t range(size_t min, size_t max) { return min + index(max - min + 1); }
+            bool chance(unsigned percent) { return index(100) < percent; }
+            char32_t code(char32_t min, char32_t max) { return min + char32_t(index(max - min + 1)); }
+            char32_t pick(std::u32string_view chars) { return chars[index(chars.size())]; }
+            template <typename T, size_t N> const T& pick(const T (&array)[N]) { return array[index(N)]; }
+        private:
+            std::mt19937 rng;
+        };
+
+        const char* const log_levels[] = {"DEBUG", "INFO", "INFO", "INFO", "WARN", "ERROR"};
+        const char* const log_methods[] = {"GET", "GET", "GET", "POST", "PUT", "DELETE"};
+        const char* const log_paths[] = {"/api/v1/items", "/api/v1/users", "/api/v2/orders", "/static/css/site.css", "/health", "/login"};
+        const char* const log_agents[] = {"curl/7.68.0", "Mozilla/5.0 (X11; Linux x86_64)", "python-requests/2.25.1", "Go-http-client/1.1"};
+        const char* const latin_words[] = {"the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog", "and", "then", "some", "more", "text"};
+
+        // Common kanji that are all in JIS X 0208, so the Japanese corpus can
+        // be converted to Shift-JIS without loss
+
+        const std::u32string_view kanji = U"日本人大年一中出子国生上学者会時分事自社見行手間二地方合市前小"
+            "東同三新場体長現実性定部気法内立物問力明題業主理通作公的高意全来文発五外";
+
+        const std::u32string_view cjk_punctuation = U"、。「」・！？";
+
+        void append_digits(U8string& s, Generator& gen, size_t n) {
+            for (size_t i = 0; i < n; ++i)
+                s += char('0' + gen.index(10));
+        }
+
+        U8string make_ascii_log(size_t size) {
+            Generator gen(1);
+            U8string s;
+            while (s.size() < size) {
+                s += "2019-0";
+                append_digits(s, gen, 1);
+                s += "-1";
+                append_digits(s, gen, 1);
+                s += 'T';
+                append_digits(s, gen, 2);
+                s += ':';
+                append_digits(s, gen, 2);
+                s += ':';
+                append_digits(s, gen, 2);
+                s += '.';
+                append_digits(s, gen, 3);
+                s += "Z [";
+                s += gen.pick(log_levels);
+                s += "] worker-";
+                append_digits(s, gen, 1);
+                s += ": ";
+                s += gen.pick(log_methods);
+                s += ' ';
+                s += gen.pick(log_paths);
+                s += '/';
+                append_digits(s, gen, gen.range(1, 6));
+                s += " status=";
+                s += gen.chance(90) ? "200" : gen.chance(50) ? "404" : "500";
+                s += " bytes=";
+                append_digits(s, gen, gen.range(2, 6));
+                s += " agent=\"";
+                s += gen.pick(log_agents);
+                s += "\"\n";
+            }
+            return s;
+        }
+
+        U8string make_mixed_cjk(size_t size) {
+            Generator gen(2);
+            U8string s;
+            size_t column = 0;
+            while (s.size() < size) {
+                size_t n = gen.range(2, 8);
+                switch (gen.index(6)) {
+                    case 0:  for (size_t i = 0; i < n; ++i) str_append_char(s, gen.code(0x3041, 0x3093)); break;  // Hiragana
+                    case 1:  for (size_t i = 0; i < n; ++i) str_append_char(s, gen.code(0x30a1, 0x30f3)); break;  // Katakana
+                    case 2:  for (size_t i = 0; i < n; ++i) str_append_char(s, gen.code(0xac00, 0xd7a3)); break;  // Hangul
+                    case 3:  s += ' '; s += gen.pick(latin_words); s += ' '; break;
+                    default: for (size_t i = 0; i < n; ++i) str_append_char(s, gen.code(0x4e00, 0x9fa5)); break;  // Han
+                }
+                str_append_char(s, gen.pick(cjk_punctuation));
+                column += n;
+                if (column >= 40) {
+                    s += '\n';
+                    column = 0;
+                }
+            }
+            return s;
+        }
+
+        U8string make_combining(size_t size) {
+            Generator gen(3);
+            U8string s;
+            size_t column = 0;
+            while (s.size() < size) {
+                size_t n = gen.range(2, 10);
+                for (size_t i = 0; i < n; ++i) {
+                    s += char(gen.chance(20) ? gen.code(U'A', U'Z') : gen.code(U'a', U'z'));
+                    size_t marks = gen.range(0, 4);
+                    for (size_t j = 0; j < marks; ++j)
+                        str_append_char(s, gen.code(0x300, 0x36f));
+                }
+                s += ' ';
+                column += n + 1;
+                if (column >= 60) {
+                    s += '\n';
+                    column = 0;
+                }
+            }
+            return s;
+        }
+
+        U8string make_emoji(size_t size) {
+            Generator gen(4);
+            U8string s;
+            size_t column = 0;
+            while (s.size() < size) {
+                switch (gen.index(7)) {
+                    case 0:  // Single pictograph
+                        str_append_char(s, gen.code(0x1f600, 0x1f64f));
+                        break;
+                    case 1:  // Skin tone modifier
+                        str_append_char(s, gen.code(0x1f466, 0x1f469));
+                        str_append_char(s, gen.code(0x1f3fb, 0x1f3ff));
+                        break;
+                    case 2:  // ZWJ family sequence
+                        s += "\U0001f468\u200d\U0001f469\u200d";
+                        str_append_char(s, gen.code(0x1f466, 0x1f467));
+                        break;
+                    case 3:  // Flag
+                        str_append_char(s, gen.code(0x1f1e6, 0x1f1ff));
+                        str_append_char(s, gen.code(0x1f1e6, 0x1f1ff));
+                        break;
+                    case 4:  // Keycap
+                        str_append_char(s, gen.code(U'0', U'9'));
+                        s += "\ufe0f\u20e3";
+                        break;
+                    case 5:  // Text symbol with emoji presentation
+                        str_append_char(s, gen.code(0x2600, 0x2603));
+                        s += "\ufe0f";
+                        break;
+                    default:
+                        s += ' ';
+                        s += gen.pick(latin_words);
+                        s += ' ';
+                        break;
+                }
+                if (++column >= 30) {
+                    s += '\n';
+                    column = 0;
+                }
+            }
+            return s;
+        }
+
+        U8string make_japanese(size_t size) {
+            Generator gen(5);
+            U8string s;
+            size_t column = 0;
+            while (s.size() < size) {
+                size_t n = gen.range(1, 6);
+                switch (gen.index(5)) {
+                    case 0:  for (size_t i = 0; i < n; ++i) str_append_char(s, gen.code(0x30a1, 0x30f3)); break;
+                    case 1:
+                    case 2:  for (size_t i = 0; i < n; ++i) str_append_char(s, gen.code(0x3041, 0x3093)); break;
+                    case 3:  append_digits(s, gen, n); break;
+                    default: for (size_t i = 0; i < n; ++i) str_append_char(s, gen.pick(kanji)); break;
+                }
+                column += n;
+                if (gen.chance(15)) {
+                    str_append_char(s, gen.pick(cjk_punctuation));
+                    ++column;
+                }
+                if (column >= 40) {
+                    str_append_char(s, U'。');
+                    s += '\n';
+                    column = 0;
+                }
+            }
+            return s;
+        }
+
+        std::vector<Corpus>& corpus_list() {
+            static std::vector<Corpus> list;
+            return list;
+        }
+
+    }
+
+    const std::vector<Corpus>& corpora() {
+        return corpus_list();
+    }
+
+    void make_corpora(size_t size) {
+        auto& list = corpus_list();
+        list.clear();
+        list.push_back({Corpus::ascii_log, "ascii-log", make_ascii_log(size), {}, {}});
+        list.push_back({Corpus::mixed_cjk, "mixed-cjk", make_mixed_cjk(size), {}, {}});
+        list.push_back({Corpus::combining, "combining", make_combining(size), {}, {}});
+        list.push_back({Corpus::emoji, "emoji", make_emoji(size), {}, {}});
+        list.push_back({Corpus::shift_jis, "shift-jis", make_japanese(size), "shift_jis", {}});
+        for (auto& corpus: list)
+            if (! corpus.encoding.empty())
+                export_string(corpus.text, corpus.encoded, corpus.encoding, Utf::throws);
+    }
+
+}
@@ -0,0 +1,52 @@
+#include "benchmark/benchmark.hpp"
+#include "unicorn/io.hpp"
+#include "unicorn/string.hpp"
+#include "rs-core/file.hpp"
+
+using namespace RS;
+using namespace RS::Unicorn;
+using namespace RS::Unicorn::Benchmark;
+
+namespace {
+
+    const RS::File testfile = "__benchmark__";
+
+}
+
+BENCHMARK(io, read_lines, Corpus::all) {
+    auto& text = state.text();
+    ScopeExit guard([=] { testfile.remove(); });
+    testfile.save(text);
+    while (state.keep_running()) {
+        size_t bytes = 0;
+        for (auto& line: read_lines(testfile.name()))
+            bytes += line.size();
+        do_not_optimize(bytes);
+    }
+    state.set_bytes(text.size());
+}
+
+BENCHMARK(io, read_lines_encoded, Corpus::shift_jis) {
+    auto& corpus = state.corpus();
+    ScopeExit guard([=] { testfile.remove(); });
+    testfile.save(corpus.encoded);
+    while (state.keep_running()) {
+        size_t bytes = 0;
+        for (auto& line: read_lines(testfile.name(), 0, corpus.encoding))
+            bytes += line.size();
+        do_not_optimize(bytes);
+    }
+    state.set_bytes(corpus.encoded.size());
+}
+
+BENCHMARK(io, write_lines, Corpus::all) {
+    auto& text = state.text();
+    auto lines = str_splitv_at(text, "\n");
+    ScopeExit guard([=] { testfile.remove(); });
+    while (state.keep_running()) {
+        FileWriter out(testfile.name());
+        for (auto& line: lines)
+            out = line + '\n';
+    }
+    state.set_bytes(text.size());
+}
@@ -0,0 +1,38 @@
+#include "benchmark/benchmark.hpp"
+#include "unicorn/mbcs.hpp"
+#include <string>
+
+using namespace RS;
+using namespace RS::Unicorn;
+using namespace RS::Unicorn::Benchmark;
+
+BENCHMARK(mbcs, import_string, Corpus::shift_jis) {
+    auto& encoded = state.corpus().encoded;
+    U8string out;
+    while (state.keep_running()) {
+        import_string(encoded, out, state.corpus().encoding);
+        do_not_optimize(out);
+    }
+    state.set_bytes(encoded.size());
+}
+
+BENCHMARK(mbcs, export_string, Corpus::shift_jis) {
+    auto& text = state.text();
+    std::string out;
+    while (state.keep_running()) {
+        export_string(text, out, state.corpus().encoding);
+        do_not_optimize(out);
+    }
+    state.set_bytes(text.size());
+}
+
+BENCHMARK(mbcs, import_utf16, Corpus::all) {
+    std::string encoded;
+    export_string(state.text(), encoded, "utf-16le");
+    U8string out;
+    while (state.keep_running()) {
+        import_string(encoded, out, "utf-16le");
+        do_not_optimize(out);
+    }
+    state.set_bytes(encoded.size());
+}
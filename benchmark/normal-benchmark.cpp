@@ -0,0 +1,36 @@
+#include "benchmark/benchmark.hpp"
+#include "unicorn/normal.hpp"
+
+using namespace RS;
+using namespace RS::Unicorn;
+using namespace RS::Unicorn::Benchmark;
+
+namespace {
+
+    void run_normalize(State& state, NormalizationForm form) {
+        auto& text = state.text();
+        while (state.keep_running())
+            do_not_optimize(normalize(text, form));
+        state.set_bytes(text.size());
+    }
+
+}
+
+BENCHMARK(normal, nfc, Corpus::all) { run_normalize(state, NFC); }
+BENCHMARK(normal, nfd, Corpus::all) { run_normalize(state, NFD); }
+BENCHMARK(normal, nfkc, Corpus::all) { run_normalize(state, NFKC); }
+BENCHMARK(normal, nfkd, Corpus::all) { run_normalize(state, NFKD); }
+
+BENCHMARK(normal, nfc_arena, Corpus::all) {
+    auto& text = state.text();
+    Arena arena;
+    while (state.keep_running()) {
+        {
+            PmrString s = arena.str();
+            normalize_to(s, text, NFC);
+            do_not_optimize(s);
+        }
+        arena.release();
+    }
+    state.set_bytes(text.size());
+}
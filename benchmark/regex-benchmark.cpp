@@ -0,0 +1,47 @@
+#include "benchmark/benchmark.hpp"
+#include "unicorn/regex.hpp"
+
+using namespace RS;
+using namespace RS::Unicorn;
+using namespace RS::Unicorn::Benchmark;
+
+BENCHMARK(regex, compile, Corpus::ascii_log) {
+    while (state.keep_running())
+        do_not_optimize(Regex(R"((\d{4})-(\d\d)-(\d\d)T[\d:.]+Z \[(\w+)\] ([\w-]+): (GET|POST|PUT|DELETE) (\S+))"));
+}
+
+BENCHMARK(regex, count_words, Corpus::all) {
+    auto& text = state.text();
+    Regex re(R"(\w+)", Regex::ucp);
+    while (state.keep_running())
+        do_not_optimize(re.count(text));
+    state.set_bytes(text.size());
+}
+
+BENCHMARK(regex, grep_words, Corpus::all) {
+    auto& text = state.text();
+    Regex re(R"(\w+)", Regex::ucp);
+    while (state.keep_running()) {
+        size_t bytes = 0;
+        for (auto& match: re.grep(text))
+            bytes += match.count();
+        do_not_optimize(bytes);
+    }
+    state.set_bytes(text.size());
+}
+
+BENCHMARK(regex, count_optimized, Corpus::all) {
+    auto& text = state.text();
+    Regex re(R"(\w+)", Regex::ucp | Regex::optimize);
+    while (state.keep_running())
+        do_not_optimize(re.count(text));
+    state.set_bytes(text.size());
+}
+
+BENCHMARK(regex, search_caseless, Corpus::all) {
+    auto& text = state.text();
+    Regex re("xyzzy", Regex::caseless);
+    while (state.keep_running())
+        do_not_optimize(bool(re.search(text)));
+    state.set_bytes(text.size());
+}
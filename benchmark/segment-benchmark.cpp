@@ -0,0 +1,48 @@
+#include "benchmark/benchmark.hpp"
+#include "unicorn/segment.hpp"
+
+using namespace RS;
+using namespace RS::Unicorn;
+using namespace RS::Unicorn::Benchmark;
+
+namespace {
+
+    template <typename Range>
+    size_t count_segments(const Range& range) {
+        size_t n = 0;
+        for (auto& segment: range) {
+            (void)segment;
+            ++n;
+        }
+        return n;
+    }
+
+}
+
+BENCHMARK(segment, graphemes, Corpus::all) {
+    auto& text = state.text();
+    while (state.keep_running())
+        do_not_optimize(count_segments(grapheme_range(text)));
+    state.set_bytes(text.size());
+}
+
+BENCHMARK(segment, words, Corpus::all) {
+    auto& text = state.text();
+    while (state.keep_running())
+        do_not_optimize(count_segments(word_range(text)));
+    state.set_bytes(text.size());
+}
+
+BENCHMARK(segment, sentences, Corpus::all) {
+    auto& text = state.text();
+    while (state.keep_running())
+        do_not_optimize(count_segments(sentence_range(text)));
+    state.set_bytes(text.size());
+}
+
+BENCHMARK(segment, line_breaks, Corpus::all) {
+    auto& text = state.text();
+    while (state.keep_running())
+        do_not_optimize(count_segments(line_break_range(text)));
+    state.set_bytes(text.size());
+}
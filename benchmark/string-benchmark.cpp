@@ -0,0 +1,52 @@
+#include "benchmark/benchmark.hpp"
+#include "unicorn/string.hpp"
+
+using namespace RS;
+using namespace RS::Unicorn;
+using namespace RS::Unicorn::Benchmark;
+
+namespace {
+
+    template <typename F>
+    void run_string(State& state, F f) {
+        auto& text = state.text();
+        while (state.keep_running())
+            do_not_optimize(f(text));
+        state.set_bytes(text.size());
+    }
+
+}
+
+BENCHMARK(string, str_length, Corpus::all) { run_string(state, [] (auto& s) { return str_length(s); }); }
+BENCHMARK(string, str_length_graphemes, Corpus::all) { run_string(state, [] (auto& s) { return str_length(s, Length::graphemes); }); }
+BENCHMARK(string, str_length_wide, Corpus::all) { run_string(state, [] (auto& s) { return str_length(s, Length::wide); }); }
+BENCHMARK(string, str_uppercase, Corpus::all) { run_string(state, [] (auto& s) { return str_uppercase(s); }); }
+BENCHMARK(string, str_lowercase, Corpus::all) { run_string(state, [] (auto& s) { return str_lowercase(s); }); }
+BENCHMARK(string, str_titlecase, Corpus::all) { run_string(state, [] (auto& s) { return str_titlecase(s); }); }
+BENCHMARK(string, str_casefold, Corpus::all) { run_string(state, [] (auto& s) { return str_casefold(s); }); }
+BENCHMARK(string, str_search, Corpus::all) { run_string(state, [] (auto& s) { return str_search(s, "xyzzy").empty(); }); }
+BENCHMARK(string, str_splitv, Corpus::all) { run_string(state, [] (auto& s) { return str_splitv(s).size(); }); }
+BENCHMARK(string, str_squeeze, Corpus::all) { run_string(state, [] (auto& s) { return str_squeeze(s); }); }
+BENCHMARK(string, str_escape, Corpus::all) { run_string(state, [] (auto& s) { return str_escape(s, Escape::ascii); }); }
+
+BENCHMARK(string, str_icase_equal, Corpus::all) {
+    auto& text = state.text();
+    auto upper = str_uppercase(text);
+    while (state.keep_running())
+        do_not_optimize(str_icase_equal(text, upper));
+    state.set_bytes(text.size());
+}
+
+BENCHMARK(string, str_splitv_arena, Corpus::all) {
+    auto& text = state.text();
+    Arena arena;
+    while (state.keep_running()) {
+        {
+            PmrStrings v = arena.strings();
+            str_split(text, string_inserter(v));
+            do_not_optimize(v.size());
+        }
+        arena.release();
+    }
+    state.set_bytes(text.size());
+}
@@ -0,0 +1,83 @@
+#include "benchmark/benchmark.hpp"
+#include "unicorn/utf.hpp"
+#include <string>
+
+using namespace RS;
+using namespace RS::Unicorn;
+using namespace RS::Unicorn::Benchmark;
+
+BENCHMARK(utf, valid_string, Corpus::all) {
+    auto& text = state.text();
+    while (state.keep_running())
+        do_not_optimize(valid_string(text));
+    state.set_bytes(text.size());
+}
+
+BENCHMARK(utf, iterate, Corpus::all) {
+    auto& text = state.text();
+    while (state.keep_running()) {
+        char32_t sum = 0;
+        for (char32_t c: utf_range(text))
+            sum += c;
+        do_not_optimize(sum);
+    }
+    state.set_bytes(text.size());
+}
+
+BENCHMARK(utf, recode_8_to_16, Corpus::all) {
+    auto& text = state.text();
+    std::u16string out;
+    while (state.keep_running()) {
+        recode(text, out);
+        do_not_optimize(out);
+    }
+    state.set_bytes(text.size());
+}
+
+BENCHMARK(utf, recode_8_to_32, Corpus::all) {
+    auto& text = state.text();
+    std::u32string out;
+    while (state.keep_running()) {
+        recode(text, out);
+        do_not_optimize(out);
+    }
+    state.set_bytes(text.size());
+}
+
+BENCHMARK(utf, recode_16_to_8, Corpus::all) {
+    auto& text = state.text();
+    auto utf16 = to_utf16(text);
+    U8string out;
+    while (state.keep_running()) {
+        recode(utf16, out);
+        do_not_optimize(out);
+    }
+    state.set_bytes(text.size());
+}
+
+BENCHMARK(utf, recode_checked, Corpus::all) {
+    auto& text = state.text();
+    std::u32string out;
+    while (state.keep_running()) {
+        recode(text, out, Utf::throws);
+        do_not_optimize(out);
+    }
+    state.set_bytes(text.size());
+}
+
+BENCHMARK(utf, parallel_recode_8_to_16, Corpus::all) {
+    auto& text = state.text();
+    std::u16string out;
+    while (state.keep_running()) {
+        parallel_recode(text, out);
+        do_not_optimize(out);
+    }
+    state.set_bytes(text.size());
+}
+
+BENCHMARK(utf, parallel_validate, Corpus::all) {
+    auto& text = state.text();
+    while (state.keep_running())
+        do_not_optimize(parallel_validate(text));
+    state.set_bytes(text.size());
+}
@@ -0,0 +1,208 @@
+#include "unicorn/core.hpp"
+#include "unicorn/bidi.hpp"
+#include "unicorn/character.hpp"
+#include "unicorn/string.hpp"
+#include "unicorn/ucd-tables.hpp"
+#include "unicorn/utf.hpp"
+#include "rs-core/unit-test.hpp"
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace RS;
+using namespace RS::Unicorn;
+using namespace std::literals;
+
+namespace {
+
+    // A character with each bidi class, for the tests that are expressed
+    // in terms of classes
+
+    const std::map<U8string, char32_t> class_chars = {
+        {"AL", 0x627}, {"AN", 0x660}, {"B", 0x2029}, {"BN", 0xad}, {"CS", 0x2c}, {"EN", 0x31},
+        {"ES", 0x2b}, {"ET", 0x24}, {"FSI", 0x2068}, {"L", 0x61}, {"LRE", 0x202a}, {"LRI", 0x2066},
+        {"LRO", 0x202d}, {"NSM", 0x300}, {"ON", 0x21}, {"PDF", 0x202c}, {"PDI", 0x2069}, {"R", 0x5d0},
+        {"RLE", 0x202b}, {"RLI", 0x2067}, {"RLO", 0x202e}, {"S", 0x9}, {"WS", 0x20},
+    };
+
+    bool is_removed(char32_t c) {
+        auto t = bidi_class(c);
+        return t == Bidi_Class::BN || t == Bidi_Class::LRE || t == Bidi_Class::RLE
+            || t == Bidi_Class::LRO || t == Bidi_Class::RLO || t == Bidi_Class::PDF;
+    }
+
+    // Levels and visual order in the format of the UCD test files, where
+    // characters removed by rule X9 are omitted
+
+    U8string format_levels(BidiParagraph& bp) {
+        U8string s;
+        auto& levels = bp.line_levels(0, bp.size());
+        for (size_t i = 0; i < bp.size(); ++i) {
+            if (i > 0)
+                s += ' ';
+            if (is_removed(bp.text()[i]))
+                s += 'x';
+            else
+                s += dec(levels[i]);
+        }
+        return s;
+    }
+
+    U8string format_order(BidiParagraph& bp) {
+        U8string s;
+        for (auto i: bp.visual_order(0, bp.size())) {
+            if (! is_removed(bp.text()[i])) {
+                if (! s.empty())
+                    s += ' ';
+                s += dec(i);
+            }
+        }
+        return s;
+    }
+
+    void check_bidi_class_conformance() {
+
+        // Each line lists the classes of the characters, and the set of
+        // paragraph directions the result applies to (1 = auto, 2 = LTR,
+        // 4 = RTL)
+
+        BidiParagraph bp;
+        size_t lnum = 0;
+
+        for (auto& row: UnicornDetail::bidi_test_table) {
+            ++lnum;
+            size_t prev_failures = RS::UnitTest::test_failures();
+            std::u32string text;
+            for (auto& name: str_splitv(row[0]))
+                text += class_chars.at(name);
+            auto bits = decnum(row[1]);
+            for (int level: {BidiParagraph::auto_level, 0, 1}) {
+                if (! (bits & (level == BidiParagraph::auto_level ? 1 : level == 0 ? 2 : 4)))
+                    continue;
+                TRY(bp.set_text(text, level));
+                TEST_EQUAL(format_levels(bp), row[2]);
+                TEST_EQUAL(format_order(bp), row[3]);
+            }
+            if (RS::UnitTest::test_failures() > prev_failures)
+                FAIL("Bidi test " + dec(lnum) + ": " + row[0] + "; " + row[1]);
+        }
+
+    }
+
+    void check_bidi_character_conformance() {
+
+        // Each line lists the characters, the paragraph direction (0 = LTR,
+        // 1 = RTL, 2 = auto), and the resolved paragraph level
+
+        BidiParagraph bp;
+        size_t lnum = 0;
+
+        for (auto& row: UnicornDetail::bidi_character_test_table) {
+            ++lnum;
+            size_t prev_failures = RS::UnitTest::test_failures();
+            std::u32string text;
+            for (auto& code: str_splitv(row[0]))
+                text += char32_t(hexnum(code));
+            int dir = int(decnum(row[1]));
+            TRY(bp.set_text(text, dir == 2 ? BidiParagraph::auto_level : dir));
+            TEST_EQUAL(bp.paragraph_level(), decnum(row[2]));
+            TEST_EQUAL(format_levels(bp), row[3]);
+            TEST_EQUAL(format_order(bp), row[4]);
+            if (RS::UnitTest::test_failures() > prev_failures)
+                FAIL("Bidi character test " + dec(lnum) + ": " + row[0] + "; " + row[1]);
+        }
+
+    }
+
+    void check_bidi_paragraph() {
+
+        BidiParagraph bp;
+        U8string s;
+
+        auto levels = [&] (const std::vector<uint8_t>& v) {
+            s.clear();
+            for (auto level: v)
+                s += char('0' + level);
+            return s;
+        };
+
+        auto order = [&] (const std::vector<size_t>& v) {
+            s.clear();
+            for (auto i: v)
+                s += char('0' + i);
+            return s;
+        };
+
+        TEST(bp.empty());
+        TEST_EQUAL(bp.paragraph_level(), 0);
+        TEST(bp.visual_order(0, 0).empty());
+
+        TRY(bp.set_text("abc אבג def"s));
+        TEST_EQUAL(bp.size(), 11);
+        TEST_EQUAL(bp.paragraph_level(), 0);
+        TEST_EQUAL(levels(bp.levels()), "00001110000");
+        TEST_EQUAL(to_utf8(bp.visual_text(0, bp.size())), "abc גבא def");
+        TEST_EQUAL(levels(bp.line_levels(4, 4)), "1110");
+        TEST_EQUAL(order(bp.visual_order(4, 4)), "6547");
+
+        TRY(bp.set_text("אבג def דהו"s));
+        TEST_EQUAL(bp.paragraph_level(), 1);
+        TEST_EQUAL(levels(bp.levels()), "11112221111");
+        TEST_EQUAL(to_utf8(bp.visual_text(0, bp.size())), "והד def גבא");
+
+        TRY(bp.set_text("abc אבג def"s, 1));
+        TEST_EQUAL(bp.paragraph_level(), 1);
+        TEST_EQUAL(levels(bp.levels()), "22211111222");
+        TEST_EQUAL(to_utf8(bp.visual_text(0, bp.size())), "def גבא abc");
+
+        TRY(bp.set_text("א(ב)"s));
+        TEST_EQUAL(levels(bp.levels()), "1111");
+        TEST_EQUAL(to_utf8(bp.visual_text(0, bp.size())), "(ב)א");
+
+        TRY(bp.set_text("א 12.5% ב"s));
+        TEST_EQUAL(levels(bp.levels()), "112222211");
+        TEST_EQUAL(to_utf8(bp.visual_text(0, bp.size())), "ב 12.5% א");
+
+        // Rule N0 with a combining mark after a bracket, and brackets
+        // matched through canonical equivalence (U+2329 = U+3008)
+
+        TRY(bp.set_text(U"b[b]́"s, 1));
+        TEST_EQUAL(format_levels(bp), "2 2 2 2 2");
+        TEST_EQUAL(format_order(bp), "0 1 2 3 4");
+        TRY(bp.set_text(U"a(́b)א"s, 1));
+        TEST_EQUAL(format_levels(bp), "2 2 2 2 2 1");
+        TEST_EQUAL(format_order(bp), "5 0 1 2 3 4");
+        TRY(bp.set_text(U"a〈b〉́א"s, 1));
+        TEST_EQUAL(format_levels(bp), "2 2 2 2 2 1");
+        TEST_EQUAL(format_order(bp), "5 0 1 2 3 4");
+        TRY(bp.set_text(U"a〈b〉́א"s, 1));
+        TEST_EQUAL(format_levels(bp), "2 2 2 2 2 1");
+        TEST_EQUAL(format_order(bp), "5 0 1 2 3 4");
+
+        TRY(bp.set_text(U"abc⁧def⁩ghi"s));
+        TEST_EQUAL(levels(bp.levels()), "00002220000");
+        TRY(bp.set_text(U"‮abc‬"s));
+        TEST_EQUAL(levels(bp.levels()), "01111");
+        TEST_EQUAL(levels(bp.line_levels(0, bp.size())), "01110");
+        TEST_EQUAL(to_utf8(bp.visual_text(0, bp.size())), "‮cba‬");
+
+        TRY(bp.set_text(""s));
+        TEST(bp.empty());
+        TEST(bp.levels().empty());
+        TEST_EQUAL(bp.paragraph_level(), 0);
+
+        TEST_THROW(bp.set_text("abc"s, 2), std::invalid_argument);
+
+    }
+
+}
+
+TEST_MODULE(unicorn, bidi) {
+
+    check_bidi_class_conformance();
+    check_bidi_character_conformance();
+    check_bidi_paragraph();
+
+}
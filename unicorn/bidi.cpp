@@ -0,0 +1,504 @@
+#include "unicorn/bidi.hpp"
+#include "unicorn/utf.hpp"
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <stdexcept>
+
+namespace RS::Unicorn {
+
+    namespace {
+
+        using BC = Bidi_Class;
+
+        constexpr size_t max_bracket_depth = 63;
+
+        bool is_isolate_initiator(BC t) noexcept {
+            return t == BC::LRI || t == BC::RLI || t == BC::FSI;
+        }
+
+        // Classes removed by rule X9; they take no part in the weak and
+        // neutral rules, and get the level of the preceding character
+
+        bool is_removed(BC t) noexcept {
+            switch (t) {
+                case BC::BN: case BC::LRE: case BC::RLE: case BC::LRO: case BC::RLO: case BC::PDF:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        bool is_neutral(BC t) noexcept {
+            switch (t) {
+                case BC::B: case BC::S: case BC::WS: case BC::ON:
+                case BC::LRI: case BC::RLI: case BC::FSI: case BC::PDI:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        // Direction of a resolved class for rules N0 and N1, where numbers
+        // count as R; ON if the class is neutral
+
+        BC strong_direction(BC t) noexcept {
+            switch (t) {
+                case BC::L:
+                    return BC::L;
+                case BC::R: case BC::AL: case BC::EN: case BC::AN:
+                    return BC::R;
+                default:
+                    return BC::ON;
+            }
+        }
+
+        BC level_direction(int level) noexcept {
+            return level % 2 ? BC::R : BC::L;
+        }
+
+        uint8_t next_odd(uint8_t level) noexcept { return (level + 1) | 1; }
+        uint8_t next_even(uint8_t level) noexcept { return (level + 2) & ~ 1; }
+
+        // U+2329/232A are canonically equivalent to U+3008/3009, and must
+        // match them as brackets (BD16)
+
+        char32_t canonical_bracket(char32_t c) noexcept {
+            switch (c) {
+                case 0x2329:  return 0x3008;
+                case 0x232a:  return 0x3009;
+                default:      return c;
+            }
+        }
+
+    }
+
+    void BidiParagraph::set_text(std::u32string_view text, int level) {
+        chars.assign(text.begin(), text.end());
+        resolve(level);
+    }
+
+    void BidiParagraph::set_text(std::string_view text, int level) {
+        chars.clear();
+        for (auto c: utf_range(text))
+            chars += c;
+        resolve(level);
+    }
+
+    const std::vector<uint8_t>& BidiParagraph::line_levels(size_t pos, size_t len) {
+        // L1. Segment and paragraph separators, and any whitespace or
+        // isolate formatting characters before them or at the end of the
+        // line, are reset to the paragraph level.
+        pos = std::min(pos, size());
+        len = std::min(len, size() - pos);
+        line.assign(lvls.begin() + pos, lvls.begin() + pos + len);
+        bool trailing = true;
+        for (size_t k = len; k > 0; --k) {
+            auto t = orig[pos + k - 1];
+            if (t == BC::S || t == BC::B) {
+                line[k - 1] = uint8_t(para);
+                trailing = true;
+            } else if (t == BC::WS || is_isolate_initiator(t) || t == BC::PDI || is_removed(t)) {
+                if (trailing)
+                    line[k - 1] = uint8_t(para);
+            } else {
+                trailing = false;
+            }
+        }
+        return line;
+    }
+
+    const std::vector<size_t>& BidiParagraph::visual_order(size_t pos, size_t len) {
+        // L2. From the highest level down to the lowest odd level, reverse
+        // every run of characters at that level or higher.
+        pos = std::min(pos, size());
+        len = std::min(len, size() - pos);
+        line_levels(pos, len);
+        order.resize(len);
+        std::iota(order.begin(), order.end(), pos);
+        int high = 0, low_odd = max_depth + 2;
+        for (auto level: line) {
+            high = std::max(high, int(level));
+            if (level % 2)
+                low_odd = std::min(low_odd, int(level));
+        }
+        for (int level = high; level >= low_odd; --level) {
+            size_t k = 0;
+            while (k < len) {
+                if (line[order[k] - pos] < level) {
+                    ++k;
+                    continue;
+                }
+                size_t b = k + 1;
+                while (b < len && line[order[b] - pos] >= level)
+                    ++b;
+                std::reverse(order.begin() + k, order.begin() + b);
+                k = b;
+            }
+        }
+        return order;
+    }
+
+    std::u32string BidiParagraph::visual_text(size_t pos, size_t len) {
+        // L4. Characters at odd levels are replaced by their mirrored
+        // glyphs.
+        visual_order(pos, len);
+        std::u32string text;
+        text.reserve(order.size());
+        for (auto i: order) {
+            char32_t c = chars[i];
+            if (line[i - pos] % 2) {
+                char32_t m = bidi_mirroring_glyph(c);
+                if (m)
+                    c = m;
+            }
+            text += c;
+        }
+        return text;
+    }
+
+    void BidiParagraph::resolve(int level) {
+        if (level < auto_level || level > 1)
+            throw std::invalid_argument("Invalid paragraph level: " + dec(level));
+        size_t n = chars.size();
+        orig.resize(n);
+        for (size_t i = 0; i < n; ++i)
+            orig[i] = bidi_class(chars[i]);
+        types.assign(orig.begin(), orig.end());
+        lvls.assign(n, 0);
+        match.assign(n, npos);
+        match_isolates();
+        // P2-P3. Without an explicit level, the paragraph takes the
+        // direction of its first strong character.
+        para = level == auto_level ? std::max(first_strong(0, n), 0) : level;
+        resolve_explicit();
+        find_runs();
+        for (size_t r = 0; r < runs.size(); ++r) {
+            size_t first = runs[r].first;
+            if (orig[first] != BC::PDI || match[first] == npos)
+                resolve_sequence(r);
+        }
+        for (size_t i = 0; i < n; ++i)
+            if (is_removed(orig[i]))
+                lvls[i] = i == 0 ? uint8_t(para) : lvls[i - 1];
+    }
+
+    void BidiParagraph::match_isolates() {
+        // BD9. A PDI matches the nearest preceding unmatched isolate
+        // initiator, within the same paragraph.
+        stack.clear();
+        for (size_t i = 0; i < chars.size(); ++i) {
+            auto t = orig[i];
+            if (is_isolate_initiator(t)) {
+                stack.push_back(i);
+            } else if (t == BC::PDI && ! stack.empty()) {
+                match[i] = stack.back();
+                match[stack.back()] = i;
+                stack.pop_back();
+            } else if (t == BC::B) {
+                stack.clear();
+            }
+        }
+    }
+
+    int BidiParagraph::first_strong(size_t pos, size_t end) const noexcept {
+        // P2. Isolates are skipped, so the direction of an FSI depends only
+        // on the text it contains.
+        for (size_t i = pos; i < end; ++i) {
+            auto t = orig[i];
+            if (t == BC::L)
+                return 0;
+            else if (t == BC::R || t == BC::AL)
+                return 1;
+            else if (t == BC::B)
+                break;
+            else if (is_isolate_initiator(t) && (i = match[i]) == npos)
+                break;
+        }
+        return -1;
+    }
+
+    void BidiParagraph::resolve_explicit() {
+        // X1-X8. The directional status stack has a fixed depth, so it can
+        // live on the stack.
+        struct status { uint8_t level; BC override; bool isolate; };
+        std::array<status, max_depth + 2> st;
+        size_t depth = 1, over_isolates = 0, over_embeddings = 0, valid_isolates = 0;
+        st[0] = {uint8_t(para), BC::ON, false};
+        size_t n = chars.size();
+        for (size_t i = 0; i < n; ++i) {
+            auto t = orig[i];
+            auto& top = st[depth - 1];
+            switch (t) {
+                case BC::RLE: case BC::LRE: case BC::RLO: case BC::LRO: {
+                    lvls[i] = top.level;
+                    uint8_t level = t == BC::RLE || t == BC::RLO ? next_odd(top.level) : next_even(top.level);
+                    if (level <= max_depth && over_isolates == 0 && over_embeddings == 0)
+                        st[depth++] = {level, t == BC::RLO ? BC::R : t == BC::LRO ? BC::L : BC::ON, false};
+                    else if (over_isolates == 0)
+                        ++over_embeddings;
+                    break;
+                }
+                case BC::RLI: case BC::LRI: case BC::FSI: {
+                    lvls[i] = top.level;
+                    if (top.override != BC::ON)
+                        types[i] = top.override;
+                    bool rtl = t == BC::RLI || (t == BC::FSI && first_strong(i + 1, match[i] == npos ? n : match[i]) == 1);
+                    uint8_t level = rtl ? next_odd(top.level) : next_even(top.level);
+                    if (level <= max_depth && over_isolates == 0 && over_embeddings == 0) {
+                        ++valid_isolates;
+                        st[depth++] = {level, BC::ON, true};
+                    } else {
+                        ++over_isolates;
+                    }
+                    break;
+                }
+                case BC::PDI:
+                    if (over_isolates > 0) {
+                        --over_isolates;
+                    } else if (valid_isolates > 0) {
+                        over_embeddings = 0;
+                        while (! st[depth - 1].isolate)
+                            --depth;
+                        --depth;
+                        --valid_isolates;
+                    }
+                    lvls[i] = st[depth - 1].level;
+                    if (st[depth - 1].override != BC::ON)
+                        types[i] = st[depth - 1].override;
+                    break;
+                case BC::PDF:
+                    lvls[i] = top.level;
+                    if (over_isolates > 0) {}
+                    else if (over_embeddings > 0)
+                        --over_embeddings;
+                    else if (! top.isolate && depth >= 2)
+                        --depth;
+                    break;
+                case BC::B:
+                    lvls[i] = uint8_t(para);
+                    depth = 1;
+                    over_isolates = over_embeddings = valid_isolates = 0;
+                    break;
+                case BC::BN:
+                    lvls[i] = top.level;
+                    break;
+                default:
+                    lvls[i] = top.level;
+                    if (top.override != BC::ON)
+                        types[i] = top.override;
+                    break;
+            }
+        }
+    }
+
+    void BidiParagraph::find_runs() {
+        // BD7. Level runs are built in one pass, skipping characters
+        // removed by X9, and recording the levels on either side for X10.
+        runs.clear();
+        for (size_t i = 0; i < chars.size(); ++i) {
+            if (is_removed(orig[i]))
+                continue;
+            if (runs.empty() || lvls[i] != runs.back().level) {
+                uint8_t before = uint8_t(para);
+                if (! runs.empty()) {
+                    before = runs.back().level;
+                    runs.back().after = lvls[i];
+                }
+                runs.push_back({i, i + 1, lvls[i], before, uint8_t(para)});
+            } else {
+                runs.back().end = i + 1;
+            }
+        }
+    }
+
+    void BidiParagraph::resolve_sequence(size_t run) {
+        // BD13. An isolating run sequence continues from a level run ending
+        // in an isolate initiator to the one starting with its matching PDI.
+        seq.clear();
+        uint8_t level = runs[run].level;
+        auto sos = level_direction(std::max(level, runs[run].before));
+        for (;;) {
+            auto& r = runs[run];
+            for (size_t i = r.first; i < r.end; ++i)
+                if (! is_removed(orig[i]))
+                    seq.push_back(i);
+            size_t last = r.end - 1;
+            if (! is_isolate_initiator(orig[last]) || match[last] == npos)
+                break;
+            auto it = std::lower_bound(runs.begin(), runs.end(), match[last],
+                [] (const level_run& lr, size_t i) { return lr.first < i; });
+            if (it == runs.end() || it->first != match[last])
+                break;
+            run = it - runs.begin();
+        }
+        uint8_t after = is_isolate_initiator(orig[seq.back()]) ? uint8_t(para) : runs[run].after;
+        auto eos = level_direction(std::max(level, after));
+        resolve_weak(sos, eos);
+        resolve_brackets(sos, level);
+        resolve_neutral(sos, eos, level);
+        // I1-I2
+        for (auto i: seq) {
+            auto t = types[i];
+            if (level % 2 == 0) {
+                if (t == BC::R)
+                    lvls[i] += 1;
+                else if (t == BC::AN || t == BC::EN)
+                    lvls[i] += 2;
+            } else if (t == BC::L || t == BC::EN || t == BC::AN) {
+                lvls[i] += 1;
+            }
+        }
+    }
+
+    void BidiParagraph::resolve_weak(Bidi_Class sos, Bidi_Class eos) {
+        size_t n = seq.size();
+        // W1. NSM takes the class of the preceding character, or ON after
+        // an isolate initiator or PDI.
+        auto prev = sos;
+        for (auto i: seq) {
+            auto& t = types[i];
+            if (t == BC::NSM)
+                t = is_isolate_initiator(prev) || prev == BC::PDI ? BC::ON : prev;
+            prev = t;
+        }
+        // W2-W3. EN after AL becomes AN; AL becomes R.
+        auto strong = sos;
+        for (auto i: seq) {
+            auto& t = types[i];
+            if (t == BC::L || t == BC::R) {
+                strong = t;
+            } else if (t == BC::AL) {
+                strong = t;
+                t = BC::R;
+            } else if (t == BC::EN && strong == BC::AL) {
+                t = BC::AN;
+            }
+        }
+        // W4. A single separator between two numbers of the same kind
+        // joins them.
+        for (size_t j = 1; j + 1 < n; ++j) {
+            auto& t = types[seq[j]];
+            if (t != BC::ES && t != BC::CS)
+                continue;
+            auto p = types[seq[j - 1]], q = types[seq[j + 1]];
+            if (p == BC::EN && q == BC::EN)
+                t = BC::EN;
+            else if (t == BC::CS && p == BC::AN && q == BC::AN)
+                t = BC::AN;
+        }
+        // W5. Terminators next to European numbers become EN.
+        for (size_t j = 0; j < n;) {
+            if (types[seq[j]] != BC::ET) {
+                ++j;
+                continue;
+            }
+            size_t b = j + 1;
+            while (b < n && types[seq[b]] == BC::ET)
+                ++b;
+            auto p = j > 0 ? types[seq[j - 1]] : sos, q = b < n ? types[seq[b]] : eos;
+            if (p == BC::EN || q == BC::EN)
+                for (; j < b; ++j)
+                    types[seq[j]] = BC::EN;
+            j = b;
+        }
+        // W6-W7. Remaining separators and terminators become ON; EN after
+        // L becomes L.
+        strong = sos;
+        for (auto i: seq) {
+            auto& t = types[i];
+            if (t == BC::ES || t == BC::ET || t == BC::CS)
+                t = BC::ON;
+            else if (t == BC::L || t == BC::R)
+                strong = t;
+            else if (t == BC::EN && strong == BC::L)
+                t = BC::L;
+        }
+    }
+
+    void BidiParagraph::resolve_brackets(Bidi_Class sos, uint8_t level) {
+        // BD16. Bracket pairs are found with a stack of opening brackets;
+        // if the stack overflows, no more pairs are looked for.
+        size_t n = seq.size();
+        pairs.clear();
+        stack.clear();
+        for (size_t j = 0; j < n; ++j) {
+            size_t i = seq[j];
+            if (types[i] != BC::ON)
+                continue;
+            char type = bidi_paired_bracket_type(chars[i]);
+            if (type == 'o') {
+                if (stack.size() == max_bracket_depth)
+                    break;
+                stack.push_back(j);
+            } else if (type == 'c') {
+                char32_t c = canonical_bracket(chars[i]);
+                for (size_t s = stack.size(); s > 0; --s) {
+                    size_t o = stack[s - 1];
+                    if (canonical_bracket(bidi_paired_bracket(chars[seq[o]])) == c) {
+                        pairs.push_back({o, j});
+                        stack.resize(s - 1);
+                        break;
+                    }
+                }
+            }
+        }
+        if (pairs.empty())
+            return;
+        std::sort(pairs.begin(), pairs.end(), [] (const bracket& a, const bracket& b) { return a.open < b.open; });
+        // N0. A bracket pair takes the embedding direction if it encloses
+        // a strong character of that direction; otherwise the opposite
+        // direction, if it encloses one and the preceding context agrees.
+        auto embed = level_direction(level);
+        for (auto& p: pairs) {
+            auto found = BC::ON;
+            for (size_t j = p.open + 1; j < p.close && found != embed; ++j) {
+                auto s = strong_direction(types[seq[j]]);
+                if (s != BC::ON)
+                    found = s;
+            }
+            if (found == BC::ON)
+                continue;
+            if (found != embed) {
+                auto context = sos;
+                for (size_t j = p.open; j > 0; --j) {
+                    auto s = strong_direction(types[seq[j - 1]]);
+                    if (s != BC::ON) {
+                        context = s;
+                        break;
+                    }
+                }
+                if (context != found)
+                    found = embed;
+            }
+            for (size_t j: {p.open, p.close}) {
+                types[seq[j]] = found;
+                for (++j; j < n && orig[seq[j]] == BC::NSM; ++j)
+                    types[seq[j]] = found;
+            }
+        }
+    }
+
+    void BidiParagraph::resolve_neutral(Bidi_Class sos, Bidi_Class eos, uint8_t level) {
+        // N1-N2. A run of neutrals between characters of the same
+        // direction takes that direction, otherwise the embedding
+        // direction.
+        size_t n = seq.size();
+        auto embed = level_direction(level);
+        for (size_t j = 0; j < n;) {
+            if (! is_neutral(types[seq[j]])) {
+                ++j;
+                continue;
+            }
+            size_t b = j + 1;
+            while (b < n && is_neutral(types[seq[b]]))
+                ++b;
+            auto p = j > 0 ? strong_direction(types[seq[j - 1]]) : sos;
+            auto q = b < n ? strong_direction(types[seq[b]]) : eos;
+            auto dir = p == q ? p : embed;
+            for (; j < b; ++j)
+                types[seq[j]] = dir;
+        }
+    }
+
+}
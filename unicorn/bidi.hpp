@@ -0,0 +1,59 @@
+#pragma once
+
+#include "unicorn/core.hpp"
+#include "unicorn/character.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace RS::Unicorn {
+
+    // Bidirectional algorithm (UAX #9). The paragraph keeps its scratch
+    // buffers between calls to set_text(), so a renderer can reuse one
+    // object for many paragraphs without allocating once the buffers have
+    // grown to the size of the longest paragraph.
+
+    class BidiParagraph {
+    public:
+        static constexpr int auto_level = -1;
+        static constexpr int max_depth = 125;
+        BidiParagraph() = default;
+        explicit BidiParagraph(std::u32string_view text, int level = auto_level) { set_text(text, level); }
+        explicit BidiParagraph(std::string_view text, int level = auto_level) { set_text(text, level); }
+        void set_text(std::u32string_view text, int level = auto_level);
+        void set_text(std::string_view text, int level = auto_level);
+        bool empty() const noexcept { return chars.empty(); }
+        size_t size() const noexcept { return chars.size(); }
+        const std::u32string& text() const noexcept { return chars; }
+        int paragraph_level() const noexcept { return para; }
+        const std::vector<uint8_t>& levels() const noexcept { return lvls; }
+        const std::vector<uint8_t>& line_levels(size_t pos, size_t len);
+        const std::vector<size_t>& visual_order(size_t pos, size_t len);
+        std::u32string visual_text(size_t pos, size_t len);
+    private:
+        struct bracket { size_t open, close; };
+        struct level_run { size_t first, end; uint8_t level, before, after; };
+        std::u32string chars;           // Text of the paragraph
+        std::vector<Bidi_Class> orig;   // Original bidi classes
+        std::vector<Bidi_Class> types;  // Classes as resolved by the W and N rules
+        std::vector<uint8_t> lvls;      // Resolved embedding levels
+        std::vector<size_t> match;      // Matching PDI or isolate initiator, or npos
+        std::vector<level_run> runs;    // Level runs (BD7)
+        std::vector<size_t> seq;        // Indexes of the current isolating run sequence (BD13)
+        std::vector<size_t> stack;      // Scratch stack for isolate and bracket matching
+        std::vector<bracket> pairs;     // Bracket pairs in the current sequence (BD16)
+        std::vector<uint8_t> line;      // Line levels from line_levels()
+        std::vector<size_t> order;      // Visual order from visual_order()
+        int para = 0;
+        void resolve(int level);
+        void match_isolates();
+        int first_strong(size_t pos, size_t end) const noexcept;
+        void resolve_explicit();
+        void find_runs();
+        void resolve_sequence(size_t run);
+        void resolve_weak(Bidi_Class sos, Bidi_Class eos);
+        void resolve_brackets(Bidi_Class sos, uint8_t level);
+        void resolve_neutral(Bidi_Class sos, Bidi_Class eos, uint8_t level);
+    };
+
+}
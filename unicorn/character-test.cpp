@@ -691,6 +691,38 @@ namespace {
         TEST_EQUAL(v.at(0), GC::Cc);
         TEST_EQUAL(v.at(29), GC::Zs);
 
+        TEST(gc_predicate("L&Nd")(0x41));
+        TEST(gc_predicate("L&Nd")(0x30));
+        TEST(! gc_predicate("L&Nd")(0xaa));
+        TEST(! gc_predicate("L&Nd")(0xb2));
+
+        constexpr GcSet letters("L"), cased("LC"), digits(GC::Nd);
+        static_assert(cased == GcSet("L&"));
+        static_assert(cased == GcSet("Lltu"));
+        static_assert((cased | digits) == GcSet("L&,Nd"));
+        static_assert((letters & cased) == cased);
+        static_assert((~ letters & cased).empty());
+        static_assert((letters | ~ letters) == GcSet("C,L,M,N,P,S,Z"));
+        static_assert(letters.contains(GC::Lo));
+        static_assert(! cased.contains(GC::Lo));
+        static_assert(GcSet("").empty());
+        static_assert(GcSet("Xy").empty());
+
+        TEST(letters(U'a'));
+        TEST(letters(0x4e00));
+        TEST(! letters(U'1'));
+        TEST(cased(0x1c5));
+        TEST(! cased(0x4e00));
+        TEST(digits(0x660));
+        TEST(! digits(0x2160));
+        TEST(GcSet(u8"Cn"s)(0x378));
+        TEST(GcSet("Cn")(0x110000));
+
+        for (auto gc: gc_list()) {
+            GcSet set(gc);
+            TEST(set.contains(gc));
+            TEST(! (~ set).contains(gc));
+        }
     }
 
     void check_boolean_properties() {
@@ -1265,6 +1297,49 @@ namespace {
         for (char32_t c = 0; c <= 0x10ffff; ++c)
             TEST_COMPARE(char_name(c, Cname::control | Cname::label), !=, "");
 
+        char32_t u = 0;
+
+        TEST_EQUAL(char_from_name("SPACE"), 0x20);
+        TEST_EQUAL(char_from_name("LATIN CAPITAL LETTER A"), 0x41);
+        TEST_EQUAL(char_from_name("latin small letter a"), 0x61);
+        TEST_EQUAL(char_from_name("Latin_Small_Letter_A"), 0x61);
+        TEST_EQUAL(char_from_name("euro sign"), 0x20ac);
+        TEST_EQUAL(char_from_name("hyphen-minus"), 0x2d);
+        TEST_EQUAL(char_from_name("HYPHENMINUS"), 0x2d);
+        TEST_EQUAL(char_from_name("REPLACEMENT CHARACTER"), 0xfffd);
+        TEST_EQUAL(char_from_name("variation selector-256"), 0xe01ef);
+        TEST_EQUAL(char_from_name("LATIN CAPITAL LETTER OI"), 0x1a2);
+        TEST_EQUAL(char_from_name("LATIN CAPITAL LETTER GHA"), 0x1a2);
+        TEST_EQUAL(char_from_name("BYZANTINE MUSICAL SYMBOL FTHORA SKLIRON CHROMA VASIS"), 0x1d0c5);
+        TEST_EQUAL(char_from_name("NULL"), 0);
+        TEST_EQUAL(char_from_name("line feed"), 0xa);
+        TEST_EQUAL(char_from_name("APPLICATION PROGRAM COMMAND"), 0x9f);
+        TEST_EQUAL(char_from_name("CJK UNIFIED IDEOGRAPH-4E00"), 0x4e00);
+        TEST_EQUAL(char_from_name("cjk unified ideograph-4e00"), 0x4e00);
+        TEST_EQUAL(char_from_name("CJK COMPATIBILITY IDEOGRAPH-F900"), 0xf900);
+        TEST_EQUAL(char_from_name("HANGUL SYLLABLE GA"), 0xac00);
+        TEST_EQUAL(char_from_name("HANGUL SYLLABLE A"), 0xc544);
+        TEST_EQUAL(char_from_name("hangul syllable pwilh"), 0xd4db);
+        TEST_EQUAL(char_from_name("HANGUL JUNGSEONG OE"), 0x116c);
+        TEST_EQUAL(char_from_name("HANGUL JUNGSEONG O-E"), 0x1180);
+        TEST_EQUAL(char_from_name("hangul-jungseong oe"), 0x116c);
+        TEST_EQUAL(char_from_name("hangul_jungseong_oe_"), 0x116c);
+        TEST_EQUAL(char_from_name("hangul jungseong o-e "), 0x1180);
+        TEST_EQUAL(char_from_name("hangul-jungseong_o-e"), 0x1180);
+
+        TEST(! char_from_name("", u));
+        TEST(! char_from_name("NO SUCH CHARACTER", u));
+        TEST(! char_from_name("LATIN CAPITAL LETTER", u));
+        TEST(! char_from_name("CJK UNIFIED IDEOGRAPH-E000", u));
+        TEST(! char_from_name("HANGUL SYLLABLE XYZ", u));
+        TEST_THROW(char_from_name("NO SUCH CHARACTER"), std::invalid_argument);
+
+        for (char32_t c = 0; c <= 0x10ffff; ++c) {
+            auto name = char_name(c);
+            if (! name.empty())
+                TEST_EQUAL(char_from_name(name), c);
+        }
+
     }
 
     void check_decomposition_properties() {
@@ -1710,6 +1785,51 @@ namespace {
         TEST_EQUAL(to_str(char_script_list(0x964)), "[Beng,Deva,Gran,Gujr,Guru,Knda,Mahj,Mlym,Orya,Sind,"
                                                     "Sinh,Sylo,Takr,Taml,Telu,Tirh]");
 
+        TEST_EQUAL(char_script_id(0), Script::Zyyy);
+        TEST_EQUAL(char_script_id(0x41), Script::Latn);
+        TEST_EQUAL(char_script_id(0x300), Script::Zinh);
+        TEST_EQUAL(char_script_id(0x370), Script::Grek);
+        TEST_EQUAL(char_script_id(0x400), Script::Cyrl);
+        TEST_EQUAL(char_script_id(0x600), Script::Arab);
+        TEST_EQUAL(char_script_id(0x4e00), Script::Hani);
+        TEST_EQUAL(char_script_id(0x10fffd), Script::Zzzz);
+        TEST_EQUAL(char_script_id(0x110000), Script::Zzzz);
+
+        TEST_EQUAL(U8string(script_abbr(Script::Latn)), "Latn");
+        TEST_EQUAL(U8string(script_abbr(Script::Zzzz)), "Zzzz");
+        TEST_EQUAL(U8string(script_name(Script::Latn)), "Latin");
+        TEST_EQUAL(U8string(script_name(Script::Cyrl)), "Cyrillic");
+        TEST_EQUAL(U8string(script_name(Script::Zyyy)), "Common");
+        TEST_EQUAL(script_id("Grek"), Script::Grek);
+        TEST_EQUAL(script_id("GREK"), Script::Grek);
+        TEST_EQUAL(script_id("cyrs"), Script::Cyrl);
+        TEST_EQUAL(script_id("Latf"), Script::Latn);
+        TEST_EQUAL(script_id("Aaaa"), Script::Zzzz);
+
+        for (char32_t c: {0x0, 0x41, 0x370, 0x1cd0, 0x342, 0x64b, 0x640, 0x964, 0x10fffd}) {
+            Strings list;
+            for (auto sc: char_script_extensions(c).list())
+                list.push_back(script_abbr(sc));
+            TEST_EQUAL(to_str(list), to_str(char_script_list(c)));
+        }
+
+        ScriptSet set;
+        TEST(set.empty());
+        TEST_EQUAL(set.size(), 0);
+        TEST_EQUAL(set.first(), Script::Zzzz);
+        TRY(set = char_script_extensions(0x64b));
+        TEST_EQUAL(set.size(), 2);
+        TEST(set.contains(Script::Arab));
+        TEST(set.contains(Script::Syrc));
+        TEST(! set.contains(Script::Latn));
+        TEST_EQUAL(set.first(), Script::Arab);
+        TEST(set == (ScriptSet(Script::Arab) | ScriptSet(Script::Syrc)));
+        TEST((set & char_script_extensions(0x640)) == set);
+        TEST((set & ScriptSet(Script::Latn)).empty());
+        TEST_EQUAL((~ set).size(), script_count - 2);
+        TRY(set.erase(Script::Arab));
+        TEST(set == ScriptSet(Script::Syrc));
+
     }
 
     void check_all_the_things() {
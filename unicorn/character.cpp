@@ -5,7 +5,6 @@
 #include <array>
 #include <iterator>
 #include <unordered_map>
-#include <zlib.h>
 
 using namespace std::literals;
 
@@ -65,73 +64,32 @@ namespace RS::Unicorn {
 
     namespace {
 
-        using CategoryTable = std::vector<std::pair<GC, GC>>;
+        constexpr GC gc_by_index[] = {
+            GC::Cc, GC::Cf, GC::Cn, GC::Co, GC::Cs,
+            GC::Ll, GC::Lm, GC::Lo, GC::Lt, GC::Lu,
+            GC::Mc, GC::Me, GC::Mn,
+            GC::Nd, GC::Nl, GC::No,
+            GC::Pc, GC::Pd, GC::Pe, GC::Pf, GC::Pi, GC::Po, GC::Ps,
+            GC::Sc, GC::Sk, GC::Sm, GC::So,
+            GC::Zl, GC::Zp, GC::Zs,
+        };
 
-        std::function<bool(char32_t)> make_category_function(const CategoryTable& table) {
-            return [=] (char32_t c) {
-                auto cat = char_general_category(c);
-                for (auto& pair: table)
-                    if (cat >= pair.first && cat <= pair.second)
-                        return true;
-                return false;
-            };
-        }
-
-        CategoryTable make_category_table(const char* cat, size_t n) {
-            CategoryTable table;
-            static constexpr auto L0 = uint16_t('L') << 8;
-            if (! cat)
-                return table;
-            int entries = 0;
-            uint16_t prefix = 0;
-            for (size_t i = 0; i < n; ++i) {
-                char c = cat[i];
-                if (ascii_isalpha(c)) {
-                    if (prefix == 0) {
-                        prefix = uint16_t(encode_gc(ascii_toupper(c), 0));
-                    } else if ((c == 'C' || c == 'c') && prefix == L0) {
-                        table.push_back({GC::Ll, GC::Ll});
-                        table.push_back({GC::Lt, GC::Lu});
-                        entries += 2;
-                    } else {
-                        GC code = GC(prefix + uint8_t(ascii_tolower(c)));
-                        table.push_back({code, code});
-                        ++entries;
-                    }
-                } else if (c == '&') {
-                    if (prefix == L0) {
-                        table.push_back({GC::Ll, GC::Ll});
-                        table.push_back({GC::Lt, GC::Lu});
-                        entries += 2;
-                    }
-                } else {
-                    if (entries == 0 && prefix != 0)
-                        table.push_back({GC(prefix), GC(prefix + 0xff)});
-                    entries = 0;
-                    prefix = 0;
-                }
-            }
-            if (entries == 0 && prefix != 0)
-                table.push_back({GC(prefix), GC(prefix + 0xff)});
-            return table;
+    }
+
+    namespace UnicornDetail {
+
+        uint8_t char_gc_index(char32_t c) noexcept {
+            return two_stage_lookup(general_category_stage1_table, general_category_stage2_table, std::min(c, last_unicode_char));
         }
 
     }
 
     GC char_general_category(char32_t c) noexcept {
-        return GC(sparse_table_lookup(UnicornDetail::general_category_table, c));
+        return gc_by_index[UnicornDetail::char_gc_index(c)];
     }
 
     std::vector<GC> gc_list() {
-        return {
-            GC::Cc, GC::Cf, GC::Cn, GC::Co, GC::Cs,
-            GC::Ll, GC::Lm, GC::Lo, GC::Lt, GC::Lu,
-            GC::Mc, GC::Me, GC::Mn,
-            GC::Nd, GC::Nl, GC::No,
-            GC::Pc, GC::Pd, GC::Pe, GC::Pf, GC::Pi, GC::Po, GC::Ps,
-            GC::Sc, GC::Sk, GC::Sm, GC::So,
-            GC::Zl, GC::Zp, GC::Zs,
-        };
+        return {std::begin(gc_by_index), std::end(gc_by_index)};
     }
 
     const char* gc_name(GC cat) noexcept {
@@ -170,22 +128,6 @@ namespace RS::Unicorn {
         }
     }
 
-    std::function<bool(char32_t)> gc_predicate(GC cat) {
-        CategoryTable table;
-        table.push_back({cat, cat});
-        return make_category_function(table);
-    }
-
-    std::function<bool(char32_t)> gc_predicate(const U8string& cat) {
-        auto table = make_category_table(cat.data(), cat.size());
-        return make_category_function(table);
-    }
-
-    std::function<bool(char32_t)> gc_predicate(const char* cat) {
-        auto table = make_category_table(cat, strlen(cat));
-        return make_category_function(table);
-    }
-
     // Boolean properties
 
     bool char_is_default_ignorable(char32_t c) noexcept { return sparse_set_lookup(UnicornDetail::default_ignorable_table, c); }
@@ -339,58 +281,156 @@ namespace RS::Unicorn {
 
     namespace {
 
-        class ZlibError:
-        public InitializationError {
-        public:
-            ZlibError(int error):
-                InitializationError("Zlib error: " + decode(error)) {}
-        private:
-            static U8string decode(int error) {
-                switch (error) {
-                    case Z_ERRNO:          return "Z_ERRNO";
-                    case Z_STREAM_ERROR:   return "Z_STREAM_ERROR";
-                    case Z_DATA_ERROR:     return "Z_DATA_ERROR";
-                    case Z_MEM_ERROR:      return "Z_MEM_ERROR";
-                    case Z_BUF_ERROR:      return "Z_BUF_ERROR";
-                    case Z_VERSION_ERROR:  return "Z_VERSION_ERROR";
-                    default:               return dec(error);
-                }
-            }
-        };
+        // Character names are stored as sequences of word numbers in a
+        // phrasebook, divided into chunks of consecutive entries (see
+        // scripts/make-tables for the format). Looking up a name decodes
+        // at most one chunk, and allocates nothing beyond the result.
+
+        constexpr uint8_t end_of_name = 0xff;
+        constexpr uint8_t first_long_word = 0xc0;
 
-        class CharacterNameMap {
+        class NameCursor {
         public:
-            CharacterNameMap();
-            const U8string& operator[](char32_t c) const;
+            explicit NameCursor(size_t chunk) noexcept;
+            char32_t code() const noexcept { return cp; }
+            bool next() noexcept;
+            template <typename F> int each_word(F f) const;
         private:
-            std::unordered_map<char32_t, U8string> map;
+            const uint8_t* book;
+            size_t pos;
+            size_t end;
+            char32_t cp;
         };
 
-        CharacterNameMap::CharacterNameMap() {
+        NameCursor::NameCursor(size_t chunk) noexcept {
             using namespace UnicornDetail;
-            U8string names_list(main_names_expanded, 0);
-            auto src = reinterpret_cast<const uint8_t*>(main_names_data);
-            auto dst = reinterpret_cast<uint8_t*>(&names_list[0]);
-            unsigned long dstlen = main_names_expanded;
-            auto rc = uncompress(dst, &dstlen, src, main_names_compressed);
-            if (rc != Z_OK)
-                throw ZlibError(rc);
-            size_t i = 0;
-            while (i < main_names_expanded) {
-                auto j = names_list.find(';', i);
-                auto k = names_list.find(';', j + 1);
-                if (j == npos || k == npos)
-                    break;
-                auto c = char32_t(strtoul(names_list.data() + i, nullptr, 16));
-                map[c] = names_list.substr(j + 1, k - j - 1);
-                i = k + 1;
+            auto& chunks = name_chunks_table;
+            book = reinterpret_cast<const uint8_t*>(name_phrasebook_data);
+            pos = chunks.begin()[chunk].offset;
+            end = chunk + 1 < range_count(chunks) ? chunks.begin()[chunk + 1].offset : name_phrasebook_size;
+            cp = chunks.begin()[chunk].code;
+        }
+
+        bool NameCursor::next() noexcept {
+            while (book[pos] != end_of_name)
+                pos += book[pos] < first_long_word ? 1 : 2;
+            ++pos;
+            if (pos == end)
+                return false;
+            if (book[pos] == 0xff) {
+                cp += (char32_t(book[pos + 1]) << 16) + (char32_t(book[pos + 2]) << 8) + book[pos + 3];
+                pos += 4;
+            } else {
+                cp += book[pos];
+                ++pos;
             }
+            return true;
         }
 
-        const U8string& CharacterNameMap::operator[](char32_t c) const {
-            static const U8string dummy;
-            auto i = map.find(c);
-            return i == map.end() ? dummy : i->second;
+        // Call f(word) for each word in the name, stopping at the first
+        // nonzero return value
+
+        template <typename F>
+        int NameCursor::each_word(F f) const {
+            using namespace UnicornDetail;
+            auto offsets = name_word_offsets_table.begin();
+            for (size_t i = pos; book[i] != end_of_name;) {
+                size_t w = book[i++];
+                if (w >= first_long_word)
+                    w = first_long_word + ((w - first_long_word) << 8) + book[i++];
+                int rc = f(std::string_view(name_words_data + offsets[w], offsets[w + 1] - offsets[w]));
+                if (rc)
+                    return rc;
+            }
+            return 0;
+        }
+
+        NameCursor name_entry(size_t n) noexcept {
+            NameCursor cursor(n / UnicornDetail::name_chunk_size);
+            for (n %= UnicornDetail::name_chunk_size; n > 0; --n)
+                cursor.next();
+            return cursor;
+        }
+
+        bool append_main_name(char32_t c, U8string& dst) {
+            using namespace UnicornDetail;
+            auto& chunks = name_chunks_table;
+            auto it = std::upper_bound(chunks.begin(), chunks.end(), c,
+                [] (char32_t c, const NameChunk& chunk) { return c < chunk.code; });
+            if (it == chunks.begin())
+                return false;
+            NameCursor cursor(it - chunks.begin() - 1);
+            while (cursor.code() < c && cursor.next()) {}
+            if (cursor.code() != c)
+                return false;
+            cursor.each_word([&dst] (std::string_view word) {
+                if (! dst.empty())
+                    dst += ' ';
+                dst += word;
+                return 0;
+            });
+            return true;
+        }
+
+        // UAX44-LM2: loose matching ignores case, whitespace, underscores,
+        // and medial hyphens (between two letters or digits)
+
+        bool is_loose_ignorable(std::string_view name, size_t i) noexcept {
+            char c = name[i];
+            return ascii_isspace(c) || c == '_'
+                || (c == '-' && i > 0 && i + 1 < name.size() && ascii_isalnum(name[i - 1]) && ascii_isalnum(name[i + 1]));
+        }
+
+        U8string loose_name_key(std::string_view name) {
+            U8string key;
+            for (size_t i = 0; i < name.size(); ++i)
+                if (! is_loose_ignorable(name, i))
+                    key += ascii_toupper(name[i]);
+            return key;
+        }
+
+        // Compare the loose key of part of a name with the key starting at
+        // key[k], advancing k; nonzero if they differ
+
+        int compare_loose(std::string_view name, std::string_view key, size_t& k) noexcept {
+            for (size_t i = 0; i < name.size(); ++i) {
+                if (is_loose_ignorable(name, i))
+                    continue;
+                if (k == key.size())
+                    return 1;
+                auto a = uint8_t(ascii_toupper(name[i])), b = uint8_t(key[k++]);
+                if (a != b)
+                    return a < b ? -1 : 1;
+            }
+            return 0;
+        }
+
+        bool loose_equal(std::string_view name, std::string_view key) noexcept {
+            size_t k = 0;
+            return compare_loose(name, key, k) == 0 && k == key.size();
+        }
+
+        bool find_main_name(const U8string& key, char32_t& c) noexcept {
+            using namespace UnicornDetail;
+            auto index = name_index_table.begin();
+            size_t lo = 0, hi = range_count(name_index_table);
+            while (lo < hi) {
+                size_t mid = (lo + hi) / 2;
+                auto cursor = name_entry(index[mid]);
+                size_t k = 0;
+                int rc = cursor.each_word([&] (std::string_view word) { return compare_loose(word, key, k); });
+                if (rc == 0 && k < key.size())
+                    rc = -1;
+                if (rc == 0) {
+                    c = cursor.code();
+                    return true;
+                } else if (rc < 0) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+            return false;
         }
 
         bool is_unified_ideograph(char32_t c) noexcept {
@@ -402,35 +442,78 @@ namespace RS::Unicorn {
             return (c >= 0xf900 && c <= 0xfaff) || (c >= 0x2f800 && c <= 0x2fa1f);
         }
 
+        // Based on code in section 3.12 of the Unicode Standard
+
+        constexpr uint32_t hangul_s_base = 0xac00, hangul_l_count = 19, hangul_v_count = 21, hangul_t_count = 28,
+            hangul_n_count = hangul_v_count * hangul_t_count, hangul_s_count = hangul_l_count * hangul_n_count;
+
+        constexpr const char* jamo_l_table[] {
+            "G", "GG", "N", "D", "DD", "R", "M", "B", "BB",
+            "S", "SS", "", "J", "JJ", "C", "K", "T", "P", "H"
+        };
+        constexpr const char* jamo_v_table[] {
+            "A", "AE", "YA", "YAE", "EO", "E", "YEO", "YE", "O",
+            "WA", "WAE", "OE", "YO", "U", "WEO", "WE", "WI",
+            "YU", "EU", "YI", "I"
+        };
+        constexpr const char* jamo_t_table[] {
+            "", "G", "GG", "GS", "N", "NJ", "NH", "D", "L", "LG", "LM",
+            "LB", "LS", "LT", "LP", "LH", "M", "B", "BS",
+            "S", "SS", "NG", "J", "C", "K", "T", "P", "H"
+        };
+
         U8string hangul_name(char32_t c) {
-            // Based on code in section 3.12 of the Unicode Standard
-            static constexpr uint32_t s_base = 0xac00,
-                l_count = 19, v_count = 21, t_count = 28,
-                n_count = v_count * t_count, s_count = l_count * n_count;
-            static constexpr const char* jamo_l_table[] {
-                "G", "GG", "N", "D", "DD", "R", "M", "B", "BB",
-                "S", "SS", "", "J", "JJ", "C", "K", "T", "P", "H"
-            };
-            static constexpr const char* jamo_v_table[] {
-                "A", "AE", "YA", "YAE", "EO", "E", "YEO", "YE", "O",
-                "WA", "WAE", "OE", "YO", "U", "WEO", "WE", "WI",
-                "YU", "EU", "YI", "I"
-            };
-            static constexpr const char* jamo_t_table[] {
-                "", "G", "GG", "GS", "N", "NJ", "NH", "D", "L", "LG", "LM",
-                "LB", "LS", "LT", "LP", "LH", "M", "B", "BS",
-                "S", "SS", "NG", "J", "C", "K", "T", "P", "H"
-            };
-            if (c < s_base || c - s_base >= s_count)
+            if (c < hangul_s_base || c - hangul_s_base >= hangul_s_count)
                 return {};
-            auto s_index = c - s_base;
-            auto l_index = s_index / n_count;
-            auto v_index = (s_index % n_count) / t_count;
-            auto t_index = s_index % t_count;
+            auto s_index = c - hangul_s_base;
+            auto l_index = s_index / hangul_n_count;
+            auto v_index = (s_index % hangul_n_count) / hangul_t_count;
+            auto t_index = s_index % hangul_t_count;
             return "HANGUL SYLLABLE "s + jamo_l_table[l_index]
                 + jamo_v_table[v_index] + jamo_t_table[t_index];
         }
 
+        // The leading consonants, vowels, and trailing consonants of the
+        // syllable name (in a loose key) are looked up separately
+
+        template <size_t N>
+        int jamo_index(const char* const (&table)[N], std::string_view part) noexcept {
+            for (size_t i = 0; i < N; ++i)
+                if (part == table[i])
+                    return int(i);
+            return -1;
+        }
+
+        bool hangul_from_name(std::string_view key, char32_t& c) noexcept {
+            static constexpr std::string_view vowels = "AEIOUWY";
+            size_t v_pos = std::min(key.find_first_of(vowels), key.size());
+            size_t t_pos = std::min(key.find_first_not_of(vowels, v_pos), key.size());
+            int l = jamo_index(jamo_l_table, key.substr(0, v_pos));
+            int v = jamo_index(jamo_v_table, key.substr(v_pos, t_pos - v_pos));
+            int t = jamo_index(jamo_t_table, key.substr(t_pos));
+            if (l < 0 || v < 0 || t < 0)
+                return false;
+            c = hangul_s_base + (l * hangul_v_count + v) * hangul_t_count + t;
+            return true;
+        }
+
+        // Ideograph names end in a hexadecimal code point
+
+        bool ideograph_from_name(std::string_view key, char32_t& c, bool (*check)(char32_t) noexcept) noexcept {
+            if (key.size() < 4 || key.size() > 5)
+                return false;
+            char32_t u = 0;
+            for (char k: key) {
+                if (! ascii_isxdigit(k))
+                    return false;
+                u = 16 * u + (k <= '9' ? k - '0' : k - 'A' + 10);
+            }
+            if (! check(u))
+                return false;
+            c = u;
+            return true;
+        }
+
         const char* control_character_name(char32_t c) {
             switch (c) {
                 case 0x00: return "NULL";
@@ -506,7 +589,6 @@ namespace RS::Unicorn {
 
     U8string char_name(char32_t c, uint32_t flags) {
         using namespace UnicornDetail;
-        static const CharacterNameMap map;
         U8string name;
         if (flags & Cname::control) {
             auto name_ptr = control_character_name(c);
@@ -519,7 +601,7 @@ namespace RS::Unicorn {
                 name = name_ptr;
         }
         if (name.empty())
-            name = map[c];
+            append_main_name(c, name);
         if (name.empty()) {
             if (is_unified_ideograph(c))
                 name = "CJK UNIFIED IDEOGRAPH-" + ascii_uppercase(hex(c, 4));
@@ -562,6 +644,66 @@ namespace RS::Unicorn {
         return name;
     }
 
+    char32_t char_from_name(std::string_view name) {
+        char32_t c = 0;
+        if (! char_from_name(name, c))
+            throw std::invalid_argument("Unknown character name: " + quote(U8string(name)));
+        return c;
+    }
+
+    bool char_from_name(std::string_view name, char32_t& c) noexcept {
+        using namespace UnicornDetail;
+        static constexpr std::string_view hangul_jungseong_oe = "HANGULJUNGSEONGOE";
+        static constexpr std::string_view cjk_unified = "CJKUNIFIEDIDEOGRAPH";
+        static constexpr std::string_view cjk_compatibility = "CJKCOMPATIBILITYIDEOGRAPH";
+        static constexpr std::string_view hangul_syllable = "HANGULSYLLABLE";
+        try {
+            auto key = loose_name_key(name);
+            if (key.empty())
+                return false;
+            // The only two names that UAX44-LM2 does not distinguish by
+            // the loose key are HANGUL JUNGSEONG OE (U+116C) and HANGUL
+            // JUNGSEONG O-E (U+1180); only a hyphen between the final O and
+            // E is significant
+            if (key == hangul_jungseong_oe) {
+                auto skip = [&name] (size_t i) {
+                    while (i > 0 && (name[i - 1] == ' ' || name[i - 1] == '_'))
+                        --i;
+                    return i;
+                };
+                size_t i = skip(name.size());
+                if (i > 0)
+                    i = skip(i - 1);
+                c = i > 0 && name[i - 1] == '-' ? 0x1180 : 0x116c;
+                return true;
+            }
+            if (find_main_name(key, c))
+                return true;
+            std::string_view view(key);
+            if (view.substr(0, cjk_unified.size()) == cjk_unified)
+                return ideograph_from_name(view.substr(cjk_unified.size()), c, is_unified_ideograph);
+            if (view.substr(0, cjk_compatibility.size()) == cjk_compatibility)
+                return ideograph_from_name(view.substr(cjk_compatibility.size()), c, is_compatibility_ideograph);
+            if (view.substr(0, hangul_syllable.size()) == hangul_syllable)
+                return hangul_from_name(view.substr(hangul_syllable.size()), c);
+            for (auto& kv: corrected_names_table) {
+                if (loose_equal(kv.value, key)) {
+                    c = kv.key;
+                    return true;
+                }
+            }
+            for (char32_t u = 0; u <= 0x9f; ++u) {
+                auto ptr = control_character_name(u);
+                if (ptr && loose_equal(ptr, key)) {
+                    c = u;
+                    return true;
+                }
+            }
+        }
+        catch (...) {}
+        return false;
+    }
+
     // Decomposition properties
 
     int combining_class(char32_t c) noexcept {
@@ -668,11 +810,10 @@ namespace RS::Unicorn {
             return s;
         }
 
-        uint32_t encode_script(U8string abbr) {
-            abbr.resize(4, 0);
+        uint32_t encode_script(const U8string& abbr) noexcept {
             uint32_t code = 0;
-            for (char c: abbr)
-                code = (code << 8) | uint8_t(ascii_tolower(c));
+            for (size_t i = 0; i < 4; ++i)
+                code = (code << 8) | uint8_t(i < abbr.size() ? ascii_tolower(abbr[i]) : 0);
             return code;
         }
 
@@ -722,6 +863,52 @@ namespace RS::Unicorn {
                 return i->second;
         }
 
+        // ISO 15924 codes of the Script enumeration values. The script
+        // table was built from the ISO list by name, so where a script has
+        // several codes (e.g. Cyrl and Cyrs) it may hold a variant; these
+        // are mapped back to the code used by the UCD. Each code is spelled
+        // from the enumerator itself, and the order is checked against the
+        // enumeration's values.
+
+        struct ScriptAbbr {
+            Script id;
+            const char* code;
+        };
+
+        #define SCRIPT_ABBR(sc) ScriptAbbr{Script::sc, #sc}
+
+        constexpr ScriptAbbr script_abbrs[] = {
+            SCRIPT_ABBR(Zzzz), SCRIPT_ABBR(Aghb), SCRIPT_ABBR(Ahom), SCRIPT_ABBR(Arab), SCRIPT_ABBR(Armi), SCRIPT_ABBR(Armn), SCRIPT_ABBR(Avst), SCRIPT_ABBR(Bali),
+            SCRIPT_ABBR(Bamu), SCRIPT_ABBR(Bass), SCRIPT_ABBR(Batk), SCRIPT_ABBR(Beng), SCRIPT_ABBR(Bopo), SCRIPT_ABBR(Brah), SCRIPT_ABBR(Brai), SCRIPT_ABBR(Bugi),
+            SCRIPT_ABBR(Buhd), SCRIPT_ABBR(Cakm), SCRIPT_ABBR(Cans), SCRIPT_ABBR(Cari), SCRIPT_ABBR(Cham), SCRIPT_ABBR(Cher), SCRIPT_ABBR(Copt), SCRIPT_ABBR(Cprt),
+            SCRIPT_ABBR(Cyrl), SCRIPT_ABBR(Deva), SCRIPT_ABBR(Dsrt), SCRIPT_ABBR(Dupl), SCRIPT_ABBR(Egyp), SCRIPT_ABBR(Elba), SCRIPT_ABBR(Ethi), SCRIPT_ABBR(Geor),
+            SCRIPT_ABBR(Glag), SCRIPT_ABBR(Goth), SCRIPT_ABBR(Gran), SCRIPT_ABBR(Grek), SCRIPT_ABBR(Gujr), SCRIPT_ABBR(Guru), SCRIPT_ABBR(Hang), SCRIPT_ABBR(Hani),
+            SCRIPT_ABBR(Hano), SCRIPT_ABBR(Hatr), SCRIPT_ABBR(Hebr), SCRIPT_ABBR(Hira), SCRIPT_ABBR(Hluw), SCRIPT_ABBR(Hmng), SCRIPT_ABBR(Hung), SCRIPT_ABBR(Ital),
+            SCRIPT_ABBR(Java), SCRIPT_ABBR(Kali), SCRIPT_ABBR(Kana), SCRIPT_ABBR(Khar), SCRIPT_ABBR(Khmr), SCRIPT_ABBR(Khoj), SCRIPT_ABBR(Knda), SCRIPT_ABBR(Kthi),
+            SCRIPT_ABBR(Lana), SCRIPT_ABBR(Laoo), SCRIPT_ABBR(Latn), SCRIPT_ABBR(Lepc), SCRIPT_ABBR(Limb), SCRIPT_ABBR(Lina), SCRIPT_ABBR(Linb), SCRIPT_ABBR(Lisu),
+            SCRIPT_ABBR(Lyci), SCRIPT_ABBR(Lydi), SCRIPT_ABBR(Mahj), SCRIPT_ABBR(Mand), SCRIPT_ABBR(Mani), SCRIPT_ABBR(Mend), SCRIPT_ABBR(Merc), SCRIPT_ABBR(Mero),
+            SCRIPT_ABBR(Mlym), SCRIPT_ABBR(Modi), SCRIPT_ABBR(Mong), SCRIPT_ABBR(Mroo), SCRIPT_ABBR(Mtei), SCRIPT_ABBR(Mult), SCRIPT_ABBR(Mymr), SCRIPT_ABBR(Narb),
+            SCRIPT_ABBR(Nbat), SCRIPT_ABBR(Nkoo), SCRIPT_ABBR(Ogam), SCRIPT_ABBR(Olck), SCRIPT_ABBR(Orkh), SCRIPT_ABBR(Orya), SCRIPT_ABBR(Osma), SCRIPT_ABBR(Palm),
+            SCRIPT_ABBR(Pauc), SCRIPT_ABBR(Perm), SCRIPT_ABBR(Phag), SCRIPT_ABBR(Phli), SCRIPT_ABBR(Phlp), SCRIPT_ABBR(Phnx), SCRIPT_ABBR(Plrd), SCRIPT_ABBR(Prti),
+            SCRIPT_ABBR(Rjng), SCRIPT_ABBR(Runr), SCRIPT_ABBR(Samr), SCRIPT_ABBR(Sarb), SCRIPT_ABBR(Saur), SCRIPT_ABBR(Sgnw), SCRIPT_ABBR(Shaw), SCRIPT_ABBR(Shrd),
+            SCRIPT_ABBR(Sidd), SCRIPT_ABBR(Sind), SCRIPT_ABBR(Sinh), SCRIPT_ABBR(Sora), SCRIPT_ABBR(Sund), SCRIPT_ABBR(Sylo), SCRIPT_ABBR(Syrc), SCRIPT_ABBR(Tagb),
+            SCRIPT_ABBR(Takr), SCRIPT_ABBR(Tale), SCRIPT_ABBR(Talu), SCRIPT_ABBR(Taml), SCRIPT_ABBR(Tavt), SCRIPT_ABBR(Telu), SCRIPT_ABBR(Tfng), SCRIPT_ABBR(Tglg),
+            SCRIPT_ABBR(Thaa), SCRIPT_ABBR(Thai), SCRIPT_ABBR(Tibt), SCRIPT_ABBR(Tirh), SCRIPT_ABBR(Ugar), SCRIPT_ABBR(Vaii), SCRIPT_ABBR(Wara), SCRIPT_ABBR(Xpeo),
+            SCRIPT_ABBR(Xsux), SCRIPT_ABBR(Yiii), SCRIPT_ABBR(Zinh), SCRIPT_ABBR(Zyyy),
+        };
+
+        #undef SCRIPT_ABBR
+
+        constexpr bool script_abbrs_in_order() noexcept {
+            for (int i = 0; i < int(std::size(script_abbrs)); ++i)
+                if (int(script_abbrs[i].id) != i)
+                    return false;
+            return true;
+        }
+
+        static_assert(std::size(script_abbrs) == script_count);
+        static_assert(script_abbrs_in_order());
+
     }
 
     U8string char_script(char32_t c) {
@@ -742,4 +929,61 @@ namespace RS::Unicorn {
         return map[abbr];
     }
 
+    Script char_script_id(char32_t c) noexcept {
+        using namespace UnicornDetail;
+        return Script(two_stage_lookup(script_id_stage1_table, script_id_stage2_table, std::min(c, last_unicode_char)));
+    }
+
+    ScriptSet char_script_extensions(char32_t c) noexcept {
+        using namespace UnicornDetail;
+        auto e = two_stage_lookup(script_extension_stage1_table, script_extension_stage2_table, std::min(c, last_unicode_char));
+        if (e == 0)
+            return ScriptSet(char_script_id(c));
+        auto offsets = script_extension_offsets_table.begin();
+        auto lists = script_extension_lists_table.begin();
+        ScriptSet set;
+        for (size_t i = offsets[e]; i < offsets[e + 1]; ++i)
+            set.insert(Script(lists[i]));
+        return set;
+    }
+
+    const char* script_abbr(Script sc) noexcept {
+        return int(sc) >= 0 && int(sc) < script_count ? script_abbrs[int(sc)].code : "";
+    }
+
+    const char* script_name(Script sc) noexcept {
+        return int(sc) >= 0 && int(sc) < script_count ? UnicornDetail::script_names_table.begin()[int(sc)] : "";
+    }
+
+    Script script_id(const U8string& abbr) noexcept {
+        return Script(UnicornDetail::table_lookup(UnicornDetail::script_codes_table, encode_script(abbr), uint8_t(0)));
+    }
+
+    Script ScriptSet::first() const noexcept {
+        for (int i = 0; i < n_words; ++i) {
+            if (words[i]) {
+                int j = 0;
+                while (! ((words[i] >> j) & 1))
+                    ++j;
+                return Script(64 * i + j);
+            }
+        }
+        return Script::Zzzz;
+    }
+
+    size_t ScriptSet::size() const noexcept {
+        size_t n = 0;
+        for (auto w: words)
+            n += ibits(w);
+        return n;
+    }
+
+    std::vector<Script> ScriptSet::list() const {
+        std::vector<Script> v;
+        for (int i = 0; i < script_count; ++i)
+            if (contains(Script(i)))
+                v.push_back(Script(i));
+        return v;
+    }
+
 }
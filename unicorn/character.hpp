@@ -6,6 +6,7 @@
 #include <cstring>
 #include <functional>
 #include <ostream>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -119,10 +120,6 @@ namespace RS::Unicorn {
     inline bool char_is_symbol(char32_t c) noexcept { return char_primary_category(c) == 'S'; }
     inline bool char_is_separator(char32_t c) noexcept { return char_primary_category(c) == 'Z'; }
 
-    std::function<bool(char32_t)> gc_predicate(GC cat);
-    std::function<bool(char32_t)> gc_predicate(const U8string& cat);
-    std::function<bool(char32_t)> gc_predicate(const char* cat);
-
     inline U8string decode_gc(GC cat) { return {char((uint16_t(cat) >> 8) & 0xff), char(uint16_t(cat) & 0xff)}; }
     constexpr GC encode_gc(char c1, char c2) noexcept { return GC(unicornDetail::encode_gc(c1, c2)); }
     constexpr GC encode_gc(const char* cat) noexcept { return cat && *cat ? encode_gc(cat[0], cat[1]) : GC(); }
@@ -130,6 +127,111 @@ namespace RS::Unicorn {
     std::vector<GC> gc_list();
     const char* gc_name(GC cat) noexcept;
 
+    namespace UnicornDetail {
+
+        // The general categories in alphabetical order; a category's index
+        // in this list is its bit number in a GcSet
+
+        constexpr const char* gc_codes = "CcCfCnCoCsLlLmLoLtLuMcMeMnNdNlNoPcPdPePfPiPoPsScSkSmSoZlZpZs";
+        constexpr int gc_count = 30;
+
+        constexpr int gc_index(GC cat) noexcept {
+            for (int i = 0; i < gc_count; ++i)
+                if (encode_gc(gc_codes[2 * i], gc_codes[2 * i + 1]) == cat)
+                    return i;
+            return -1;
+        }
+
+        uint8_t char_gc_index(char32_t c) noexcept;
+
+    }
+
+    class GcSet {
+    public:
+        constexpr GcSet() noexcept = default;
+        constexpr explicit GcSet(GC cat) noexcept: bits(bit(cat)) {}
+        constexpr explicit GcSet(const char* cat) noexcept: bits(parse(cat, length(cat))) {}
+        explicit GcSet(const U8string& cat) noexcept: bits(parse(cat.data(), cat.size())) {}
+        bool operator()(char32_t c) const noexcept { return (bits >> UnicornDetail::char_gc_index(c)) & 1; }
+        constexpr bool contains(GC cat) const noexcept { return (bits & bit(cat)) != 0; }
+        constexpr bool empty() const noexcept { return bits == 0; }
+        constexpr uint32_t mask() const noexcept { return bits; }
+        constexpr GcSet operator~() const noexcept { return from_mask(~ bits & all_bits); }
+        constexpr GcSet& operator&=(GcSet rhs) noexcept { bits &= rhs.bits; return *this; }
+        constexpr GcSet& operator|=(GcSet rhs) noexcept { bits |= rhs.bits; return *this; }
+        friend constexpr GcSet operator&(GcSet lhs, GcSet rhs) noexcept { return lhs &= rhs; }
+        friend constexpr GcSet operator|(GcSet lhs, GcSet rhs) noexcept { return lhs |= rhs; }
+        friend constexpr bool operator==(GcSet lhs, GcSet rhs) noexcept { return lhs.bits == rhs.bits; }
+        friend constexpr bool operator!=(GcSet lhs, GcSet rhs) noexcept { return lhs.bits != rhs.bits; }
+    private:
+        static constexpr uint32_t all_bits = (uint32_t(1) << UnicornDetail::gc_count) - 1;
+        uint32_t bits = 0;
+        static constexpr uint32_t bit(GC cat) noexcept {
+            int i = UnicornDetail::gc_index(cat);
+            return i >= 0 ? uint32_t(1) << i : 0;
+        }
+        static constexpr GcSet from_mask(uint32_t m) noexcept { GcSet s; s.bits = m; return s; }
+        static constexpr size_t length(const char* cat) noexcept {
+            size_t n = 0;
+            if (cat)
+                while (cat[n])
+                    ++n;
+            return n;
+        }
+        static constexpr uint32_t parse(const char* cat, size_t n) noexcept;
+    };
+
+    // Each comma (or other non-letter) separated group is a primary category
+    // letter, followed by any number of secondary letters; a group with no
+    // secondary letters stands for the whole primary category. "LC" or "L&"
+    // is the set of cased letters (Ll, Lt, Lu), and "L&" may be followed
+    // directly by another group.
+
+    constexpr uint32_t GcSet::parse(const char* cat, size_t n) noexcept {
+        constexpr uint32_t cased = bit(GC::Ll) | bit(GC::Lt) | bit(GC::Lu);
+        auto is_alpha = [] (char c) { return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z'); };
+        auto primary_bits = [] (char p) {
+            uint32_t m = 0;
+            for (int i = 0; i < UnicornDetail::gc_count; ++i)
+                if (UnicornDetail::gc_codes[2 * i] == p)
+                    m |= uint32_t(1) << i;
+            return m;
+        };
+        uint32_t m = 0;
+        char prefix = 0;
+        bool secondary = false;
+        for (size_t i = 0; i <= n; ++i) {
+            char c = i < n ? cat[i] : 0;
+            if (is_alpha(c)) {
+                if (prefix == 0) {
+                    prefix = c >= 'a' ? char(c - 0x20) : c;
+                } else {
+                    if (prefix == 'L' && (c == 'C' || c == 'c'))
+                        m |= cased;
+                    else
+                        m |= bit(encode_gc(prefix, c >= 'a' ? c : char(c + 0x20)));
+                    secondary = true;
+                }
+            } else if (c == '&' && prefix != 0) {
+                if (prefix == 'L') {
+                    m |= cased;
+                    prefix = 0;
+                    secondary = false;
+                }
+            } else {
+                if (prefix != 0 && ! secondary)
+                    m |= primary_bits(prefix);
+                prefix = 0;
+                secondary = false;
+            }
+        }
+        return m;
+    }
+
+    constexpr GcSet gc_predicate(GC cat) noexcept { return GcSet(cat); }
+    constexpr GcSet gc_predicate(const char* cat) noexcept { return GcSet(cat); }
+    inline GcSet gc_predicate(const U8string& cat) noexcept { return GcSet(cat); }
+
     inline std::ostream& operator<<(std::ostream& o, GC cat) { return o << decode_gc(cat); }
 
     // Boolean properties
@@ -202,6 +304,8 @@ namespace RS::Unicorn {
     };
 
     U8string char_name(char32_t c, uint32_t flags = 0);
+    char32_t char_from_name(std::string_view name);
+    bool char_from_name(std::string_view name, char32_t& c) noexcept;
 
     // Decomposition properties
 
@@ -246,4 +350,50 @@ namespace RS::Unicorn {
     Strings char_script_list(char32_t c);
     U8string script_name(const U8string& abbr);
 
+    constexpr int script_count = int(Script::Zyyy) + 1;
+
+    class ScriptSet {
+    public:
+        constexpr ScriptSet() noexcept = default;
+        constexpr explicit ScriptSet(Script sc) noexcept { insert(sc); }
+        constexpr bool contains(Script sc) const noexcept { return valid(sc) && ((words[word(sc)] >> bit(sc)) & 1); }
+        constexpr bool empty() const noexcept { return (words[0] | words[1] | words[2]) == 0; }
+        constexpr void insert(Script sc) noexcept { if (valid(sc)) words[word(sc)] |= uint64_t(1) << bit(sc); }
+        constexpr void erase(Script sc) noexcept { if (valid(sc)) words[word(sc)] &= ~ (uint64_t(1) << bit(sc)); }
+        Script first() const noexcept;
+        size_t size() const noexcept;
+        std::vector<Script> list() const;
+        constexpr ScriptSet operator~() const noexcept;
+        constexpr ScriptSet& operator&=(const ScriptSet& rhs) noexcept { for (int i = 0; i < n_words; ++i) words[i] &= rhs.words[i]; return *this; }
+        constexpr ScriptSet& operator|=(const ScriptSet& rhs) noexcept { for (int i = 0; i < n_words; ++i) words[i] |= rhs.words[i]; return *this; }
+        friend constexpr ScriptSet operator&(ScriptSet lhs, const ScriptSet& rhs) noexcept { return lhs &= rhs; }
+        friend constexpr ScriptSet operator|(ScriptSet lhs, const ScriptSet& rhs) noexcept { return lhs |= rhs; }
+        friend constexpr bool operator==(const ScriptSet& lhs, const ScriptSet& rhs) noexcept
+            { return lhs.words[0] == rhs.words[0] && lhs.words[1] == rhs.words[1] && lhs.words[2] == rhs.words[2]; }
+        friend constexpr bool operator!=(const ScriptSet& lhs, const ScriptSet& rhs) noexcept { return ! (lhs == rhs); }
+    private:
+        static constexpr int n_words = (script_count + 63) / 64;
+        static_assert(n_words == 3);
+        uint64_t words[n_words] = {};
+        static constexpr bool valid(Script sc) noexcept { return int(sc) >= 0 && int(sc) < script_count; }
+        static constexpr int word(Script sc) noexcept { return int(sc) >> 6; }
+        static constexpr int bit(Script sc) noexcept { return int(sc) & 63; }
+    };
+
+    constexpr ScriptSet ScriptSet::operator~() const noexcept {
+        ScriptSet s;
+        for (int i = 0; i < n_words; ++i) {
+            int n = script_count - 64 * i;
+            uint64_t mask = n >= 64 ? ~ uint64_t(0) : (uint64_t(1) << n) - 1;
+            s.words[i] = ~ words[i] & mask;
+        }
+        return s;
+    }
+
+    Script char_script_id(char32_t c) noexcept;
+    ScriptSet char_script_extensions(char32_t c) noexcept;
+    const char* script_abbr(Script sc) noexcept;
+    const char* script_name(Script sc) noexcept;
+    Script script_id(const U8string& abbr) noexcept;
+
 }
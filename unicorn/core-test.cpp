@@ -1,7 +1,11 @@
 #include "unicorn/core.hpp"
+#include "unicorn/character.hpp"
+#include "unicorn/normal.hpp"
 #include "rs-core/unit-test.hpp"
 #include <iostream>
 #include <string>
+#include <string_view>
+#include <thread>
 
 using namespace RS;
 using namespace RS::Unicorn;
@@ -35,11 +39,87 @@ namespace {
 
     }
 
+    void check_instrumentation() {
+
+        using UnicornDetail::add_stat;
+
+        Stats s1, s2, diff;
+
+        TEST_EQUAL(cstr(Stats::name(Stat::recode_calls)), "recode_calls");
+        TEST_EQUAL(cstr(Stats::name(Stat::normalize_fast_path)), "normalize_fast_path");
+        TEST_EQUAL(cstr(Stats::name(Stat::allocations)), "allocations");
+        TEST_EQUAL(s1[Stat::table_lookups], 0);
+        TEST_MATCH(s1.str(), "^recode_calls 0\n(.*\n)*allocations 0\n$");
+
+        TRY(s1 = stats());
+        TRY(add_stat(Stat::regex_matches, 5));
+        TRY(add_stat(Stat::file_bytes_read, 100));
+        TRY(s2 = stats());
+        TRY(diff = s2 - s1);
+        TEST_EQUAL(diff[Stat::regex_matches], 5);
+        TEST_EQUAL(diff[Stat::file_bytes_read], 100);
+        TEST_EQUAL(diff[Stat::file_lines_read], 0);
+
+        TRY(s1 = stats());
+        std::thread t([] {
+            add_stat(Stat::regex_matches, 3);
+            add_stat(Stat::regex_matches, 4);
+        });
+        t.join();
+        TRY(s2 = stats());
+        TEST_EQUAL((s2 - s1)[Stat::regex_matches], 7);
+
+        TRY(s1 = stats());
+        TEST(char_general_category(U'A') == GC::Lu);
+        TEST_EQUAL(normalize("Hello"s, NFC), "Hello");
+        TEST_EQUAL(normalize("Hello \u00e9"s, NFD), "Hello e\u0301");
+        TRY(s2 = stats());
+        TRY(diff = s2 - s1);
+        if (stats_enabled()) {
+            TEST_COMPARE(diff[Stat::table_lookups], >, 0);
+            TEST_EQUAL(diff[Stat::normalize_calls], 2);
+            TEST_EQUAL(diff[Stat::normalize_bytes], 13);
+            TEST_EQUAL(diff[Stat::normalize_fast_path], 1);
+        } else {
+            TEST_EQUAL(diff[Stat::table_lookups], 0);
+            TEST_EQUAL(diff[Stat::normalize_calls], 0);
+        }
+
+    }
+
+    void check_memory_arenas() {
+
+        Arena arena(1024);
+
+        {
+            PmrString s = arena.str("Hello world");
+            TEST_EQUAL(U8string(s), "Hello world");
+            TEST(s.get_allocator().resource() == arena.resource());
+            TEST(arena.allocator().resource() == arena.resource());
+            PmrStrings v = arena.strings();
+            TEST(v.get_allocator().resource() == arena.resource());
+            auto out = string_inserter(v);
+            TRY(*out++ = "Hello"sv);
+            TRY(*out++ = "world"s);
+            TEST_EQUAL(v.size(), 2);
+            TEST_EQUAL(U8string(v[0]), "Hello");
+            TEST_EQUAL(U8string(v[1]), "world");
+            TEST(v[1].get_allocator().resource() == arena.resource());
+        }
+
+        TRY(arena.release());
+        PmrString s = arena.str("Goodbye");
+        TEST_EQUAL(U8string(s), "Goodbye");
+
+    }
+
 }
 
 TEST_MODULE(unicorn, core) {
 
     check_character_types();
     check_version_information();
+    check_instrumentation();
+    check_memory_arenas();
 
 }
@@ -1,5 +1,6 @@
 #include "unicorn/core.hpp"
 #include "unicorn/ucd-tables.hpp"
+#include <mutex>
 
 using namespace std::literals;
 
@@ -71,4 +72,141 @@ namespace RS::Unicorn {
         return v;
     }
 
+    // Instrumentation
+
+    namespace {
+
+        // Counter blocks are linked into a list while their threads are
+        // alive; when a thread exits, its counts are folded into the
+        // retired totals. Anything counted during thread shutdown after
+        // the block has gone goes into a shared fallback block.
+
+        struct StatBlock {
+            UnicornDetail::StatCounters counts {};
+            StatBlock* prev = nullptr;
+            StatBlock* next = nullptr;
+            StatBlock();
+            ~StatBlock() noexcept;
+        };
+
+        std::mutex& stat_mutex() {
+            static std::mutex m;
+            return m;
+        }
+
+        StatBlock*& stat_head() {
+            static StatBlock* head = nullptr;
+            return head;
+        }
+
+        std::array<uint64_t, stat_count>& retired_stats() {
+            static std::array<uint64_t, stat_count> retired {};
+            return retired;
+        }
+
+        UnicornDetail::StatCounters& orphan_stats() {
+            static UnicornDetail::StatCounters orphans {};
+            return orphans;
+        }
+
+        thread_local bool stat_block_gone = false;
+
+        StatBlock::StatBlock() {
+            std::lock_guard<std::mutex> lock(stat_mutex());
+            auto& head = stat_head();
+            next = head;
+            if (head)
+                head->prev = this;
+            head = this;
+        }
+
+        StatBlock::~StatBlock() noexcept {
+            std::lock_guard<std::mutex> lock(stat_mutex());
+            auto& retired = retired_stats();
+            for (size_t i = 0; i < stat_count; ++i)
+                retired[i] += counts[i].load(std::memory_order_relaxed);
+            if (prev)
+                prev->next = next;
+            else
+                stat_head() = next;
+            if (next)
+                next->prev = prev;
+            UnicornDetail::thread_stats = nullptr;
+            stat_block_gone = true;
+        }
+
+        constexpr const char* stat_names[] = {
+            "recode_calls",
+            "recode_bytes",
+            "normalize_calls",
+            "normalize_bytes",
+            "normalize_fast_path",
+            "case_calls",
+            "case_bytes",
+            "mbcs_calls",
+            "mbcs_bytes",
+            "iconv_conversions",
+            "regex_compiles",
+            "regex_jit_compiles",
+            "regex_matches",
+            "file_lines_read",
+            "file_bytes_read",
+            "table_lookups",
+            "allocations",
+        };
+
+        static_assert(std::size(stat_names) == stat_count);
+
+    }
+
+    Stats& Stats::operator-=(const Stats& rhs) noexcept {
+        for (size_t i = 0; i < stat_count; ++i)
+            counts[i] -= rhs.counts[i];
+        return *this;
+    }
+
+    U8string Stats::str() const {
+        U8string s;
+        for (size_t i = 0; i < stat_count; ++i)
+            s += U8string(stat_names[i]) + ' ' + dec(counts[i]) + '\n';
+        return s;
+    }
+
+    const char* Stats::name(Stat s) noexcept {
+        auto i = size_t(s);
+        return i < stat_count ? stat_names[i] : "";
+    }
+
+    Stats stats() {
+        Stats s;
+        std::lock_guard<std::mutex> lock(stat_mutex());
+        s.counts = retired_stats();
+        for (size_t i = 0; i < stat_count; ++i)
+            s.counts[i] += orphan_stats()[i].load(std::memory_order_relaxed);
+        for (auto block = stat_head(); block; block = block->next)
+            for (size_t i = 0; i < stat_count; ++i)
+                s.counts[i] += block->counts[i].load(std::memory_order_relaxed);
+        return s;
+    }
+
+    bool stats_enabled() noexcept {
+        #ifdef UNICORN_STATS
+            return true;
+        #else
+            return false;
+        #endif
+    }
+
+    namespace UnicornDetail {
+
+        StatCounters* register_thread_stats() {
+            if (stat_block_gone)
+                return &orphan_stats();
+            thread_local StatBlock block;
+            thread_stats = &block.counts;
+            return thread_stats;
+        }
+
+    }
+
 }
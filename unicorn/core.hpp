@@ -2,13 +2,20 @@
 
 #include "rs-core/common.hpp"
 #include "rs-core/string.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <map>
 #include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <type_traits>
+#include <vector>
 
-RS_LDLIB(unicorn pcre z);
+RS_LDLIB(unicorn pcre);
 
 namespace RS::Unicorn {
 
@@ -76,4 +83,127 @@ namespace RS::Unicorn {
     Version unicorn_version() noexcept;
     Version unicode_version() noexcept;
 
+    // Instrumentation
+
+    enum class Stat: int {
+        recode_calls,         // Calls to recode() and the UTF conversion functions built on it
+        recode_bytes,         // Input bytes converted by recode()
+        normalize_calls,      // Calls to normalize() and normalize_in()
+        normalize_bytes,      // Input bytes normalized
+        normalize_fast_path,  // Normalization calls that returned early because the input was ASCII
+        case_calls,           // Calls to the str_*case*() functions
+        case_bytes,           // Input bytes case mapped
+        mbcs_calls,           // Calls to import_string() and export_string()
+        mbcs_bytes,           // Input bytes imported or exported
+        iconv_conversions,    // Conversions passed to iconv() (or the Windows API)
+        regex_compiles,       // Regular expressions compiled
+        regex_jit_compiles,   // Regular expressions compiled to machine code by the PCRE JIT
+        regex_matches,        // Calls to the PCRE matching functions
+        file_lines_read,      // Lines returned by FileReader
+        file_bytes_read,      // Bytes read from files by FileReader
+        table_lookups,        // Lookups in the Unicode property tables
+        allocations,          // Result buffers allocated or grown by the functions above
+    };
+
+    constexpr size_t stat_count = size_t(Stat::allocations) + 1;
+
+    class Stats {
+    public:
+        uint64_t operator[](Stat s) const noexcept { return counts[size_t(s)]; }
+        Stats& operator-=(const Stats& rhs) noexcept;
+        U8string str() const;
+        static const char* name(Stat s) noexcept;
+        friend Stats operator-(const Stats& lhs, const Stats& rhs) noexcept { auto s = lhs; s -= rhs; return s; }
+    private:
+        friend Stats stats();
+        std::array<uint64_t, stat_count> counts {};
+    };
+
+    Stats stats();
+    bool stats_enabled() noexcept;
+
+    namespace UnicornDetail {
+
+        // Each thread increments its own block of counters, so the only cost
+        // of a count is a non-locked add; stats() locks the list of blocks
+        // only while adding them up
+
+        using StatCounters = std::array<std::atomic<uint64_t>, stat_count>;
+
+        inline thread_local StatCounters* thread_stats = nullptr;
+
+        StatCounters* register_thread_stats();
+
+        inline void add_stat(Stat s, uint64_t n) noexcept {
+            auto block = thread_stats ? thread_stats : register_thread_stats();
+            auto& count = (*block)[size_t(s)];
+            count.store(count.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+        }
+
+        // Counts an allocation if the string's buffer has grown by the time
+        // the guard goes out of scope
+
+        template <typename S>
+        class BufferStat {
+        public:
+            explicit BufferStat(const S& s) noexcept: str(s), cap(s.capacity()) {}
+            ~BufferStat() noexcept { if (str.capacity() > cap) add_stat(Stat::allocations, 1); }
+            BufferStat(const BufferStat&) = delete;
+            BufferStat& operator=(const BufferStat&) = delete;
+        private:
+            const S& str;
+            size_t cap;
+        };
+
+    }
+
+    #ifdef UNICORN_STATS
+        #define UNICORN_STAT(stat, n) ::RS::Unicorn::UnicornDetail::add_stat(::RS::Unicorn::Stat::stat, (n))
+        #define UNICORN_STAT_BUFFER(str) ::RS::Unicorn::UnicornDetail::BufferStat<std::decay_t<decltype(str)>> unicorn_stat_buffer_(str)
+    #else
+        #define UNICORN_STAT(stat, n) ((void)0)
+        #define UNICORN_STAT_BUFFER(str) ((void)0)
+    #endif
+
+    // Memory arenas
+
+    using PmrString = std::pmr::string;
+    using PmrStrings = std::pmr::vector<std::pmr::string>;
+
+    class Arena {
+    public:
+        Arena() = default;
+        explicit Arena(size_t initial): mbr(std::max(initial, size_t(1))) {}
+        Arena(size_t initial, std::pmr::memory_resource* upstream): mbr(std::max(initial, size_t(1)), upstream) {}
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+        std::pmr::memory_resource* resource() noexcept { return &mbr; }
+        std::pmr::polymorphic_allocator<char> allocator() noexcept { return &mbr; }
+        PmrString str(std::string_view s = {}) { return PmrString(s, &mbr); }
+        PmrStrings strings() { return PmrStrings(&mbr); }
+        void release() noexcept { mbr.release(); }
+    private:
+        std::pmr::monotonic_buffer_resource mbr;
+    };
+
+    // Output iterator that constructs strings in place at the end of a
+    // container, so a container with an allocator-aware string type can
+    // accept substrings without any temporary copy
+
+    template <typename Container>
+    class StringInserter:
+    public OutputIterator<StringInserter<Container>> {
+    public:
+        StringInserter() noexcept {}
+        explicit StringInserter(Container& c) noexcept: con(&c) {}
+        StringInserter& operator=(std::string_view s) { con->emplace_back(s); return *this; }
+    private:
+        Container* con = nullptr;
+    };
+
+    template <typename Container>
+    StringInserter<Container> string_inserter(Container& c) noexcept {
+        return StringInserter<Container>(c);
+    }
+
 }
@@ -98,6 +98,13 @@ namespace {
         TEST_EQUAL(format_str(8888, "r"), "MMMMMMMMDCCCLXXXVIII");
         TEST_EQUAL(format_str(9999, "r"), "MMMMMMMMMCMXCIX");
 
+        TEST_EQUAL(format_str(7), "7");
+        TEST_EQUAL(format_str(1234567890123456789ull), "1234567890123456789");
+        TEST_EQUAL(format_str(-9223372036854775807ll), "-9223372036854775807");
+        TEST_EQUAL(format_str(18446744073709551615ull, "x"), "ffffffffffffffff");
+        TEST_EQUAL(format_str(12345, "n8"), "00012345");
+        TEST_EQUAL(format_str(int8_t(-100)), "-100");
+
     }
 
     void check_floating_point_formatting() {
@@ -109,6 +116,7 @@ namespace {
         // s, sign     = Always show a sign
         // i, signz    = Always show a sign unless zero
         // z, stripz   = Strip trailing zeros
+        // R, roundtrip = Shortest round trip form
 
         TEST_EQUAL(format_str(0.0, "d"), "0.00000");
         TEST_EQUAL(format_str(123.0, "d"), "123.000");
@@ -296,6 +304,18 @@ namespace {
         TEST_EQUAL(format_str(42.0, "Sg3"), "+42.0");
         TEST_EQUAL(format_str(-42.0, "Sg3"), "-42.0");
 
+        TEST_EQUAL(format_str(0.0, "R"), "0");
+        TEST_EQUAL(format_str(123.0, "R"), "123");
+        TEST_EQUAL(format_str(-123.0, "R"), "-123");
+        TEST_EQUAL(format_str(0.1, "R"), "0.1");
+        TEST_EQUAL(format_str(0.1 + 0.2, "R"), "0.30000000000000004");
+        TEST_EQUAL(format_str(1.5e-7, "R"), "1.5e-7");
+        TEST_EQUAL(format_str(1e20, "R"), "1e20");
+        TEST_EQUAL(format_str(42.5, "sR"), "+42.5");
+        TEST_EQUAL(format_str(1.0 / 3.0, "R"), "0.3333333333333333");
+        TEST_EQUAL(format_str(1.25e300, "f0").size(), 301u);
+        TEST_THROW(format_str(1.0, "dR"), std::invalid_argument);
+
     }
 
     void check_character_formatting() {
@@ -652,6 +672,26 @@ namespace {
         TEST_EQUAL(Format("Hello $1")(U"world"), "Hello world");
         TEST_EQUAL(Format("Hello $1")(L"world"), "Hello world");
 
+        Format f;
+        U8string s;
+        std::vector<char> v;
+
+        TRY(f = Format("[$1 ${2<4}] ${1U} ${3q}"));
+        TRY(f.format_to(s, "abc"s, 42, "xyz"s));
+        TEST_EQUAL(s, "[abc 42  ] ABC \"xyz\"");
+        TRY(f.format_to(s, "def"s, 86, "uvw"s));
+        TEST_EQUAL(s, "[abc 42  ] ABC \"xyz\"[def 86  ] DEF \"uvw\"");
+        TRY(f.format_to(std::back_inserter(v), "abc"s, 42, "xyz"s));
+        TEST_EQUAL(U8string(v.begin(), v.end()), "[abc 42  ] ABC \"xyz\"");
+
+        Arena arena;
+        PmrString p = arena.str();
+        TRY(f.format_to(p, "abc"s, 42, "xyz"s));
+        TEST_EQUAL(U8string(p), "[abc 42  ] ABC \"xyz\"");
+        TRY(Format("${1>*5}|$2").format_to(p, 42, u8"αβγ"s));
+        TEST_EQUAL(U8string(p), u8"[abc 42  ] ABC \"xyz\"***42|αβγ");
+        TEST(p.get_allocator().resource() == arena.resource());
+
     }
 
     void check_formatter_literals() {
@@ -1,7 +1,9 @@
 #include "unicorn/format.hpp"
-#include "unicorn/regex.hpp"
+#include <charconv>
 #include <cmath>
 #include <cstdio>
+#include <cstdlib>
+#include <limits>
 
 using namespace RS::Unicorn::Literals;
 using namespace std::chrono;
@@ -15,31 +17,128 @@ namespace RS::Unicorn {
 
             // These will always be called with x>=0 and prec>=0
 
-            U8string float_print(const char* format, long double x, int prec) {
-                std::vector<char> buf(32);
-                for (;;) {
-                    if (snprintf(buf.data(), buf.size(), format, prec, x) < int(buf.size()))
-                        return buf.data();
-                    buf.resize(2 * buf.size());
+            // Mode is e, f, or g as in printf(); prec < 0 asks for the
+            // shortest form that reads back as the same value. Values that
+            // are exactly representable as a double go through to_chars()
+            // where it is available, which gives the same digits as printf()
+            // without going through the C library's long double path.
+
+            U8string float_print(char mode, long double x, int prec) {
+                #ifdef __cpp_lib_to_chars
+                    auto d = static_cast<double>(x);
+                    if (static_cast<long double>(d) == x) {
+                        char buf[64];
+                        auto cf = mode == 'e' ? std::chars_format::scientific : mode == 'f' ? std::chars_format::fixed : std::chars_format::general;
+                        auto rc = prec < 0 ? std::to_chars(buf, buf + sizeof(buf), d) : std::to_chars(buf, buf + sizeof(buf), d, cf, prec);
+                        if (rc.ec == std::errc())
+                            return U8string(buf, rc.ptr);
+                    }
+                #endif
+                if (prec < 0) {
+                    bool dbl = static_cast<long double>(static_cast<double>(x)) == x;
+                    int min_digits = dbl ? std::numeric_limits<double>::digits10 : std::numeric_limits<long double>::digits10;
+                    int max_digits = dbl ? std::numeric_limits<double>::max_digits10 : std::numeric_limits<long double>::max_digits10;
+                    for (int p = min_digits; p < max_digits; ++p) {
+                        auto s = float_print('g', x, p);
+                        if (dbl ? std::strtod(s.data(), nullptr) == static_cast<double>(x) : std::strtold(s.data(), nullptr) == x)
+                            return s;
+                    }
+                    return float_print('g', x, max_digits);
                 }
+                const char* format = mode == 'e' ? "%.*Le" : mode == 'f' ? "%.*Lf" : "%.*Lg";
+                char buf[64];
+                int n = snprintf(buf, sizeof(buf), format, prec, x);
+                if (n < int(sizeof(buf)))
+                    return U8string(buf, n);
+                std::vector<char> big(n + 1);
+                snprintf(big.data(), big.size(), format, prec, x);
+                return U8string(big.data(), n);
             }
 
-            void float_strip(U8string& str) {
-                static const Regex pattern("(.*)(\\.(?:\\d*[1-9])?)(0+)(e.*)?");
-                auto match = pattern.match(str);
-                if (match) {
-                    U8string result = match[1];
-                    if (match.count(2) != 1)
-                        result += match[2];
-                    result += match[4];
-                    str.swap(result);
+            // Reduce the exponent to its minimal form (1.5e+07 => 1.5e7)
+
+            void float_exponent(U8string& str) {
+                auto epos = str.find_first_of("Ee");
+                if (epos == npos)
+                    return;
+                size_t i = epos + 1;
+                str[epos] = 'e';
+                if (i < str.size() && str[i] == '-')
+                    ++i;
+                auto digits = str.find_first_not_of("+0", i);
+                if (digits == npos) {
+                    str.resize(epos + 1);
+                    str += '0';
+                } else {
+                    str.erase(i, digits - i);
+                }
+            }
+
+            void check_align_flags(uint64_t flags) {
+                if (ibits(flags & (Format::left | Format::centre | Format::right)) > 1)
+                    throw std::invalid_argument("Inconsistent formatting alignment flags");
+                if (ibits(flags & (Format::lower | Format::title | Format::upper)) > 1)
+                    throw std::invalid_argument("Inconsistent formatting case conversion flags");
+            }
+
+            void convert_case(U8string& str, uint64_t flags) {
+                if (flags & Format::lower)
+                    str_lowercase_in(str);
+                else if (flags & Format::title)
+                    str_titlecase_in(str);
+                else if (flags & Format::upper)
+                    str_uppercase_in(str);
+            }
+
+            // The destination may be a U8string or a PmrString
+
+            template <typename S>
+            void append_aligned(S& dst, const U8string& src, uint64_t flags, size_t width, char32_t pad) {
+                size_t len = width == 0 ? 0 : str_length(src, flags & format_length_flags);
+                if (width <= len) {
+                    dst += src;
+                    return;
                 }
+                size_t extra = width - len, before = 0, after = 0;
+                if (flags & Format::right)
+                    before = extra;
+                else if (flags & Format::centre)
+                    before = extra / 2;
+                if (flags & Format::left)
+                    after = extra;
+                else if (flags & Format::centre)
+                    after = (extra + 1) / 2;
+                auto padding = str_char(pad);
+                for (size_t i = 0; i < before; ++i)
+                    dst += padding;
+                dst += src;
+                for (size_t i = 0; i < after; ++i)
+                    dst += padding;
+            }
+
+            void float_strip(U8string& str) {
+                // Remove trailing zeros after the point, and the point too if
+                // nothing is left after it
+                auto dot = str.find('.');
+                if (dot == npos)
+                    return;
+                auto end = str.find('e', dot);
+                if (end == npos)
+                    end = str.size();
+                auto last = str.find_last_not_of('0', end - 1);
+                if (last == end - 1)
+                    return;
+                if (last == dot)
+                    --last;
+                str.erase(last + 1, end - last - 1);
             }
 
             U8string float_digits(long double x, int prec) {
                 prec = std::max(prec, 1);
-                auto result = float_print("%.*Le", x, prec - 1);
+                auto result = float_print('e', x, prec - 1);
                 auto epos = result.find_first_of("Ee");
+                if (epos == npos)
+                    return result;
                 auto exponent = strtol(result.data() + epos + 1, nullptr, 10);
                 result.resize(epos);
                 if (exponent < 0) {
@@ -60,28 +159,19 @@ namespace RS::Unicorn {
 
             U8string float_exp(long double x, int prec) {
                 prec = std::max(prec, 1);
-                auto result = float_print("%.*Le", x, prec - 1);
-                auto epos = result.find_first_of("Ee");
-                char esign = 0;
-                if (result[epos + 1] == '-')
-                    esign = '-';
-                auto epos2 = result.find_first_not_of("+-0", epos + 1);
-                U8string exponent;
-                if (epos2 < result.size())
-                    exponent = result.substr(epos2);
-                result.resize(epos);
-                result += 'e';
-                if (esign)
-                    result += esign;
-                if (exponent.empty())
-                    result += '0';
-                else
-                    result += exponent;
+                auto result = float_print('e', x, prec - 1);
+                float_exponent(result);
                 return result;
             }
 
             U8string float_fixed(long double x, int prec) {
-                return float_print("%.*Lf", x, prec);
+                return float_print('f', x, prec);
+            }
+
+            U8string float_shortest(long double x) {
+                auto result = float_print('g', x, -1);
+                float_exponent(result);
+                return result;
             }
 
             U8string float_general(long double x, int prec) {
@@ -190,7 +280,7 @@ namespace RS::Unicorn {
 
         U8string format_float(long double t, uint64_t flags, int prec) {
             using std::fabs;
-            static constexpr auto format_flags = Format::digits | Format::exp | Format::fixed | Format::general;
+            static constexpr auto format_flags = Format::digits | Format::exp | Format::fixed | Format::general | Format::roundtrip;
             static constexpr auto sign_flags = Format::sign | Format::signz;
             if (ibits(flags & format_flags) > 1 || ibits(flags & sign_flags) > 1)
                 throw std::invalid_argument("Inconsistent formatting flags");
@@ -204,6 +294,8 @@ namespace RS::Unicorn {
                 s = float_exp(mag, prec);
             else if (flags & Format::fixed)
                 s = float_fixed(mag, prec);
+            else if (flags & Format::roundtrip)
+                s = float_shortest(mag);
             else
                 s = float_general(mag, prec);
             if (flags & Format::stripz)
@@ -216,33 +308,35 @@ namespace RS::Unicorn {
         // Alignment and padding
 
         U8string format_align(U8string src, uint64_t flags, size_t width, char32_t pad) {
-            if (ibits(flags & (Format::left | Format::centre | Format::right)) > 1)
-                throw std::invalid_argument("Inconsistent formatting alignment flags");
-            if (ibits(flags & (Format::lower | Format::title | Format::upper)) > 1)
-                throw std::invalid_argument("Inconsistent formatting case conversion flags");
-            if (flags & Format::lower)
-                str_lowercase_in(src);
-            else if (flags & Format::title)
-                str_titlecase_in(src);
-            else if (flags & Format::upper)
-                str_uppercase_in(src);
-            size_t len = str_length(src, flags & format_length_flags);
-            if (width <= len)
+            check_align_flags(flags);
+            convert_case(src, flags);
+            if (width == 0 || width <= str_length(src, flags & format_length_flags))
                 return src;
-            size_t extra = width - len;
             U8string dst;
-            if (flags & Format::right)
-                str_append_chars(dst, extra, pad);
-            else if (flags & Format::centre)
-                str_append_chars(dst, extra / 2, pad);
-            dst += src;
-            if (flags & Format::left)
-                str_append_chars(dst, extra, pad);
-            else if (flags & Format::centre)
-                str_append_chars(dst, (extra + 1) / 2, pad);
+            append_aligned(dst, src, flags, width, pad);
             return dst;
         }
 
+        template <typename S>
+        void format_align_to_helper(S& dst, const U8string& src, uint64_t flags, size_t width, char32_t pad) {
+            check_align_flags(flags);
+            if (flags & (Format::lower | Format::title | Format::upper)) {
+                U8string str = src;
+                convert_case(str, flags);
+                append_aligned(dst, str, flags, width, pad);
+            } else {
+                append_aligned(dst, src, flags, width, pad);
+            }
+        }
+
+        void format_align_to(U8string& dst, const U8string& src, uint64_t flags, size_t width, char32_t pad) {
+            format_align_to_helper(dst, src, flags, width, pad);
+        }
+
+        void format_align_to(PmrString& dst, const U8string& src, uint64_t flags, size_t width, char32_t pad) {
+            format_align_to_helper(dst, src, flags, width, pad);
+        }
+
     }
 
     // Basic formattng functions
@@ -261,8 +355,7 @@ namespace RS::Unicorn {
 
     U8string format_type(const U8string& t, uint64_t flags, int prec) {
         using namespace UnicornDetail;
-        static constexpr auto format_flags = Format::ascii | Format::ascquote | Format::escape | Format::decimal | Format::hex | Format::hex8 | Format::hex16 | Format::quote;
-        if (ibits(flags & format_flags) > 1)
+        if (ibits(flags & string_format_flags) > 1)
             throw std::invalid_argument("Inconsistent formatting flags");
         if (flags & Format::quote)
             return string_escape(t, Format::quote);
@@ -345,12 +438,14 @@ namespace RS::Unicorn {
         elem.index = index;
         translate_flags(to_utf8(flags), elem.flags, elem.prec, elem.width, elem.pad);
         seq.push_back(elem);
+        est += std::max(elem.width, size_t(8));
         if (index > 0 && index > num)
             num = index;
     }
 
     void Format::add_literal(const U8string& text) {
         if (! text.empty()) {
+            est += text.size();
             if (seq.empty() || seq.back().index != 0)
                 seq.push_back({0, text, 0, 0, 0, 0});
             else
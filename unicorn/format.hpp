@@ -8,7 +8,9 @@
 #include "rs-core/uuid.hpp"
 #include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <iterator>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -18,6 +20,16 @@
 
 namespace RS::Unicorn {
 
+    namespace UnicornDetail {
+
+        // String types that Format::format_to() can append to
+
+        template <typename S> struct IsFormatString: std::false_type {};
+        template <> struct IsFormatString<U8string>: std::true_type {};
+        template <> struct IsFormatString<PmrString>: std::true_type {};
+
+    }
+
     // Formatter class
 
     // (Defined early so we can use the member constants)
@@ -45,6 +57,7 @@ namespace RS::Unicorn {
         static constexpr uint64_t fixed     = letter_to_mask('f');  // Fixed point notation            --   --    --   float  --    --      --
         static constexpr uint64_t general   = letter_to_mask('g');  // Use the shorter of d or e       --   --    --   float  --    --      --
         static constexpr uint64_t stripz    = letter_to_mask('z');  // Strip trailing zeros            --   --    --   float  --    --      --
+        static constexpr uint64_t roundtrip = letter_to_mask('R');  // Shortest round trip form        --   --    --   float  --    --      --
         static constexpr uint64_t escape    = letter_to_mask('e');  // Escape if C0/C1 control         --   --    --   --     char  string  --
         static constexpr uint64_t ascii     = letter_to_mask('a');  // Escape if not printable ASCII   --   --    --   --     char  string  --
         static constexpr uint64_t quote     = letter_to_mask('q');  // Quote string, escape C0/C1      --   --    --   --     char  string  --
@@ -58,6 +71,10 @@ namespace RS::Unicorn {
         Format() = default;
         explicit Format(const U8string& format);
         template <typename... Args> U8string operator()(const Args&... args) const;
+        template <typename S, typename... Args> std::enable_if_t<UnicornDetail::IsFormatString<S>::value>
+            format_to(S& out, const Args&... args) const;
+        template <typename OutIter, typename... Args> std::enable_if_t<! UnicornDetail::IsFormatString<OutIter>::value, OutIter>
+            format_to(OutIter out, const Args&... args) const;
         bool empty() const noexcept { return fmt.empty(); }
         size_t fields() const { return num; }
         U8string format() const { return fmt; }
@@ -75,11 +92,12 @@ namespace RS::Unicorn {
         using sequence = std::vector<element>;
         U8string fmt;
         size_t num = 0;
+        size_t est = 0;  // Estimated output size (literal text plus a guess for each field)
         sequence seq;
         void add_index(unsigned index, const U8string& flags = {});
         void add_literal(const U8string& text);
-        void apply_format(Strings&, int) const {}
-        template <typename T, typename... Args> void apply_format(Strings& list, int index, const T& t, const Args&... args) const;
+        template <typename S> void format_field(S&, const element&, int) const {}
+        template <typename S, typename T, typename... Args> void format_field(S& out, const element& elem, int index, const T& t, const Args&... args) const;
 
     };
 
@@ -90,30 +108,55 @@ namespace RS::Unicorn {
         constexpr uint64_t format_length_flags = Length::characters | Length::graphemes | Length::narrow | Length::wide;
         constexpr uint64_t top_level_format_flags = format_length_flags | Format::left | Format::centre | Format::right | Format::lower | Format::title | Format::upper;
         constexpr uint64_t global_format_flags = format_length_flags | top_level_format_flags;
+        constexpr uint64_t string_format_flags = Format::ascii | Format::ascquote | Format::escape | Format::decimal | Format::hex | Format::hex8 | Format::hex16 | Format::quote;
 
         // Formatting for specific types
 
         void translate_flags(const U8string& str, uint64_t& flags, int& prec, size_t& width, char32_t& pad);
         U8string format_float(long double t, uint64_t flags, int prec);
 
+        constexpr const char* decimal_digit_pairs =
+            "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+            "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+            "8081828384858687888990919293949596979899";
+
         template <typename T>
         U8string format_radix(T t, int base, int prec) {
             // Argument will never be negative
-            U8string s;
+            // Digits are generated backwards into a local buffer, two at a time for decimal
+            char buf[std::numeric_limits<T>::digits + 1];
+            char* end = buf + sizeof(buf);
+            char* ptr = end;
             auto b = static_cast<T>(base);
-            prec = std::max(prec, 1);
-            while (t > 0 || int(s.size()) < prec) {
-                auto d = t % b;
-                s += char(d + (d <= 9 ? '0' : 'a' - 10));
-                t /= b;
+            if (base == 10) {
+                for (; t >= 100; t /= 100) {
+                    ptr -= 2;
+                    std::memcpy(ptr, decimal_digit_pairs + 2 * size_t(t % 100), 2);
+                }
+                if (t >= 10) {
+                    ptr -= 2;
+                    std::memcpy(ptr, decimal_digit_pairs + 2 * size_t(t), 2);
+                } else if (t > 0) {
+                    *--ptr = char('0' + t);
+                }
+            } else {
+                for (; t > 0; t /= b) {
+                    auto d = t % b;
+                    *--ptr = char(d + (d <= 9 ? '0' : 'a' - 10));
+                }
             }
-            std::reverse(s.begin(), s.end());
+            auto n = int(end - ptr);
+            prec = std::max(prec, 1);
+            U8string s;
+            if (n < prec)
+                s.assign(prec - n, '0');
+            s.append(ptr, n);
             return s;
         }
 
         template <typename T>
         U8string format_int(T t, uint64_t flags, int prec) {
-            static constexpr auto float_flags = Format::digits | Format::exp | Format::fixed | Format::general | Format::stripz;
+            static constexpr auto float_flags = Format::digits | Format::exp | Format::fixed | Format::general | Format::roundtrip | Format::stripz;
             static constexpr auto int_flags = Format::binary | Format::decimal | Format::hex | Format::roman;
             static constexpr auto sign_flags = Format::sign | Format::signz;
             if ((flags & float_flags) && ! (flags & int_flags))
@@ -148,6 +191,8 @@ namespace RS::Unicorn {
         // Alignment and padding
 
         U8string format_align(U8string src, uint64_t flags, size_t width, char32_t pad);
+        void format_align_to(U8string& dst, const U8string& src, uint64_t flags, size_t width, char32_t pad);
+        void format_align_to(PmrString& dst, const U8string& src, uint64_t flags, size_t width, char32_t pad);
 
     }
 
@@ -221,6 +266,31 @@ namespace RS::Unicorn {
         return UnicornDetail::FormatObject<std::decay_t<T>>()(t, flags, prec);
     }
 
+    namespace UnicornDetail {
+
+        template <typename T>
+        struct FormatField {
+            template <typename S>
+            void operator()(S& dst, const T& t, uint64_t flags, int prec, size_t width, char32_t pad) const {
+                format_align_to(dst, format_type(t, flags, prec), flags & global_format_flags, width, pad);
+            }
+        };
+
+        // Strings with no type specific flags need no intermediate copy
+
+        template <>
+        struct FormatField<U8string> {
+            template <typename S>
+            void operator()(S& dst, const U8string& t, uint64_t flags, int prec, size_t width, char32_t pad) const {
+                if (flags & string_format_flags)
+                    format_align_to(dst, format_type(t, flags, prec), flags & global_format_flags, width, pad);
+                else
+                    format_align_to(dst, t, flags & global_format_flags, width, pad);
+            }
+        };
+
+    }
+
     template <typename T>
     U8string format_str(const T& t, uint64_t flags = 0, int prec = -1, size_t width = 0, char32_t pad = U' ') {
         using namespace UnicornDetail;
@@ -248,24 +318,45 @@ namespace RS::Unicorn {
 
     template <typename... Args>
     U8string Format::operator()(const Args&... args) const {
-        Strings list(seq.size());
-        for (size_t i = 0; i < seq.size(); ++i)
-            if (seq[i].index == 0)
-                list[i] = seq[i].text;
-        apply_format(list, 1, args...);
-        return str_join(list, U8string());
+        U8string s;
+        format_to(s, args...);
+        return s;
     }
 
-    template <typename T, typename... Args>
-    void Format::apply_format(Strings& list, int index, const T& t, const Args&... args) const {
-        using namespace UnicornDetail;
-        for (size_t i = 0; i < seq.size(); ++i) {
-            if (seq[i].index == index) {
-                auto s = format_type(t, seq[i].flags, seq[i].prec);
-                list[i] = format_align(s, seq[i].flags & global_format_flags, seq[i].width, seq[i].pad);
+    template <typename S, typename... Args>
+    std::enable_if_t<UnicornDetail::IsFormatString<S>::value>
+    Format::format_to(S& out, const Args&... args) const {
+        out.reserve(out.size() + est);
+        for (auto& elem: seq) {
+            if (elem.index == 0)
+                out += elem.text;
+            else
+                format_field(out, elem, elem.index, args...);
+        }
+    }
+
+    template <typename OutIter, typename... Args>
+    std::enable_if_t<! UnicornDetail::IsFormatString<OutIter>::value, OutIter>
+    Format::format_to(OutIter out, const Args&... args) const {
+        U8string buf;
+        for (auto& elem: seq) {
+            if (elem.index == 0) {
+                out = std::copy(elem.text.begin(), elem.text.end(), out);
+            } else {
+                buf.clear();
+                format_field(buf, elem, elem.index, args...);
+                out = std::copy(buf.begin(), buf.end(), out);
             }
         }
-        apply_format(list, index + 1, args...);
+        return out;
+    }
+
+    template <typename S, typename T, typename... Args>
+    void Format::format_field(S& out, const element& elem, int index, const T& t, const Args&... args) const {
+        if (index == 1)
+            UnicornDetail::FormatField<T>()(out, t, elem.flags, elem.prec, elem.width, elem.pad);
+        else
+            format_field(out, elem, index - 1, args...);
     }
 
     // Formatter literals
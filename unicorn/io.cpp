@@ -141,6 +141,7 @@ namespace RS::Unicorn {
         import_string(encoded, impl->line8, impl->enc, impl->flags & (Utf::replace | Utf::throws));
         fixline();
         ++impl->lines;
+        UNICORN_STAT(file_lines_read, 1);
     }
 
     void FileReader::getmore(size_t n) {
@@ -151,6 +152,7 @@ namespace RS::Unicorn {
         auto rc = fread(&impl->rdbuf[offset], 1, n, impl->handle.get());
         auto err = errno;
         impl->rdbuf.resize(offset + rc);
+        UNICORN_STAT(file_bytes_read, rc);
         if (ferror(impl->handle.get()))
             throw std::system_error(err, std::generic_category(), quote_file(impl->name));
     }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "unicorn/bidi.hpp"
 #include "unicorn/character.hpp"
 #include "unicorn/core.hpp"
 #include "unicorn/environment.hpp"
@@ -273,6 +273,7 @@ namespace RS::Unicorn {
                 Iconv conv(from, to);
                 if (! conv)
                     throw UnknownEncoding(tag);
+                UNICORN_STAT(iconv_conversions, 1);
                 std::string buf(src.size(), 0);
                 size_t inpos = 0, outpos = 0;
                 while (inpos < src.size()) {
@@ -326,6 +327,7 @@ namespace RS::Unicorn {
 
             void native_import(const std::string& src, std::wstring& dst, uint32_t tag, uint32_t flags) {
                 uint32_t wflags = 0;
+                UNICORN_STAT(iconv_conversions, 1);
                 if (flags & Utf::throws)
                     wflags |= MB_ERR_INVALID_CHARS;
                 auto rc = MultiByteToWideChar(tag, wflags, src.data(), int(src.size()), nullptr, 0);
@@ -341,6 +343,7 @@ namespace RS::Unicorn {
             }
 
             void native_export(const std::wstring& src, std::string& dst, uint32_t tag, uint32_t flags) {
+                UNICORN_STAT(iconv_conversions, 1);
                 std::vector<uint32_t> tryflags;
                 if (flags & Utf::throws)
                     tryflags = {WC_NO_BEST_FIT_CHARS | WC_ERR_INVALID_CHARS, WC_ERR_INVALID_CHARS, WC_NO_BEST_FIT_CHARS, 0};
@@ -640,18 +643,30 @@ namespace RS::Unicorn {
     // Conversion functions
 
     void import_string(const std::string& src, U8string& dst, const U8string& enc, uint32_t flags) {
+        UNICORN_STAT(mbcs_calls, 1);
+        UNICORN_STAT(mbcs_bytes, src.size());
+        UNICORN_STAT_BUFFER(dst);
         import_string_helper(src, dst, to_utf8(enc), flags);
     }
 
     void import_string(const std::string& src, U8string& dst, uint32_t enc, uint32_t flags) {
+        UNICORN_STAT(mbcs_calls, 1);
+        UNICORN_STAT(mbcs_bytes, src.size());
+        UNICORN_STAT_BUFFER(dst);
         import_string_helper(src, dst, enc, flags);
     }
 
     void export_string(const U8string& src, std::string& dst, const U8string& enc, uint32_t flags) {
+        UNICORN_STAT(mbcs_calls, 1);
+        UNICORN_STAT(mbcs_bytes, src.size());
+        UNICORN_STAT_BUFFER(dst);
         export_string_helper(src, dst, to_utf8(enc), flags);
     }
 
     void export_string(const U8string& src, std::string& dst, uint32_t enc, uint32_t flags) {
+        UNICORN_STAT(mbcs_calls, 1);
+        UNICORN_STAT(mbcs_bytes, src.size());
+        UNICORN_STAT_BUFFER(dst);
         export_string_helper(src, dst, enc, flags);
     }
 
@@ -31,6 +31,21 @@ namespace {
             FAIL("Failed normalization test $1: $2 $3q => $4q"_fmt(line, form, orig, expect));
     }
 
+    void check_normalize_to() {
+
+        Arena arena;
+        U8string s = "<";
+        PmrString p = arena.str("<");
+
+        TRY(normalize_to(s, "Hello", NFC));                    TEST_EQUAL(s, "<Hello");
+        TRY(normalize_to(s, " \u00e9\u0301", NFD));             TEST_EQUAL(s, "<Hello e\u0301\u0301");
+        TRY(normalize_to(p, "Hello", NFC));                    TEST_EQUAL(U8string(p), "<Hello");
+        TRY(normalize_to(p, " e\u0301", NFC));                  TEST_EQUAL(U8string(p), "<Hello \u00e9");
+        TRY(normalize_to(p, " \ufb01", NFKD));                  TEST_EQUAL(U8string(p), "<Hello \u00e9 fi");
+        TEST(p.get_allocator().resource() == arena.resource());
+
+    }
+
 }
 
 namespace {
@@ -101,6 +116,8 @@ namespace {
 
 TEST_MODULE(unicorn, normal) {
 
+    check_normalize_to();
+
     auto norm_tests = range_count(normalization_test_table);
     std::vector<char32_t> identity_chars;
     for (auto&& row: normalization_identity_table)
@@ -26,9 +26,12 @@ compositions are possible.
 
 #include "unicorn/normal.hpp"
 #include "unicorn/character.hpp"
+#include "unicorn/string.hpp"
 #include "unicorn/utf.hpp"
 #include <algorithm>
+#include <memory>
 #include <string>
+#include <string_view>
 
 using namespace std::literals;
 
@@ -36,7 +39,14 @@ namespace RS::Unicorn {
 
     namespace {
 
-        void apply_decomposition(const U8string& src, std::u32string& dst, bool k) {
+        // ASCII text is unchanged by all four normalization forms
+
+        bool is_ascii(std::string_view src) noexcept {
+            return UnicornDetail::ascii_run(src.data(), src.size()) == src.size();
+        }
+
+        template <typename S32>
+        void apply_decomposition(std::string_view src, S32& dst, bool k) {
             auto decompose = k ? compatibility_decomposition : canonical_decomposition;
             size_t max_decompose = k ? max_compatibility_decomposition : max_canonical_decomposition;
             char32_t buf[max_decompose];
@@ -61,7 +71,8 @@ namespace RS::Unicorn {
             }
         }
 
-        void apply_ordering(std::u32string& str) {
+        template <typename S32>
+        void apply_ordering(S32& str) {
             auto i = str.begin(), j = i, e = str.end();
             while (j != e) {
                 i = std::find_if(j, e, combining_class);
@@ -73,7 +84,8 @@ namespace RS::Unicorn {
             }
         }
 
-        void apply_composition(std::u32string& str) {
+        template <typename S32>
+        void apply_composition(S32& str) {
             if (str.size() < 2)
                 return;
             auto i = str.begin(), e = str.end();
@@ -103,26 +115,61 @@ namespace RS::Unicorn {
             }
         }
 
+        template <typename S32>
+        void apply_normalization(std::string_view src, S32& utf32, NormalizationForm form) {
+            apply_decomposition(src, utf32, form == NFKC || form == NFKD);
+            apply_ordering(utf32);
+            if (form == NFC || form == NFKC)
+                apply_composition(utf32);
+        }
+
+        // The UTF-32 working buffer uses the destination string's allocator,
+        // so normalizing into a PmrString allocates only from its arena
+
+        template <typename S>
+        void normalize_helper(S& dst, std::string_view src, NormalizationForm form) {
+            using namespace UnicornDetail;
+            using allocator_type = typename std::allocator_traits<typename S::allocator_type>::template rebind_alloc<char32_t>;
+            UNICORN_STAT(normalize_calls, 1);
+            UNICORN_STAT(normalize_bytes, src.size());
+            UNICORN_STAT_BUFFER(dst);
+            if (is_ascii(src)) {
+                UNICORN_STAT(normalize_fast_path, 1);
+                dst.append(src.data(), src.size());
+                return;
+            }
+            std::basic_string<char32_t, std::char_traits<char32_t>, allocator_type> utf32(allocator_type(dst.get_allocator()));
+            apply_normalization(src, utf32, form);
+            append_utf8(dst, utf32.data(), utf32.size());
+        }
+
     }
 
     U8string normalize(const U8string& src, NormalizationForm form) {
-        using namespace UnicornDetail;
-        std::u32string utf32;
-        apply_decomposition(src, utf32, form == NFKC || form == NFKD);
-        apply_ordering(utf32);
-        if (form == NFC || form == NFKC)
-            apply_composition(utf32);
-        return to_utf8(utf32);
+        U8string dst;
+        normalize_helper(dst, src, form);
+        return dst;
     }
 
     void normalize_in(U8string& src, NormalizationForm form) {
         using namespace UnicornDetail;
+        UNICORN_STAT(normalize_calls, 1);
+        UNICORN_STAT(normalize_bytes, src.size());
+        if (is_ascii(src)) {
+            UNICORN_STAT(normalize_fast_path, 1);
+            return;
+        }
         std::u32string utf32;
-        apply_decomposition(src, utf32, form == NFKC || form == NFKD);
-        apply_ordering(utf32);
-        if (form == NFC || form == NFKC)
-            apply_composition(utf32);
+        apply_normalization(src, utf32, form);
         recode(utf32, src);
     }
 
+    void normalize_to(U8string& dst, std::string_view src, NormalizationForm form) {
+        normalize_helper(dst, src, form);
+    }
+
+    void normalize_to(PmrString& dst, std::string_view src, NormalizationForm form) {
+        normalize_helper(dst, src, form);
+    }
+
 }
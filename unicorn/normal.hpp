@@ -1,6 +1,7 @@
 #pragma once
 
 #include "unicorn/core.hpp"
+#include <string_view>
 
 namespace RS::Unicorn {
 
@@ -8,5 +9,7 @@ namespace RS::Unicorn {
 
     U8string normalize(const U8string& src, NormalizationForm form);
     void normalize_in(U8string& src, NormalizationForm form);
+    void normalize_to(U8string& dst, std::string_view src, NormalizationForm form);
+    void normalize_to(PmrString& dst, std::string_view src, NormalizationForm form);
 
 }
@@ -80,6 +80,20 @@ namespace RS::Unicorn {
         None, Decimal, Digit, Numeric
     )
 
+    RS_ENUM_CLASS(Script, int, 0,
+        Zzzz, Aghb, Ahom, Arab, Armi, Armn, Avst, Bali, Bamu, Bass, Batk, Beng,
+        Bopo, Brah, Brai, Bugi, Buhd, Cakm, Cans, Cari, Cham, Cher, Copt, Cprt,
+        Cyrl, Deva, Dsrt, Dupl, Egyp, Elba, Ethi, Geor, Glag, Goth, Gran, Grek,
+        Gujr, Guru, Hang, Hani, Hano, Hatr, Hebr, Hira, Hluw, Hmng, Hung, Ital,
+        Java, Kali, Kana, Khar, Khmr, Khoj, Knda, Kthi, Lana, Laoo, Latn, Lepc,
+        Limb, Lina, Linb, Lisu, Lyci, Lydi, Mahj, Mand, Mani, Mend, Merc, Mero,
+        Mlym, Modi, Mong, Mroo, Mtei, Mult, Mymr, Narb, Nbat, Nkoo, Ogam, Olck,
+        Orkh, Orya, Osma, Palm, Pauc, Perm, Phag, Phli, Phlp, Phnx, Plrd, Prti,
+        Rjng, Runr, Samr, Sarb, Saur, Sgnw, Shaw, Shrd, Sidd, Sind, Sinh, Sora,
+        Sund, Sylo, Syrc, Tagb, Takr, Tale, Talu, Taml, Tavt, Telu, Tfng, Tglg,
+        Thaa, Thai, Tibt, Tirh, Ugar, Vaii, Wara, Xpeo, Xsux, Yiii, Zinh, Zyyy
+    )
+
     RS_ENUM_CLASS(Sentence_Break, int, 0,
         Other, ATerm, Close, CR, EOT, Extend, Format, LF, Lower, Numeric,
         OLetter, SContinue, Sep, SOT, Sp, STerm, Upper
@@ -297,6 +297,58 @@ namespace {
 
     }
 
+    void check_view_search() {
+
+        // Searching a view must not see text outside it
+
+        const U8string buf = u8"abc Hello wörld xyz";
+        std::string_view v(buf.data() + 4, 12);
+        Regex r;
+        Match m;
+
+        TRY(r = Regex("\\w+$"));
+        TRY(m = r.search(v));
+        TEST(m.matched());
+        TEST_EQUAL(m.offset(), 6);
+        TEST_EQUAL(m.endpos(), 12);
+        TEST_EQUAL(m.str(), u8"wörld");
+        TEST_EQUAL(m.view(), u8"wörld");
+        TEST(m.view().data() == buf.data() + 10);
+        TEST_EQUAL(u_str(m.v_range()), u8"wörld");
+        TEST_EQUAL(str_length(m.v_range()), 5);
+        TEST_EQUAL(U8string(m.s_begin(), m.s_end()), "");
+        TEST_EQUAL(u_str(m.u_begin(), m.u_end()), "");
+
+        TRY(r = Regex("^(\\w+) (\\w+)"));
+        TRY(m = r(v));
+        TEST(m.matched());
+        TEST_EQUAL(m.groups(), 3);
+        TEST_EQUAL(m[1], "Hello");
+        TEST_EQUAL(m.view(2), u8"wörld");
+        TEST_EQUAL(m.first(), "Hello");
+        TEST_EQUAL(m.last(), u8"wörld");
+        TRY(m = r.search(v, 1));
+        TEST(! m.matched());
+        TRY(m = r.search(utf_iterator(v, 1)));
+        TEST(! m.matched());
+        TRY(m = r.search(std::string_view()));
+        TEST(! m.matched());
+
+        TRY(r = Regex("xyz"));
+        TRY(m = r.search(v));
+        TEST(! m.matched());
+        TRY(m = r.search("abc xyz"));
+        TEST(m.matched());
+        TEST_EQUAL(m.offset(), 4);
+
+        TRY(m = r.search(buf));
+        TEST(m.matched());
+        TEST_EQUAL(m.view(), "xyz");
+        TEST_EQUAL(u_str(m.u_range()), "xyz");
+        TEST_EQUAL(u_str(m.v_range()), "xyz");
+
+    }
+
     void check_match_ranges() {
 
         U8string s;
@@ -315,6 +367,61 @@ namespace {
 
     }
 
+    void check_parallel_search() {
+
+        U8string s;
+        Regex r;
+        std::vector<Match> v;
+        Strings s1, s2;
+        size_t n1 = 0, n2 = 0;
+
+        for (int i = 0; i < 100000; ++i)
+            s += "Line " + dec(i) + u8": αβγ hello world\n";
+
+        for (auto pattern: {"[a-z]+", "\\d+$", u8"γ\\s", "world\\nLine", "(?=o)", "^Line 9+:", "(?s).{7}", "(?<=Line )\\d+", u8"(?<=α)β", "\\bhello"}) {
+            TRY(r = Regex(pattern, Regex::multiline));
+            for (size_t threads: {1, 2, 3, 8}) {
+                TRY(v = r.grep_parallel(s, threads));
+                TRY(n1 = r.count_parallel(s, threads));
+                TRY(n2 = range_count(r.grep(s)));
+                TEST_EQUAL(v.size(), n2);
+                TEST_EQUAL(n1, n2);
+                s1.clear();
+                s2.clear();
+                for (auto& m: v)
+                    s1.push_back(dec(m.offset()) + ":" + m.str());
+                for (auto& m: r.grep(s))
+                    s2.push_back(dec(m.offset()) + ":" + m.str());
+                TEST(s1 == s2);
+            }
+        }
+
+        TRY(r = Regex("[a-z]+"));
+        TRY(v = r.grep_parallel(""));
+        TEST(v.empty());
+        TRY(v = r.grep_parallel("Hello world"));
+        TEST_EQUAL(v.size(), 2);
+        TEST_EQUAL(v[0].str(), "ello");
+        TEST_EQUAL(v[1].str(), "world");
+        TEST_EQUAL(r.count_parallel("Hello world"), 2);
+
+        // An empty match before a multibyte character restarts the search
+        // inside the character, which is reported as an error
+
+        TRY(r = Regex(u8"(?=β)"));
+        TEST_THROW(r.count(u8"αβ"), RegexError);
+        TEST_THROW(r.count_parallel(u8"αβ"), RegexError);
+        TEST_THROW(r.grep_parallel(u8"αβ"), RegexError);
+        for (size_t threads: {1, 2, 3, 8}) {
+            TEST_THROW(r.count_parallel(s, threads), RegexError);
+            TEST_THROW(r.grep_parallel(s, threads), RegexError);
+        }
+        TRY(r = Regex(u8"(?=β)", Regex::byte));
+        TEST_EQUAL(r.count(u8"αβ"), 1);
+        TEST_EQUAL(r.count_parallel(u8"αβ"), 1);
+
+    }
+
     void check_split_ranges() {
 
         U8string s;
@@ -441,6 +548,22 @@ namespace {
         s = "*** Hello world ***";  TEST_EQUAL(rf.extract(s), "(Hello:*** Hello world ***)(world:*** Hello world ***)");
         s = "*** Hello world ***";  TEST_EQUAL(rf.extract(s, 1), "(Hello:*** Hello world ***)");
 
+        U8string out = "> ";
+        TRY(rf = RegexFormat("(\\w)(\\w*)", "\\U$1\\E$2"));
+        s = "hello world";  TRY(rf.format_to(out, s));      TEST_EQUAL(out, "> Hello World");
+        s = "hello world";  TRY(rf.extract_to(out, s, 1));  TEST_EQUAL(out, "> Hello WorldHello");
+
+        Arena arena;
+        PmrString pout = arena.str("> ");
+        s = "hello world";  TRY(rf.format_to(pout, s));      TEST_EQUAL(U8string(pout), "> Hello World");
+        s = "hello world";  TRY(rf.extract_to(pout, s, 1));  TEST_EQUAL(U8string(pout), "> Hello WorldHello");
+        TRY(rf = RegexFormat("\\S+", "\\u$0-\\U$0\\E"));
+        s = u8"été";  TRY(rf.format_to(pout, s));  TEST_EQUAL(U8string(pout), u8"> Hello WorldHelloÉté-ÉTÉ");
+        TEST(pout.get_allocator().resource() == arena.resource());
+
+        TRY(rf = RegexFormat("(?<word>\\w+)", "[$word$nosuch]"));
+        s = "hello world";  TEST_EQUAL(rf.format(s), "[hello] [world]");
+
         TEST_THROW(RegexFormat("\\w", "\\x{d800}"), EncodingError);
         TEST_THROW(RegexFormat("\\w", "\\x{dfff}"), EncodingError);
         TEST_THROW(RegexFormat("\\w", "\\x{110000}"), EncodingError);
@@ -472,6 +595,36 @@ namespace {
         TRY(r.transform_in(s1, mf));
         TEST_EQUAL(s1, "Ho wd");
 
+        auto af = [] (const Match& m, U8string& out) { out += '<'; out.append(m.s_begin(), m.s_end()); out += '>'; };
+        auto cf = [] (const U8string& s) { return s.size() > 1 ? s.substr(0, 1) : s + s + s; };
+
+        s1 = "Hello world";
+        TRY(r = Regex("\\w+"));
+        TRY(s2 = r.transform(s1, af));
+        TEST_EQUAL(s2, "<Hello> <world>");
+        TRY(s2 = r.transform(s1, af, 1));
+        TEST_EQUAL(s2, "<Hello> world");
+        TRY(r.transform_in(s1, af));
+        TEST_EQUAL(s1, "<Hello> <world>");
+        TRY(r.transform_in(s1, cf));
+        TEST_EQUAL(s1, "<H> <w>");
+
+        s1 = "aaaa b c";
+        TRY(s2 = r.transform(s1, cf));
+        TEST_EQUAL(s2, "a bbb ccc");
+        TRY(r.transform_in(s1, cf, 2));
+        TEST_EQUAL(s1, "a bbb c");
+        s1 = "aaaa b c";
+        TRY(r.transform_in(s1, cf));
+        TEST_EQUAL(s1, "a bbb ccc");
+
+        s1 = "abc";
+        TRY(r = Regex("(?<=(\\w))\\w"));
+        TRY(s2 = r.transform(s1, mf));
+        TEST_EQUAL(s2, "aaabb");
+        TRY(r.transform_in(s1, mf));
+        TEST_EQUAL(s1, "aaabb");
+
     }
 
     void check_string_escaping() {
@@ -566,6 +719,65 @@ namespace {
 
     }
 
+    void check_stream_matcher() {
+
+        StreamMatcher sm;
+        std::vector<std::pair<size_t, U8string>> found;
+        auto record = [&] (const Match& m, size_t pos) { found.push_back({pos, m.str()}); };
+        auto feed_all = [&] (const Strings& chunks) {
+            found.clear();
+            size_t n = 0;
+            for (auto& chunk: chunks)
+                n += sm.feed(chunk, record);
+            n += sm.finish(record);
+            TEST_EQUAL(n, found.size());
+        };
+        auto list_found = [&] {
+            U8string s;
+            for (auto& f: found)
+                s += dec(f.first) + ":" + f.second + ";";
+            return s;
+        };
+
+        TRY(sm = StreamMatcher(Regex("[a-z]+")));
+        TRY(feed_all({"Hello world"}));
+        TEST_EQUAL(list_found(), "1:ello;6:world;");
+        TRY(feed_all({"Hel", "lo wo", "rld"}));
+        TEST_EQUAL(list_found(), "1:ello;6:world;");
+        TRY(feed_all({"H", "e", "l", "l", "o", " ", "w", "o", "r", "l", "d"}));
+        TEST_EQUAL(list_found(), "1:ello;6:world;");
+        TRY(feed_all({"", "Hello", "", " world", ""}));
+        TEST_EQUAL(list_found(), "1:ello;6:world;");
+        TEST_EQUAL(sm.position(), 0);
+        TEST_EQUAL(sm.buffered(), 0);
+
+        TRY(sm = StreamMatcher(Regex("abc")));
+        TRY(feed_all({"xxab", "cxxa", "bcxab"}));
+        TEST_EQUAL(list_found(), "2:abc;7:abc;");
+        TRY(sm.feed("xxab", record));
+        TEST_EQUAL(sm.position(), 4);
+        TEST_COMPARE(sm.buffered(), <=, 3);
+        TRY(sm.clear());
+        TEST_EQUAL(sm.position(), 0);
+
+        TRY(sm = StreamMatcher(Regex("\\bfoo\\b")));
+        TRY(feed_all({"foo xfo", "o fo", "o"}));
+        TEST_EQUAL(list_found(), "0:foo;9:foo;");
+
+        TRY(sm = StreamMatcher(Regex("(?<=x)y")));
+        TRY(feed_all({"aaax", "yaaaaaaxy"}));
+        TEST_EQUAL(list_found(), "4:y;12:y;");
+
+        TRY(sm = StreamMatcher(Regex("\\p{L}+")));
+        TRY(feed_all({u8"αβ\xce", u8"\xb3 δ"}));
+        TEST_EQUAL(list_found(), u8"0:αβγ;7:δ;");
+
+        TRY(sm = StreamMatcher(Regex("^\\w+", Regex::multiline)));
+        TRY(feed_all({"alpha be", "ta\ngam", "ma\n"}));
+        TEST_EQUAL(list_found(), "0:alpha;11:gamma;");
+
+    }
+
     void check_regex_literals() {
 
         using namespace RS::Unicorn::Literals;
@@ -584,12 +796,15 @@ TEST_MODULE(unicorn, regex) {
 
     check_version_information();
     check_utf8_regex();
+    check_view_search();
     check_match_ranges();
+    check_parallel_search();
     check_split_ranges();
     check_regex_formatting();
     check_regex_transform();
     check_string_escaping();
     check_byte_regex();
+    check_stream_matcher();
     check_regex_literals();
 
 }
@@ -1,6 +1,8 @@
 #include "unicorn/regex.hpp"
 #include "unicorn/character.hpp"
 #include "unicorn/string.hpp"
+#include <limits>
+#include <memory>
 #include <new>
 #include <pcre.h>
 
@@ -59,6 +61,20 @@ namespace RS::Unicorn {
             return v;
         }
 
+        // Length of any incomplete UTF-8 sequence at the end of the text
+
+        size_t incomplete_tail(const U8string& text) noexcept {
+            size_t size = text.size(), i = size, stop = size >= 3 ? size - 3 : 0;
+            while (i > stop && is_nonstart_unit(text[i - 1]))
+                --i;
+            if (i == 0 || ! is_start_unit(text[i - 1]))
+                return 0;
+            --i;
+            auto lead = uint8_t(text[i]);
+            size_t units = lead <= 0xdf ? 2 : lead <= 0xef ? 3 : 4;
+            return size - i < units ? size - i : 0;
+        }
+
         int translate_match_flags(uint32_t fset) {
             int mask = 0;
             if (fset & Regex::partialhard)
@@ -100,6 +116,15 @@ namespace RS::Unicorn {
             return n + 1;
         }
 
+        size_t PcreRef::max_lookbehind() const noexcept {
+            int n = 0;
+            #ifdef PCRE_INFO_MAXLOOKBEHIND
+                if (pc)
+                    pcre_fullinfo(get_pcre(*this), nullptr, PCRE_INFO_MAXLOOKBEHIND, &n);
+            #endif
+            return n;
+        }
+
         size_t PcreRef::named_group(const U8string& name) const noexcept {
             if (! pc)
                 return npos;
@@ -120,6 +145,57 @@ namespace RS::Unicorn {
             }
         }
 
+        constexpr size_t max_subject_size = size_t(std::numeric_limits<int>::max());
+
+        // Start of a search window that ends at or after start, leaving
+        // enough preceding context for lookbehind assertions, and at least
+        // two characters so that \b and ^ (in multiline mode, after CRLF)
+        // still see the previous line break or character
+
+        size_t window_start(std::string_view text, size_t start, const PcreRef& ref, bool utf) noexcept {
+            size_t pos = start, context = std::max(ref.max_lookbehind(), size_t(2));
+            if (utf)
+                context *= 4;
+            pos -= std::min(pos, context);
+            if (utf)
+                while (pos > 0 && is_nonstart_unit(text[pos]))
+                    --pos;
+            return pos;
+        }
+
+        // Raw match call, shared by Match and the parallel search; does not
+        // touch the PCRE reference count, so it is safe to call from several
+        // threads at once on the same regex
+
+        int pcre_match(const PcreRef& ref, uint32_t fset, const char* text, size_t size, size_t start, int xflags, std::vector<int>& ofs) {
+            UNICORN_STAT(regex_matches, 1);
+            // PCRE takes the subject length and offsets as int
+            if (size > max_subject_size)
+                return PCRE_ERROR_BADLENGTH;
+            int status = 0;
+            if (fset & Regex::dfa) {
+                if (fset & Regex::prefershort)
+                    xflags |= PCRE_DFA_SHORTEST;
+                if (ofs.size() < 40)
+                    ofs.resize(40); // ovector + workspace
+                for (;;) {
+                    auto half = int(ofs.size() / 2);
+                    status = pcre_dfa_exec(get_pcre(ref), get_extra(ref), text, int(size), int(start),
+                        translate_match_flags(fset) | xflags, ofs.data(), half, ofs.data() + half, half);
+                    if (status != 0 && status != PCRE_ERROR_DFA_WSSIZE)
+                        break;
+                    ofs.resize(ofs.size() * 2);
+                }
+            } else {
+                size_t minsize = 3 * ref.count_groups();
+                if (ofs.size() < minsize)
+                    ofs.resize(minsize);
+                status = pcre_exec(get_pcre(ref), get_extra(ref), text, int(size), int(start),
+                    translate_match_flags(fset) | xflags, ofs.data(), int(ofs.size()));
+            }
+            return status;
+        }
+
     }
 
     // Exceptions
@@ -148,22 +224,22 @@ namespace RS::Unicorn {
     // Regex match class
 
     U8string Match::first() const {
-        if (! matched() || ! text)
+        if (! matched())
             return {};
         size_t n = groups();
         for (size_t i = 1; i < n; ++i)
             if (is_group(i) && ofs[2 * i + 1] > ofs[2 * i])
-                return text->substr(ofs[2 * i], ofs[2 * i + 1] - ofs[2 * i]);
+                return str(i);
         return {};
     }
 
     U8string Match::last() const {
-        if (! matched() || ! text)
+        if (! matched())
             return {};
         size_t n = groups();
         for (size_t i = n - 1; i > 0; --i)
             if (is_group(i) && ofs[2 * i + 1] > ofs[2 * i])
-                return text->substr(ofs[2 * i], ofs[2 * i + 1] - ofs[2 * i]);
+                return str(i);
         return {};
     }
 
@@ -183,18 +259,16 @@ namespace RS::Unicorn {
 
     void Match::swap(Match& m) noexcept {
         ofs.swap(m.ofs);
+        std::swap(base, m.base);
         std::swap(fset, m.fset);
         std::swap(ref, m.ref);
         std::swap(status, m.status);
         std::swap(text, m.text);
+        std::swap(sview, m.sview);
     }
 
     U8string Match::str(size_t i) const {
-        if (text && is_group(i))
-            return text->substr(ofs[2 * i],
-                ofs[2 * i + 1] - ofs[2 * i]);
-        else
-            return {};
+        return U8string(view(i));
     }
 
     Utf8Iterator Match::u_begin(size_t i) const noexcept {
@@ -211,49 +285,109 @@ namespace RS::Unicorn {
             return {};
     }
 
+    Utf8ViewIterator Match::v_begin(size_t i) const noexcept {
+        if (is_group(i))
+            return Utf8ViewIterator(subject(), offset(i));
+        else
+            return {};
+    }
+
+    Utf8ViewIterator Match::v_end(size_t i) const noexcept {
+        if (is_group(i))
+            return Utf8ViewIterator(subject(), endpos(i));
+        else
+            return {};
+    }
+
+    std::string_view Match::view(size_t i) const noexcept {
+        if (is_group(i))
+            return subject().substr(offset(i), count(i));
+        else
+            return {};
+    }
+
     void Match::init(const Regex& r, const U8string& s) {
+        init(r, std::string_view());
+        text = &s;
+    }
+
+    void Match::init(const Regex& r, std::string_view s) {
         ofs.clear();
+        base = 0;
         fset = r.fset;
         ref = r.ref;
         status = -1;
-        text = &s;
+        text = nullptr;
+        sview = s;
     }
 
     void Match::next(const U8string& pattern, size_t start, int anchors) {
+        using namespace UnicornDetail;
         status = PCRE_ERROR_NOMATCH;
-        if (! ref || start > text->size())
+        base = 0;
+        auto sub = subject();
+        if (! ref || start > sub.size())
             return;
         int xflags = 0;
         if (anchors > 0)
             xflags |= PCRE_ANCHORED;
-        if (fset & Regex::dfa) {
-            if (fset & Regex::prefershort)
-                xflags |= PCRE_DFA_SHORTEST;
-            if (ofs.size() < 40)
-                ofs.resize(40); // ovector + workspace
-            for (;;) {
-                auto half = int(ofs.size() / 2);
-                status = pcre_dfa_exec(get_pcre(ref), get_extra(ref), text->data(), int(text->size()), int(start),
-                    translate_match_flags(fset) | xflags, ofs.data(), half, ofs.data() + half, half);
-                if (status != 0 && status != PCRE_ERROR_DFA_WSSIZE)
-                    break;
-                ofs.resize(ofs.size() * 2);
-            }
-        } else {
-            size_t minsize = 3 * ref.count_groups();
-            if (ofs.size() < minsize)
-                ofs.resize(minsize);
-            status = pcre_exec(get_pcre(ref), get_extra(ref), text->data(), int(text->size()), int(start),
-                translate_match_flags(fset) | xflags, ofs.data(), int(ofs.size()));
-        }
-        if (status >= 0 && anchors == 2 && count(0) < text->size() - start)
+        // PCRE rejects a null subject, even an empty one
+        auto data = sub.data() ? sub.data() : "";
+        status = pcre_match(ref, fset, data, sub.size(), start, xflags, ofs);
+        if (status >= 0 && anchors == 2 && count(0) < sub.size() - start)
             status = PCRE_ERROR_NOMATCH;
         if (status == PCRE_ERROR_NOMEMORY)
             throw std::bad_alloc();
+        if (status == PCRE_ERROR_BADLENGTH && sub.size() > max_subject_size)
+            throw RegexError(status, to_utf8(pattern), "Subject string is too long");
         if (status < 0 && status != PCRE_ERROR_NOMATCH && status != PCRE_ERROR_PARTIAL)
             throw RegexError(status, to_utf8(pattern));
     }
 
+    void Match::next_bounded(const U8string& pattern, size_t start, size_t limit) {
+        // Find the next match that starts before the limit. PCRE is given a
+        // window of the subject instead of the whole string: some context
+        // before the start, and the text up to the limit, extended while a
+        // match runs into the artificial end of the window. The subject
+        // must already have been checked for valid UTF-8; the check is
+        // still made if the start is not on a character boundary, so that
+        // PCRE reports a bad offset just as a sequential search would.
+        using namespace UnicornDetail;
+        status = PCRE_ERROR_NOMATCH;
+        auto sub = subject();
+        if (! ref || start > sub.size() || start >= limit)
+            return;
+        bool utf = ! (fset & Regex::byte);
+        base = window_start(sub, start, ref, utf);
+        size_t end = std::min(limit, sub.size()), extend = 4096;
+        int xflags = utf && start < sub.size() && is_nonstart_unit(sub[start]) ? 0 : PCRE_NO_UTF8_CHECK;
+        for (;;) {
+            if (utf)
+                while (end < sub.size() && is_nonstart_unit(sub[end]))
+                    ++end;
+            if (end - base > max_subject_size)
+                throw RegexError(PCRE_ERROR_BADLENGTH, to_utf8(pattern), "Match is too long");
+            bool truncated = end < sub.size();
+            auto flags = fset;
+            if (truncated) {
+                flags &= ~ Regex::partialsoft;
+                flags |= Regex::partialhard;
+            }
+            status = pcre_match(ref, flags, sub.data() + base, end - base, start - base, xflags, ofs);
+            if (status == PCRE_ERROR_NOMEMORY)
+                throw std::bad_alloc();
+            if (status < 0 && status != PCRE_ERROR_NOMATCH && status != PCRE_ERROR_PARTIAL)
+                throw RegexError(status, to_utf8(pattern));
+            if (status == PCRE_ERROR_NOMATCH || base + ofs[0] >= limit)
+                break;
+            if (! truncated || (status >= 0 && base + ofs[1] < end))
+                return;
+            end = std::min(end + extend, sub.size());
+            extend *= 2;
+        }
+        status = PCRE_ERROR_NOMATCH;
+    }
+
     // Regular expression class
 
     constexpr uint32_t Regex::byte;
@@ -341,6 +475,110 @@ namespace RS::Unicorn {
         }
         auto ex = pcre_study(pc, sflags, &errptr);
         ref = {pc, ex};
+        UNICORN_STAT(regex_compiles, 1);
+        #ifdef UNICORN_STATS
+            int jit = 0;
+            if (ex && pcre_fullinfo(pc, ex, PCRE_INFO_JIT, &jit) == 0 && jit)
+                UNICORN_STAT(regex_jit_compiles, 1);
+        #endif
+    }
+
+    namespace {
+
+        // Results from one chunk of a parallel search
+
+        struct ParallelChunk {
+            size_t begin = 0;                              // First start position covered by this chunk
+            size_t end = 0;                                // Limit on start positions (exclusive)
+            size_t base = 0;                               // Start of the window of the text passed to PCRE
+            size_t unresolved = npos;                      // Where the chunk's own search stopped without resolving the next match
+            int error = 0;                                 // PCRE error status
+            size_t matches = 0;                            // Number of matches found
+            std::pair<size_t, size_t> last;                // Offset and end position of the last match
+            std::vector<std::pair<size_t, size_t>> spans;  // Offset and end position of each match (only the first few if counting)
+            std::vector<int> statuses;                     // PCRE status for each match
+            std::vector<std::vector<int>> vectors;         // PCRE offset vector for each match, relative to base
+        };
+
+        // Chunks are kept well below PCRE's int limit, leaving room for
+        // lookbehind context and for a match that runs past the end
+
+        constexpr size_t max_parallel_chunk = 256 * 1024 * 1024;
+
+        // When only counting, a chunk keeps the spans of its first few
+        // matches, which is enough for the merge to find where a sequential
+        // search running in from the previous chunk falls back into step
+
+        constexpr size_t sync_spans = 16;
+
+        size_t next_match_start(size_t offset, size_t endpos) noexcept {
+            // Same rule as MatchIterator::operator++()
+            return offset + std::max(endpos - offset, size_t(1));
+        }
+
+        void search_chunk(const UnicornDetail::PcreRef& ref, uint32_t fset, const U8string& text, ParallelChunk& chunk, bool keep) {
+            // PCRE is only given the chunk, with some preceding context for
+            // lookbehind assertions, so offsets fit in an int however long
+            // the whole text is. The window is truncated at the end of the
+            // chunk, with hard partial matching, so that any match attempt
+            // that runs into the artificial end of the subject is reported as
+            // unresolved instead of being silently cut short. The first call
+            // checks the whole window for valid UTF-8; later calls skip the
+            // check. After an empty match the next search starts one byte
+            // on, which in UTF mode may be inside a character; a sequential
+            // search reports a bad offset there, so that position is left
+            // unresolved for the merge to repeat the error if it gets there.
+            using namespace UnicornDetail;
+            bool utf = ! (fset & Regex::byte);
+            chunk.base = window_start(text, chunk.begin, ref, utf);
+            size_t size = std::min(chunk.end, text.size());
+            bool truncated = size < text.size();
+            if (truncated) {
+                fset &= ~ Regex::partialsoft;
+                fset |= Regex::partialhard;
+            }
+            const char* data = text.data() + chunk.base;
+            std::vector<int> ofs;
+            size_t pos = chunk.begin;
+            int xflags = 0;
+            while (pos <= size) {
+                int status = pcre_match(ref, fset, data, size - chunk.base, pos - chunk.base, xflags, ofs);
+                xflags = PCRE_NO_UTF8_CHECK;
+                if (status == PCRE_ERROR_NOMATCH)
+                    break;
+                if (status == PCRE_ERROR_PARTIAL) {
+                    if (chunk.base + ofs[0] < chunk.end)
+                        chunk.unresolved = chunk.base + ofs[0];
+                    break;
+                }
+                if (status < 0) {
+                    chunk.error = status;
+                    break;
+                }
+                size_t offset = chunk.base + ofs[0], endpos = chunk.base + ofs[1];
+                if (offset >= chunk.end)
+                    break;
+                if (truncated && endpos == size) {
+                    chunk.unresolved = offset;
+                    break;
+                }
+                ++chunk.matches;
+                chunk.last = {offset, endpos};
+                if (keep || chunk.spans.size() < sync_spans)
+                    chunk.spans.push_back({offset, endpos});
+                if (keep) {
+                    chunk.statuses.push_back(status);
+                    chunk.vectors.emplace_back(ofs.begin(), ofs.begin() + 2 * std::max(status, 1));
+                }
+                pos = next_match_start(offset, endpos);
+                if (utf && pos < size && is_nonstart_unit(text[pos])) {
+                    if (pos < chunk.end)
+                        chunk.unresolved = pos;
+                    break;
+                }
+            }
+        }
+
     }
 
     size_t Regex::count(const U8string& text) const {
@@ -369,6 +607,19 @@ namespace RS::Unicorn {
         return {{*this, text}, {}};
     }
 
+    std::vector<Match> Regex::grep_parallel(const U8string& text, size_t threads) const {
+        std::vector<Match> matches;
+        size_t n = 0;
+        parallel_search(text, threads, &matches, n);
+        return matches;
+    }
+
+    size_t Regex::count_parallel(const U8string& text, size_t threads) const {
+        size_t n = 0;
+        parallel_search(text, threads, nullptr, n);
+        return n;
+    }
+
     SplitRange Regex::split(const U8string& text) const {
         return {{*this, text}, {}};
     }
@@ -437,42 +688,138 @@ namespace RS::Unicorn {
         return m;
     }
 
-    bool operator==(const Regex& lhs, const Regex& rhs) noexcept {
-        return lhs.pat == rhs.pat && lhs.fset == rhs.fset;
+    Match Regex::exec(std::string_view text, size_t offset, int anchors) const {
+        Match m;
+        m.init(*this, text);
+        m.next(pattern(), offset, anchors);
+        return m;
     }
 
-    bool operator<(const Regex& lhs, const Regex& rhs) noexcept {
-        return lhs.pat == rhs.pat ? lhs.fset < rhs.fset : lhs.pat < rhs.pat;
-    }
+    void Regex::parallel_search(const U8string& text, size_t threads, std::vector<Match>* matches, size_t& count) const {
 
-    namespace UnicornDetail {
+        using namespace UnicornDetail;
 
-        void regex_match_transform(const Regex& re, const U8string& src, U8string& dst, std::function<U8string(const Match&)> f, size_t n) {
-            auto matches = re.grep(src);
-            auto m = matches.begin(), end = matches.end();
-            size_t prev = 0;
-            for (size_t i = 0; i < n && m != end; ++i, ++m) {
-                dst.append(src, prev, m->offset() - prev);
-                dst += f(*m);
-                prev = m->endpos();
+        count = 0;
+        if (! ref)
+            return;
+
+        // Divide the text into chunks, preferably ending at line breaks.
+        // Very large texts are divided into more chunks than threads, so
+        // that each one fits in PCRE's int offsets.
+
+        size_t n_chunks = std::max(parallel_chunk_count(text.size(), threads), text.size() / max_parallel_chunk + 1);
+        size_t step = text.size() / n_chunks;
+        bool utf = ! (fset & byte);
+        std::vector<ParallelChunk> chunks(n_chunks);
+        size_t prev = 0;
+        for (size_t i = 0; i < n_chunks; ++i) {
+            chunks[i].begin = prev;
+            if (i == n_chunks - 1) {
+                chunks[i].end = text.size() + 1;
+                break;
+            }
+            size_t nominal = (i + 1) * step, cut = text.find('\n', nominal);
+            if (cut < nominal + step) {
+                ++cut;
+            } else {
+                cut = nominal;
+                if (utf)
+                    while (cut < text.size() && is_nonstart_unit(text[cut]))
+                        ++cut;
             }
-            dst.append(src, prev, npos);
+            chunks[i].end = prev = cut;
         }
 
-        void regex_string_transform(const Regex& re, const U8string& src, U8string& dst, std::function<U8string(const U8string&)> f, size_t n) {
-            auto matches = re.grep(src);
-            auto m = matches.begin(), end = matches.end();
-            size_t prev = 0;
-            for (size_t i = 0; i < n && m != end; ++i, ++m) {
-                dst.append(src, prev, m->offset() - prev);
-                dst += f(m->str());
-                prev = m->endpos();
+        // Search each chunk independently. Errors from any chunk are
+        // reported before merging, so the merge can rely on the whole text
+        // having been checked.
+
+        bool keep = matches != nullptr;
+        parallel_run(n_chunks, [&] (size_t i) { search_chunk(ref, fset, text, chunks[i], keep); });
+
+        for (auto& c: chunks) {
+            if (c.error == PCRE_ERROR_NOMEMORY)
+                throw std::bad_alloc();
+            if (c.error)
+                throw RegexError(c.error, pat);
+        }
+
+        // Merge the results. If a match from one chunk extends into the next
+        // chunk, or a chunk ended with an unresolved match, search
+        // sequentially from that point until the end of the chunk, or until
+        // we find a match that the chunk's own search also found, after which
+        // the two searches must agree. Each sequential search only looks at
+        // the rest of the chunk, plus as much of the text as the match needs.
+
+        Match m;
+        m.init(*this, text);
+        auto add_match = [&] (const Match& x) {
+            if (matches)
+                matches->push_back(x);
+            ++count;
+        };
+        size_t resume = 0;
+
+        for (auto& c: chunks) {
+
+            size_t i = 0;
+            bool synced = resume <= c.begin;
+
+            while (! synced) {
+                m.next_bounded(pat, resume, c.end);
+                if (! m)
+                    break;
+                while (i < c.spans.size() && c.spans[i].first < m.offset())
+                    ++i;
+                if (i < c.spans.size() && c.spans[i].first == m.offset() && c.spans[i].second == m.endpos()) {
+                    synced = true;
+                } else {
+                    add_match(m);
+                    resume = next_match_start(m.offset(), m.endpos());
+                }
+            }
+
+            if (! synced)
+                continue;
+
+            if (i < c.matches) {
+                count += c.matches - i;
+                resume = next_match_start(c.last.first, c.last.second);
+            }
+            if (matches) {
+                for (; i < c.spans.size(); ++i) {
+                    Match x;
+                    x.init(*this, text);
+                    x.status = c.statuses[i];
+                    x.ofs = std::move(c.vectors[i]);
+                    x.base = c.base;
+                    matches->push_back(std::move(x));
+                }
+            }
+
+            if (c.unresolved != npos) {
+                resume = c.unresolved;
+                for (;;) {
+                    m.next_bounded(pat, resume, c.end);
+                    if (! m)
+                        break;
+                    add_match(m);
+                    resume = next_match_start(m.offset(), m.endpos());
+                }
             }
-            dst.append(src, prev, npos);
+
         }
 
     }
 
+    bool operator==(const Regex& lhs, const Regex& rhs) noexcept {
+        return lhs.pat == rhs.pat && lhs.fset == rhs.fset;
+    }
+
+    bool operator<(const Regex& lhs, const Regex& rhs) noexcept {
+        return lhs.pat == rhs.pat ? lhs.fset < rhs.fset : lhs.pat < rhs.pat;
+    }
+
     // Regex formatting class
 
     RegexFormat::RegexFormat(const Regex& pattern, const U8string& format):
@@ -508,6 +855,12 @@ namespace RS::Unicorn {
         add_literal(u);
     }
 
+    void RegexFormat::add_named(const U8string& name) {
+        size_t index = reg.named(name);
+        if (index != npos)
+            add_tag(int(index));
+    }
+
     void RegexFormat::add_literal(const U8string& text) {
         if (! text.empty()) {
             if (seq.empty() || seq.back().index != literal)
@@ -536,88 +889,144 @@ namespace RS::Unicorn {
         }
     }
 
-    U8string RegexFormat::apply(const U8string& text, size_t n, bool full) const {
+    void RegexFormat::apply(const U8string& text, size_t n, bool full, U8string& dst) const {
+        apply_to(text, n, full, dst);
+    }
+
+    void RegexFormat::apply(const U8string& text, size_t n, bool full, PmrString& dst) const {
+        apply_to(text, n, full, dst);
+    }
+
+    // The destination may be a U8string or a PmrString. Text inside a case
+    // conversion block is collected in a scratch string, and converted into
+    // the destination when the block ends.
+
+    template <typename S>
+    void RegexFormat::apply_to(const U8string& text, size_t n, bool full, S& dst) const {
         using namespace UnicornDetail;
-        U8string block, dst;
-        U8string* current = &dst;
+        // Record the group offsets of all matches in one flat array, so the
+        // size of the output can be measured before anything is written.
+        // Match i's groups start at spans[index[i]], as (offset,endpos)
+        // pairs, with npos for unmatched groups.
+        std::vector<size_t> spans, index;
+        for (auto& m: reg.grep(text)) {
+            index.push_back(spans.size());
+            for (size_t g = 0, ng = m.groups(); g < ng; ++g) {
+                spans.push_back(m.offset(g));
+                spans.push_back(m.endpos(g));
+            }
+            if (index.size() >= n)
+                break;
+        }
+        size_t nm = index.size();
+        index.push_back(spans.size());
+        auto group = [&] (size_t i, size_t g, size_t& ofs, size_t& len) {
+            size_t k = index[i] + 2 * g;
+            if (k < index[i + 1] && spans[k] != npos && spans[k + 1] > spans[k]) {
+                ofs = spans[k];
+                len = spans[k + 1] - spans[k];
+                return true;
+            } else {
+                return false;
+            }
+        };
+        auto fragment = [&] (const element& elem, size_t i) -> std::pair<const char*, size_t> {
+            if (elem.index == literal)
+                return {elem.text.data(), elem.text.size()};
+            size_t ofs = 0, len = 0;
+            if (elem.index >= 0) {
+                group(i, elem.index, ofs, len);
+            } else {
+                size_t start = spans[index[i]], end = spans[index[i] + 1], ng = (index[i + 1] - index[i]) / 2;
+                switch (char(- elem.index)) {
+                    case '-':  for (size_t g = 1; g < ng && ! group(i, g, ofs, len); ++g) {} break;
+                    case '+':  for (size_t g = ng - 1; g > 0 && ! group(i, g, ofs, len); --g) {} break;
+                    case '<':  ofs = i == 0 ? 0 : spans[index[i - 1] + 1]; len = start - ofs; break;
+                    case '>':  ofs = end; len = (i == nm - 1 ? text.size() : spans[index[i + 1]]) - end; break;
+                    case '[':  len = start; break;
+                    case ']':  ofs = end; len = text.size() - end; break;
+                    case '_':  len = text.size(); break;
+                    default:   break;
+                }
+            }
+            return {text.data() + ofs, len};
+        };
+        size_t size = dst.size();
+        if (full)
+            size += text.size();
+        for (size_t i = 0; i < nm; ++i) {
+            if (full)
+                size -= spans[index[i] + 1] - spans[index[i]];
+            for (auto& elem: seq)
+                size += fragment(elem, i).second;
+        }
+        dst.reserve(size);
+        U8string block;
+        bool in_block = false;
         char block_flag = 0, char_flag = 0;
         bool ascii = (reg.flags() & Regex::byte) != 0;
+        auto append = [&] (const char* ptr, size_t len) {
+            if (in_block)
+                block.append(ptr, len);
+            else
+                dst.append(ptr, len);
+        };
         auto end_block = [&] {
-            if (current == &dst)
+            if (! in_block)
                 return;
             switch (block_flag) {
-                case 'L':  if (ascii) block = ascii_lowercase(block); else str_lowercase_in(block); break;
-                case 'T':  if (ascii) block = ascii_titlecase(block); else str_titlecase_in(block); break;
-                case 'U':  if (ascii) block = ascii_uppercase(block); else str_uppercase_in(block); break;
-                default:   break;
+                case 'L':  if (ascii) dst += ascii_lowercase(block); else str_lowercase_to(dst, block); break;
+                case 'T':  if (ascii) dst += ascii_titlecase(block); else str_titlecase_to(dst, block); break;
+                case 'U':  if (ascii) dst += ascii_uppercase(block); else str_uppercase_to(dst, block); break;
+                default:   dst += block; break;
             }
-            dst += block;
             block.clear();
             block_flag = 0;
-            current = &dst;
+            in_block = false;
         };
-        std::vector<Match> matches;
-        for (auto& m: reg.grep(text)) {
-            matches.push_back(m);
-            if (matches.size() >= n)
-                break;
-        }
-        for (size_t i = 0, nm = matches.size(); i < nm; ++i) {
-            const auto& m = matches[i];
-            size_t prev = i == 0 ? 0 : matches[i - 1].endpos();
-            size_t next = i == nm - 1 ? text.size() : matches[i + 1].offset();
+        size_t prev = 0;
+        for (size_t i = 0; i < nm; ++i) {
             if (full)
-                dst.append(text, prev, m.offset() - prev);
+                dst.append(text.data() + prev, spans[index[i]] - prev);
+            prev = spans[index[i] + 1];
             block_flag = char_flag = 0;
             for (auto& elem: seq) {
-                U8string fragment;
-                if (elem.index >= 0) {
-                    fragment = m.str(elem.index);
-                } else if (elem.index == literal) {
-                    fragment = elem.text;
-                } else if (elem.index == named) {
-                    fragment = m.named(elem.text);
-                } else {
+                if (elem.index < -1) {
                     auto flag = char(- elem.index);
                     switch (flag) {
-                        case 'E':                      end_block(); break;
-                        case 'L': case 'T': case 'U':  end_block(); block_flag = flag; current = &block; break;
-                        case 'l': case 'u':            char_flag = flag; break;
-                        case '-':                      fragment = m.first(); break;
-                        case '+':                      fragment = m.last(); break;
-                        case '<':                      fragment = text.substr(prev, m.offset() - prev); break;
-                        case '>':                      fragment = text.substr(m.endpos(), next - m.endpos()); break;
-                        case '[':                      fragment = text.substr(0, m.offset()); break;
-                        case ']':                      fragment = text.substr(m.endpos(), npos); break;
-                        case '_':                      fragment = text; break;
+                        case 'E':                      end_block(); continue;
+                        case 'L': case 'T': case 'U':  end_block(); block_flag = flag; in_block = true; continue;
+                        case 'l': case 'u':            char_flag = flag; continue;
                         default:                       break;
                     }
                 }
-                if (fragment.empty())
+                auto frag = fragment(elem, i);
+                if (frag.second == 0)
                     continue;
                 if (char_flag) {
-                    auto it = utf_begin(fragment);
-                    char32_t buf[max_case_decomposition];
+                    size_t units = 1;
                     if (ascii) {
-                        *current += char_flag == 'l' ? ascii_tolower(*it) : ascii_toupper(*it);
+                        char c = char_flag == 'l' ? ascii_tolower(*frag.first) : ascii_toupper(*frag.first);
+                        append(&c, 1);
                     } else {
-                        size_t nbuf(char_flag == 'l' ? char_to_full_lowercase(*it, buf) : char_to_full_uppercase(*it, buf));
-                        str_append(*current, buf, nbuf);
+                        char32_t c = 0;
+                        units = UtfEncoding<char>::decode(frag.first, frag.second, c);
+                        char32_t buf[max_case_decomposition];
+                        size_t nbuf(char_flag == 'l' ? char_to_full_lowercase(c, buf) : char_to_full_uppercase(c, buf));
+                        char utf8[4];
+                        for (size_t k = 0; k < nbuf; ++k)
+                            append(utf8, UtfEncoding<char>::encode(buf[k], utf8));
                     }
-                    ++it;
-                    current->append(fragment, it.offset(), npos);
+                    append(frag.first + units, frag.second - units);
                     char_flag = 0;
                 } else {
-                    *current += fragment;
+                    append(frag.first, frag.second);
                 }
             }
             end_block();
         }
-        if (full) {
-            size_t prev = matches.empty() ? 0 : matches.back().endpos();
-            dst.append(text, prev, npos);
-        }
-        return dst;
+        if (full)
+            dst.append(text.data() + prev, text.size() - prev);
     }
 
     void RegexFormat::parse() {
@@ -676,6 +1085,100 @@ namespace RS::Unicorn {
         }
     }
 
+    // Incremental regex search over a stream
+
+    void StreamMatcher::clear() noexcept {
+        buf.clear();
+        hold.clear();
+        base = next = 0;
+    }
+
+    size_t StreamMatcher::feed(const char* ptr, size_t len, const callback& f) {
+        if (! ptr || len == 0)
+            return 0;
+        buf += hold;
+        hold.clear();
+        buf.append(ptr, len);
+        if (! (reg.flags() & Regex::byte)) {
+            size_t tail = incomplete_tail(buf);
+            if (tail > 0) {
+                hold.assign(buf, buf.size() - tail, npos);
+                buf.resize(buf.size() - tail);
+            }
+        }
+        return scan(f, false);
+    }
+
+    size_t StreamMatcher::finish(const callback& f) {
+        buf += hold;
+        hold.clear();
+        size_t n = scan(f, true);
+        clear();
+        return n;
+    }
+
+    size_t StreamMatcher::scan(const callback& f, bool last) {
+        // Until the end of the stream is reached, search with hard partial
+        // matching. A partial match, or a full match that runs to the end of
+        // the buffer (which might be extended by the next chunk), stops the
+        // search and is retried when more text arrives.
+        bool utf = ! (reg.flags() & Regex::byte);
+        Match m;
+        m.init(reg, buf);
+        if (! last) {
+            m.fset &= ~ Regex::partialsoft;
+            m.fset |= Regex::partialhard;
+        }
+        if (base > 0)
+            m.fset |= Regex::notbol;
+        size_t keep = buf.size(), n = 0;
+        while (next <= buf.size()) {
+            m.next(reg.pat, next, 0);
+            if (m.partial()) {
+                keep = next = size_t(m.ofs[0]);
+                break;
+            }
+            if (! last && m && m.endpos() == buf.size()) {
+                keep = next = m.offset();
+                break;
+            }
+            if (! m) {
+                keep = next = buf.size();
+                break;
+            }
+            if (f)
+                f(m, base + m.offset());
+            ++n;
+            if (m.endpos() > m.offset()) {
+                next = m.endpos();
+            } else {
+                next = m.offset() + 1;
+                if (utf)
+                    while (next < buf.size() && is_nonstart_unit(buf[next]))
+                        ++next;
+            }
+            keep = std::min(next, buf.size());
+        }
+        if (last)
+            return n;
+        // Retain enough preceding context for lookbehind assertions, and at
+        // least one character so that \b and ^ (in multiline mode) still see
+        // the previous character.
+        size_t cut = keep, context = std::max(reg.ref.max_lookbehind(), size_t(1));
+        for (size_t i = 0; i < context && cut > 0; ++i) {
+            --cut;
+            if (utf)
+                while (cut > 0 && is_nonstart_unit(buf[cut]))
+                    --cut;
+        }
+        if (cut > 0) {
+            buf.erase(0, cut);
+            base += cut;
+            next -= cut;
+        }
+        return n;
+    }
+
     // Iterator over regex matches
 
     MatchIterator::MatchIterator(const Regex& re, const U8string& text):
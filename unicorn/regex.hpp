@@ -6,6 +6,7 @@
 #include <functional>
 #include <memory>
 #include <stdexcept>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
@@ -18,6 +19,7 @@ namespace RS::Unicorn {
     class Regex;
     class RegexFormat;
     class SplitIterator;
+    class StreamMatcher;
     using MatchRange = Irange<MatchIterator>;
     using SplitRange = Irange<SplitIterator>;
 
@@ -37,6 +39,7 @@ namespace RS::Unicorn {
             size_t count_groups() const noexcept;
             void* get_pc_ptr() const noexcept { return pc; }
             void* get_ex_ptr() const noexcept { return ex; }
+            size_t max_lookbehind() const noexcept;
             size_t named_group(const U8string& name) const noexcept;
             void swap(PcreRef& p) noexcept { std::swap(pc, p.pc); std::swap(ex, p.ex); }
             explicit operator bool() const noexcept { return pc; }
@@ -72,16 +75,16 @@ namespace RS::Unicorn {
         operator U8string() const { return str(); }
         explicit operator bool() const noexcept { return matched(); }
         bool operator!() const noexcept { return ! matched(); }
-        size_t count(size_t i = 0) const noexcept { return is_group(i) ? ofs[2 * i + 1] - ofs[2 * i] : 0; }
+        size_t count(size_t i = 0) const noexcept { return is_group(i) ? size_t(ofs[2 * i + 1] - ofs[2 * i]) : 0; }
         bool empty() const noexcept { return ! *this || ofs[0] == ofs[1]; }
-        size_t endpos(size_t i = 0) const noexcept { return is_group(i) ? ofs[2 * i + 1] : npos; }
+        size_t endpos(size_t i = 0) const noexcept { return is_group(i) ? base + ofs[2 * i + 1] : npos; }
         U8string first() const;
         U8string last() const;
         bool full_or_partial() const noexcept { return matched() || partial(); }
         size_t groups() const noexcept { return std::max(status, 0); }
         bool matched(size_t i = 0) const noexcept { return status >= 0 && (i == 0 || is_group(i)); }
         U8string named(const U8string& name) const { return ref ? str(ref.named_group(name)) : U8string(); }
-        size_t offset(size_t i = 0) const noexcept { return is_group(i) ? ofs[2 * i] : npos; }
+        size_t offset(size_t i = 0) const noexcept { return is_group(i) ? base + ofs[2 * i] : npos; }
         bool partial() const noexcept { return status == -12; } // PCRE_ERROR_PARTIAL
         U8string::const_iterator s_begin(size_t i = 0) const noexcept;
         U8string::const_iterator s_end(size_t i = 0) const noexcept;
@@ -91,17 +94,27 @@ namespace RS::Unicorn {
         Utf8Iterator u_begin(size_t i = 0) const noexcept;
         Utf8Iterator u_end(size_t i = 0) const noexcept;
         Irange<Utf8Iterator> u_range(size_t i = 0) const noexcept { return {u_begin(i), u_end(i)}; }
+        Utf8ViewIterator v_begin(size_t i = 0) const noexcept;
+        Utf8ViewIterator v_end(size_t i = 0) const noexcept;
+        Irange<Utf8ViewIterator> v_range(size_t i = 0) const noexcept { return {v_begin(i), v_end(i)}; }
+        std::string_view view(size_t i = 0) const noexcept;
     private:
         friend class MatchIterator;
         friend class Regex;
         friend class SplitIterator;
-        std::vector<int> ofs;
+        friend class StreamMatcher;
+        std::vector<int> ofs;            // PCRE offsets, relative to base
+        size_t base = 0;                 // Start of the window of the subject passed to PCRE
         uint32_t fset = 0;
         UnicornDetail::PcreRef ref;
         int status = -1;
-        const U8string* text = nullptr;
+        const U8string* text = nullptr;  // Subject string, if the search was on a string
+        std::string_view sview;          // Subject string, if the search was on a view
+        std::string_view subject() const noexcept { return text ? std::string_view(*text) : sview; }
         void init(const Regex& r, const U8string& s);
+        void init(const Regex& r, std::string_view s);
         void next(const U8string& pattern, size_t start, int anchors);
+        void next_bounded(const U8string& pattern, size_t start, size_t limit);
         bool is_group(size_t i) const noexcept { return i < groups() && ofs[2 * i] >= 0 && ofs[2 * i + 1] >= 0; }
     };
 
@@ -143,17 +156,25 @@ namespace RS::Unicorn {
         explicit Regex(const U8string& pattern, uint32_t flags = 0);
         Match operator()(const U8string& text, size_t offset = 0) const { return search(text, offset); }
         Match operator()(const Utf8Iterator& start) const { return search(start.source(), start.offset()); }
+        Match operator()(std::string_view text, size_t offset = 0) const { return search(text, offset); }
+        Match operator()(const char* text, size_t offset = 0) const { return search(text, offset); }
+        Match operator()(const Utf8ViewIterator& start) const { return search(start.source(), start.offset()); }
         Match anchor(const U8string& text, size_t offset = 0) const { return exec(text, offset, 1); }
         Match anchor(const Utf8Iterator& start) const { return anchor(start.source(), start.offset()); }
         Match match(const U8string& text, size_t offset = 0) const { return exec(text, offset, 2); }
         Match match(const Utf8Iterator& start) const { return match(start.source(), start.offset()); }
         Match search(const U8string& text, size_t offset = 0) const { return exec(text, offset, 0); }
         Match search(const Utf8Iterator& start) const { return search(start.source(), start.offset()); }
+        Match search(std::string_view text, size_t offset = 0) const { return exec(text, offset, 0); }
+        Match search(const char* text, size_t offset = 0) const { return search(std::string_view(text), offset); }
+        Match search(const Utf8ViewIterator& start) const { return search(start.source(), start.offset()); }
         size_t count(const U8string& text) const;
         bool empty() const noexcept { return pat.empty(); }
         U8string extract(const U8string& fmt, const U8string& text, size_t n = npos) const;
         U8string format(const U8string& fmt, const U8string& text, size_t n = npos) const;
         MatchRange grep(const U8string& text) const;
+        std::vector<Match> grep_parallel(const U8string& text, size_t threads = 0) const;
+        size_t count_parallel(const U8string& text, size_t threads = 0) const;
         size_t groups() const noexcept { return ref.count_groups(); }
         size_t named(const U8string& name) const noexcept { return ref.named_group(name); }
         U8string pattern() const { return pat; }
@@ -172,51 +193,16 @@ namespace RS::Unicorn {
 
         friend class MatchIterator;
         friend class Match;
+        friend class StreamMatcher;
         U8string pat;
         uint32_t fset = 0;
         UnicornDetail::PcreRef ref;
         Match exec(const U8string& text, size_t offset, int anchors) const;
+        Match exec(std::string_view text, size_t offset, int anchors) const;
+        void parallel_search(const U8string& text, size_t threads, std::vector<Match>* matches, size_t& count) const;
 
     };
 
-    namespace UnicornDetail {
-
-        void regex_match_transform(const Regex& re, const U8string& src, U8string& dst, std::function<U8string(const Match&)> f, size_t n);
-        void regex_string_transform(const Regex& re, const U8string& src, U8string& dst, std::function<U8string(const U8string&)> f, size_t n);
-
-        template <typename F, bool S = std::is_convertible<F, std::function<U8string(const U8string&)>>::value>
-        struct RegexTransform ;
-
-        template <typename F>
-        struct RegexTransform<F, false> {
-            void operator()(const Regex& re, const U8string& src, U8string& dst, F f, size_t n) const {
-                regex_match_transform(re, src, dst, f, n);
-            }
-        };
-
-        template <typename F>
-        struct RegexTransform<F, true> {
-            void operator()(const Regex& re, const U8string& src, U8string& dst, F f, size_t n) const {
-                regex_string_transform(re, src, dst, f, n);
-            }
-        };
-
-    }
-
-    template <typename F>
-    U8string Regex::transform(const U8string& text, F f, size_t n) const {
-        U8string dst;
-        UnicornDetail::RegexTransform<F>()(*this, text, dst, f, n);
-        return dst;
-    }
-
-    template <typename F>
-    void Regex::transform_in(U8string& text, F f, size_t n) const {
-        U8string dst;
-        UnicornDetail::RegexTransform<F>()(*this, text, dst, f, n);
-        text = move(dst);
-    }
-
     inline void swap(Regex& lhs, Regex& rhs) noexcept { lhs.swap(rhs); }
 
     namespace Literals {
@@ -236,9 +222,13 @@ namespace RS::Unicorn {
         RegexFormat(const U8string& pattern, const U8string& format, uint32_t flags = 0);
         U8string operator()(const U8string& text, size_t n = npos) const { return format(text, n); }
         uint32_t flags() const noexcept { return reg.flags(); }
-        U8string extract(const U8string& text, size_t n = npos) const { return apply(text, n, false); }
+        U8string extract(const U8string& text, size_t n = npos) const { U8string s; apply(text, n, false, s); return s; }
+        void extract_to(U8string& dst, const U8string& text, size_t n = npos) const { apply(text, n, false, dst); }
+        void extract_to(PmrString& dst, const U8string& text, size_t n = npos) const { apply(text, n, false, dst); }
         U8string format() const { return fmt; }
-        U8string format(const U8string& text, size_t n = npos) const { return apply(text, n, true); }
+        U8string format(const U8string& text, size_t n = npos) const { U8string s; apply(text, n, true, s); return s; }
+        void format_to(U8string& dst, const U8string& text, size_t n = npos) const { apply(text, n, true, dst); }
+        void format_to(PmrString& dst, const U8string& text, size_t n = npos) const { apply(text, n, true, dst); }
         U8string pattern() const { return reg.pattern(); }
         Regex regex() const { return reg; }
         void swap(RegexFormat& r) noexcept;
@@ -246,9 +236,9 @@ namespace RS::Unicorn {
         // Index field in element record indicates what to substitute
         // >= 0  => numbered capture group
         // -1    => literal text
-        // -2    => named capture group
-        // < -2  => escape code
-        static constexpr int literal = -1, named = -2;
+        // < -1  => escape code
+        // Named capture groups are resolved to numbers when parsed
+        static constexpr int literal = -1;
         struct element {
             int index;
             U8string text;
@@ -261,14 +251,40 @@ namespace RS::Unicorn {
         void add_literal(const U8string& text);
         void add_literal(const U8string& text, size_t offset, size_t count);
         void add_literal(char32_t u);
-        void add_named(const U8string& name) { seq.push_back({named, name}); }
+        void add_named(const U8string& name);
         void add_tag(int tag) { seq.push_back({tag, {}}); }
-        U8string apply(const U8string& text, size_t n, bool full) const;
+        void apply(const U8string& text, size_t n, bool full, U8string& dst) const;
+        void apply(const U8string& text, size_t n, bool full, PmrString& dst) const;
+        template <typename S> void apply_to(const U8string& text, size_t n, bool full, S& dst) const;
         void parse();
     };
 
     inline void swap(RegexFormat& lhs, RegexFormat& rhs) noexcept { lhs.swap(rhs); }
 
+    // Incremental regex search over a stream
+
+    class StreamMatcher {
+    public:
+        using callback = std::function<void(const Match&, size_t)>;
+        StreamMatcher() = default;
+        explicit StreamMatcher(const Regex& re): reg(re) {}
+        StreamMatcher(const U8string& pattern, uint32_t flags): reg(pattern, flags) {}
+        size_t buffered() const noexcept { return buf.size() + hold.size(); }
+        void clear() noexcept;
+        size_t feed(const U8string& chunk, const callback& f) { return feed(chunk.data(), chunk.size(), f); }
+        size_t feed(const char* ptr, size_t len, const callback& f);
+        size_t finish(const callback& f);
+        size_t position() const noexcept { return base + buffered(); }
+        Regex regex() const { return reg; }
+    private:
+        Regex reg;
+        U8string buf;     // Unresolved text carried over from earlier chunks
+        U8string hold;    // Incomplete UTF-8 character at the end of the last chunk
+        size_t base = 0;  // Stream offset of the start of buf
+        size_t next = 0;  // Offset in buf where the next search starts
+        size_t scan(const callback& f, bool last);
+    };
+
     // Iterator over regex matches
 
     class MatchIterator:
@@ -301,4 +317,145 @@ namespace RS::Unicorn {
         void update();
     };
 
+    // Regex transform templates
+
+    namespace UnicornDetail {
+
+        // A transform callback can map a Match or a matched string to a
+        // replacement string, or take a Match and an output string and
+        // append the replacement directly to the output
+
+        template <typename F, int K = std::is_invocable<F&, const Match&, U8string&>::value ? 2
+            : std::is_convertible<F, std::function<U8string(const U8string&)>>::value ? 1 : 0>
+        struct RegexTransform;
+
+        template <typename F>
+        struct RegexTransform<F, 0> {
+            void operator()(F& f, const Match& m, U8string& /*tmp*/, U8string& dst) const {
+                dst += f(m);
+            }
+        };
+
+        template <typename F>
+        struct RegexTransform<F, 1> {
+            void operator()(F& f, const Match& m, U8string& tmp, U8string& dst) const {
+                tmp.assign(m.s_begin(), m.s_end());
+                dst += f(static_cast<const U8string&>(tmp));
+            }
+        };
+
+        template <typename F>
+        struct RegexTransform<F, 2> {
+            void operator()(F& f, const Match& m, U8string& /*tmp*/, U8string& dst) const {
+                f(m, dst);
+            }
+        };
+
+        template <typename F>
+        void regex_transform(const Regex& re, const U8string& src, U8string& dst, F& f, size_t n) {
+            RegexTransform<F> t;
+            U8string tmp;
+            size_t i = 0, prev = 0;
+            dst.reserve(dst.size() + src.size());
+            if (n > 0) {
+                for (auto& m: re.grep(src)) {
+                    dst.append(src, prev, m.offset() - prev);
+                    t(f, m, tmp, dst);
+                    prev = m.endpos();
+                    if (++i >= n)
+                        break;
+                }
+            }
+            dst.append(src, prev, npos);
+        }
+
+        template <typename F>
+        void regex_transform_matches(const std::vector<Match>& matches, size_t i, size_t prev,
+                const U8string& src, U8string& dst, F& f, U8string& tmp) {
+            RegexTransform<F> t;
+            for (; i < matches.size(); ++i) {
+                dst.append(src, prev, matches[i].offset() - prev);
+                t(f, matches[i], tmp, dst);
+                prev = matches[i].endpos();
+            }
+            dst.append(src, prev, npos);
+        }
+
+        template <typename F>
+        void regex_transform_in(const Regex& re, U8string& text, F& f, size_t n) {
+            // All matches are found before anything is modified, because
+            // assertions may look at text before the match. Replacements are
+            // then written over the original text, which works as long as
+            // the output never overtakes text that has not been read yet.
+            // Otherwise the rest of the output goes into a new string.
+            std::vector<Match> matches;
+            bool overlap = false;
+            if (n > 0) {
+                size_t prev = 0;
+                for (auto& m: re.grep(text)) {
+                    for (size_t g = 0, ng = m.groups(); g < ng; ++g)
+                        if (m.offset(g) < prev)
+                            overlap = true;
+                    matches.push_back(m);
+                    prev = m.endpos();
+                    if (matches.size() >= n)
+                        break;
+                }
+            }
+            if (matches.empty())
+                return;
+            U8string tmp;
+            if (overlap) {
+                // A capture group reaches back into the previous match
+                U8string dst;
+                dst.reserve(text.size());
+                regex_transform_matches(matches, 0, 0, text, dst, f, tmp);
+                text = std::move(dst);
+                return;
+            }
+            RegexTransform<F> t;
+            U8string rep;
+            size_t r = 0, w = 0; // Read and write positions
+            for (size_t i = 0; i < matches.size(); ++i) {
+                const auto& m = matches[i];
+                rep.clear();
+                t(f, m, tmp, rep);
+                size_t gap = m.offset() - r;
+                if (w < r)
+                    U8string::traits_type::move(&text[w], text.data() + r, gap);
+                w += gap;
+                r = m.endpos();
+                if (rep.size() > r - w) {
+                    U8string dst;
+                    dst.reserve(text.size() + rep.size() - (r - w));
+                    dst.assign(text, 0, w);
+                    dst += rep;
+                    regex_transform_matches(matches, i + 1, r, text, dst, f, tmp);
+                    text = std::move(dst);
+                    return;
+                }
+                U8string::traits_type::copy(&text[w], rep.data(), rep.size());
+                w += rep.size();
+            }
+            if (w < r) {
+                size_t tail = text.size() - r;
+                U8string::traits_type::move(&text[w], text.data() + r, tail);
+                text.resize(w + tail);
+            }
+        }
+
+    }
+
+    template <typename F>
+    U8string Regex::transform(const U8string& text, F f, size_t n) const {
+        U8string dst;
+        UnicornDetail::regex_transform(*this, text, dst, f, n);
+        return dst;
+    }
+
+    template <typename F>
+    void Regex::transform_in(U8string& text, F f, size_t n) const {
+        UnicornDetail::regex_transform_in(*this, text, f, n);
+    }
+
 }
@@ -9,6 +9,7 @@
 #include <iostream>
 #include <cstdlib>
 #include <string>
+#include <string_view>
 #include <vector>
 
 using namespace RS;
@@ -26,8 +27,8 @@ namespace {
     }
 
     struct SplitGraphemes {
-        template <typename String>
-        void operator()(const String& src, std::vector<String>& dst) const {
+        template <typename Source, typename String>
+        void operator()(const Source& src, std::vector<String>& dst) const {
             auto range = grapheme_range(src);
             for (auto& segment: range)
                 dst.push_back(u_str(segment));
@@ -35,8 +36,8 @@ namespace {
     };
 
     struct SplitWords {
-        template <typename String>
-        void operator()(const String& src, std::vector<String>& dst) const {
+        template <typename Source, typename String>
+        void operator()(const Source& src, std::vector<String>& dst) const {
             auto range = word_range(src);
             for (auto& segment: range)
                 dst.push_back(u_str(segment));
@@ -44,8 +45,8 @@ namespace {
     };
 
     struct SplitSentences {
-        template <typename String>
-        void operator()(const String& src, std::vector<String>& dst) const {
+        template <typename Source, typename String>
+        void operator()(const Source& src, std::vector<String>& dst) const {
             auto range = sentence_range(src);
             for (auto& segment: range)
                 dst.push_back(u_str(segment));
@@ -77,15 +78,17 @@ namespace {
                 expect16[i] = recode<char16_t>(expect32[i]);
                 wexpect[i] = recode<wchar_t>(expect32[i]);
             }
-            Strings segments8;
+            Strings segments8, vsegments8;
             std::vector<std::u16string> segments16;
             std::vector<std::u32string> segments32;
             std::vector<std::wstring> wsegments;
             TRY(Split()(source8, segments8));
+            TRY(Split()(std::string_view(source8), vsegments8));
             TRY(Split()(source16, segments16));
             TRY(Split()(source32, segments32));
             TRY(Split()(wsource, wsegments));
             TEST_EQUAL_RANGE(segments8, expect8);
+            TEST_EQUAL_RANGE(vsegments8, expect8);
             TEST_EQUAL_RANGE(segments16, expect16);
             TEST_EQUAL_RANGE(segments32, expect32);
             TEST_EQUAL_RANGE(wsegments, wexpect);
@@ -241,6 +244,95 @@ namespace {
 
     }
 
+    #define LINE_BREAK_TEST(source, expect) \
+        do { \
+            auto s = cstr(source); \
+            decltype(line_break_range(s)) segments; \
+            TRY(segments = line_break_range(s)); \
+            decltype(s) result; \
+            for (auto i = segments.begin(); i != segments.end(); ++i) { \
+                str_append_char(result, '['); \
+                TRY(result += u_str(*i)); \
+                if (i.mandatory()) \
+                    str_append_char(result, '!'); \
+                str_append_char(result, ']'); \
+            } \
+            TEST_EQUAL(result, expect); \
+        } while (false)
+
+    void check_line_break_segmentation() {
+
+        LINE_BREAK_TEST(u8"", u8"");
+        LINE_BREAK_TEST(u8"Hello world", u8"[Hello ][world]");
+        LINE_BREAK_TEST(u8"Hello  world  ", u8"[Hello  ][world  ]");
+        LINE_BREAK_TEST(u8"  Hello", u8"[  ][Hello]");
+        LINE_BREAK_TEST(u8"The quick-brown fox.", u8"[The ][quick-][brown ][fox.]");
+        LINE_BREAK_TEST(u8"(a) [b] {c}", u8"[(a) ][[b] ][{c}]");
+        LINE_BREAK_TEST(u8"$1,234.56 is 10% off", u8"[$1,234.56 ][is ][10% ][off]");
+        LINE_BREAK_TEST(u8"e.g. foo/bar", u8"[e.g. ][foo/][bar]");
+        LINE_BREAK_TEST(u8"Hello\nworld\n", u8"[Hello\n!][world\n!]");
+        LINE_BREAK_TEST(u8"Hello\r\nworld\r\n\r\n", u8"[Hello\r\n!][world\r\n!][\r\n!]");
+        LINE_BREAK_TEST(u8"Hello\rworld", u8"[Hello\r!][world]");
+        LINE_BREAK_TEST(u8"Hello \u2028world", u8"[Hello \u2028!][world]");
+        LINE_BREAK_TEST(u8"a\u00a0b c", u8"[a\u00a0b ][c]");
+        LINE_BREAK_TEST(u8"a\u200bb", u8"[a\u200b][b]");
+        LINE_BREAK_TEST(u8"a \u0301b", u8"[a ][\u0301b]");
+        LINE_BREAK_TEST(u8"\u00adsoft\u00adhyphen", u8"[\u00ad][soft\u00ad][hyphen]");
+        LINE_BREAK_TEST(u8"\u2014dash\u2014word", u8"[\u2014][dash][\u2014][word]");
+        LINE_BREAK_TEST(u8"\u2014\u2014dash", u8"[\u2014\u2014][dash]");
+        LINE_BREAK_TEST(u8"\u65e5\u672c\u8a9e\u3002", u8"[\u65e5][\u672c][\u8a9e\u3002]");
+        LINE_BREAK_TEST(u8"\u300c\u65e5\u672c\u300d\u8a9e", u8"[\u300c\u65e5][\u672c\u300d][\u8a9e]");
+        LINE_BREAK_TEST(u8"\u3042\u3041\u3043", u8"[\u3042\u3041\u3043]");
+        LINE_BREAK_TEST(u8"\U0001f1ec\U0001f1e7\U0001f1eb\U0001f1f7", u8"[\U0001f1ec\U0001f1e7\U0001f1eb\U0001f1f7]");
+
+    }
+
+    #define SCRIPT_RUN_TEST(source, expect) \
+        do { \
+            auto s = cstr(source); \
+            decltype(script_run_range(s)) runs; \
+            TRY(runs = script_run_range(s)); \
+            decltype(s) result; \
+            for (auto i = runs.begin(); i != runs.end(); ++i) { \
+                str_append_char(result, '['); \
+                TRY(result += u_str(*i)); \
+                str_append_char(result, '='); \
+                TRY(result += script_abbr(i.script())); \
+                str_append_char(result, ']'); \
+            } \
+            TEST_EQUAL(result, expect); \
+        } while (false)
+
+    void check_script_run_segmentation() {
+
+        SCRIPT_RUN_TEST(u8"", u8"");
+        SCRIPT_RUN_TEST(u8"Hello world", u8"[Hello world=Latn]");
+        SCRIPT_RUN_TEST(u8"123 ...", u8"[123 ...=Zyyy]");
+        SCRIPT_RUN_TEST(u8"Hello \u043c\u0438\u0440", u8"[Hello =Latn][\u043c\u0438\u0440=Cyrl]");
+        SCRIPT_RUN_TEST(u8"1. Hello, \u043c\u0438\u0440!", u8"[1. Hello, =Latn][\u043c\u0438\u0440!=Cyrl]");
+        SCRIPT_RUN_TEST(u8"\u0301a\u0301 \u03b1\u0301", u8"[\u0301a\u0301 =Latn][\u03b1\u0301=Grek]");
+        SCRIPT_RUN_TEST(u8"Hello (\u043c\u0438\u0440) world", u8"[Hello (=Latn][\u043c\u0438\u0440=Cyrl][) world=Latn]");
+        SCRIPT_RUN_TEST(u8"a [\u03b1 (\u05d0) \u03b2] b", u8"[a [=Latn][\u03b1 (=Grek][\u05d0=Hebr][) \u03b2=Grek][] b=Latn]");
+        SCRIPT_RUN_TEST(u8"(\u043c\u0438\u0440)", u8"[(\u043c\u0438\u0440)=Cyrl]");
+        SCRIPT_RUN_TEST(u8"\u0915\u0964 \u0995\u0964", u8"[\u0915\u0964 =Deva][\u0995\u0964=Beng]");
+        SCRIPT_RUN_TEST(u8"\u3001\u3042\u30a2\u65e5", u8"[\u3001\u3042=Hira][\u30a2=Kana][\u65e5=Hani]");
+        SCRIPT_RUN_TEST(u8"\u0628\u060c \u0644", u8"[\u0628\u060c \u0644=Arab]");
+
+        const U8string buf = u8"<<abc\u03b1\u03b2\u03b3>>";
+        std::string_view text(buf.data() + 2, buf.size() - 4);
+        U8string result;
+        std::vector<Script> scripts;
+        auto runs = script_run_range(text);
+        for (auto i = runs.begin(); i != runs.end(); ++i) {
+            result += "[" + U8string(u_view(*i)) + "]";
+            scripts.push_back(i.script());
+        }
+        TEST_EQUAL(result, u8"[abc][\u03b1\u03b2\u03b3]");
+        TEST_EQUAL(scripts.size(), 2);
+        TEST(scripts == (std::vector<Script>{Script::Latn, Script::Grek}));
+
+    }
+
     void check_paragraph_segmentation() {
 
         BLOCK_SEGMENTATION_TEST(paragraph_range, 0, "", "", "");
@@ -279,6 +371,41 @@ namespace {
 
 }
 
+    void check_view_segmentation() {
+
+        // Segment a view into the middle of a larger string; no segment may
+        // extend past the ends of the view
+
+        const U8string buf = "<<Hello world.\r\nGoodbye.\n\nThe end>>";
+        std::string_view text(buf.data() + 2, buf.size() - 4);
+        U8string result;
+
+        auto segments = [&] (auto range) {
+            result.clear();
+            for (auto& subrange: range)
+                result += "[" + U8string(u_view(subrange)) + "]";
+            return result;
+        };
+
+        TEST_EQUAL(segments(grapheme_range(text.substr(0, 5))), "[H][e][l][l][o]");
+        TEST_EQUAL(segments(word_range(text)), "[Hello][ ][world][.][\r\n][Goodbye][.][\n][\n][The][ ][end]");
+        TEST_EQUAL(segments(word_range(text, Segment::alpha)), "[Hello][world][Goodbye][The][end]");
+        TEST_EQUAL(segments(sentence_range(text)), "[Hello world.\r\n][Goodbye.\n][\n][The end]");
+        TEST_EQUAL(segments(line_break_range(text)), "[Hello ][world.\r\n][Goodbye.\n][\n][The ][end]");
+        TEST_EQUAL(segments(line_range(text)), "[Hello world.\r\n][Goodbye.\n][\n][The end]");
+        TEST_EQUAL(segments(line_range(text, Segment::strip)), "[Hello world.][Goodbye.][][The end]");
+        TEST_EQUAL(segments(paragraph_range(text)), "[Hello world.\r\nGoodbye.\n\n][The end]");
+        TEST_EQUAL(segments(paragraph_range(utf_range(text), Segment::line | Segment::strip)), "[Hello world.][Goodbye.][][The end]");
+        TEST_THROW(word_range(text, Segment::graphic | Segment::alpha), std::invalid_argument);
+        TEST_THROW(line_range(text, Segment::keep | Segment::strip), std::invalid_argument);
+
+        auto words = word_range(text);
+        auto w = std::next(words.begin(), 2);
+        TEST_EQUAL(w->begin().offset(), 6);
+        TEST(w->begin().source().data() == buf.data() + 2);
+
+    }
+
 TEST_MODULE(unicorn, segment) {
 
     segmentation_test<SplitGraphemes>("Grapheme break test", UnicornDetail::grapheme_break_test_table);
@@ -287,6 +414,9 @@ TEST_MODULE(unicorn, segment) {
 
     check_word_segmentation();
     check_line_segmentation();
+    check_line_break_segmentation();
+    check_script_run_segmentation();
     check_paragraph_segmentation();
+    check_view_segmentation();
 
 }
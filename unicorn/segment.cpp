@@ -16,6 +16,48 @@ namespace RS::Unicorn {
                 return buf[i];
         }
 
+        // Rows and columns of the pair table, in the order used in UAX #14
+        // (classes resolved by LB1, and those handled outside the table, are -1)
+
+        constexpr int line_break_index[] = {
+            -1, -1, 12, 19, 17, 18, -1, -1, -1,  1,  // XX AI AL B2 BA BB BK CB CJ CL
+            21,  2, -1,  6,  4, 23, 24, 13, 16, 14,  // CM CP CR EX GL H2 H3 HL HY ID
+            15,  8, 25, 27, 26, -1, -1,  5, 11,  0,  // IN IS JL JT JV LF NL NS NU OP
+            10,  9,  3, 28, -1, -1, -1,  7, 22, 20,  // PO PR QU RI SA SG SP SY WJ ZW
+        };
+
+        constexpr const char* line_break_pairs[] = {
+            "^^^^^^^^^^^^^^^^^^^^^@^^^^^^^",  // OP
+            "_^^%%^^^^%%_____%%__^#^______",  // CL
+            "_^^%%^^^^%%%%%__%%__^#^______",  // CP
+            "^^^%%%^^^%%%%%%%%%%%^#^%%%%%%",  // QU
+            "%^^%%%^^^%%%%%%%%%%%^#^%%%%%%",  // GL
+            "_^^%%%^^^_______%%__^#^______",  // NS
+            "_^^%%%^^^______%%%__^#^______",  // EX
+            "_^^%%%^^^__%_%__%%__^#^______",  // SY
+            "_^^%%%^^^__%%%__%%__^#^______",  // IS
+            "%^^%%%^^^__%%%%_%%__^#^%%%%%_",  // PR
+            "%^^%%%^^^__%%%__%%__^#^______",  // PO
+            "%^^%%%^^^%%%%%_%%%__^#^______",  // NU
+            "%^^%%%^^^__%%%_%%%__^#^______",  // AL
+            "%^^%%%^^^__%%%_%%%__^#^______",  // HL
+            "_^^%%%^^^_%____%%%__^#^______",  // ID
+            "_^^%%%^^^______%%%__^#^______",  // IN
+            "_^^%_%^^^__%____%%__^#^______",  // HY
+            "_^^%_%^^^_______%%__^#^______",  // BA
+            "%^^%%%^^^%%%%%%%%%%%^#^%%%%%%",  // BB
+            "_^^%%%^^^_______%%_^^#^______",  // B2
+            "____________________^________",  // ZW
+            "%^^%%%^^^__%%%_%%%__^#^______",  // CM
+            "%^^%%%^^^%%%%%%%%%%%^#^%%%%%%",  // WJ
+            "_^^%%%^^^_%____%%%__^#^___%%_",  // H2
+            "_^^%%%^^^_%____%%%__^#^____%_",  // H3
+            "_^^%%%^^^_%____%%%__^#^%%%%__",  // JL
+            "_^^%%%^^^_%____%%%__^#^___%%_",  // JV
+            "_^^%%%^^^_%____%%%__^#^____%_",  // JT
+            "_^^%%%^^^_______%%__^#^_____%",  // RI
+        };
+
     }
 
     namespace UnicornDetail {
@@ -288,6 +330,32 @@ namespace RS::Unicorn {
             return 0;
         }
 
+        // Unicode Standard Annex #14: Unicode Line Breaking Algorithm
+        // http://www.unicode.org/reports/tr14
+
+        Line_Break resolved_line_break(char32_t c) noexcept {
+            using LB = Line_Break;
+            // LB1. Assign a line breaking class to each code point of the input.
+            // Resolve AI, CB, CJ, SA, SG, and XX into other line breaking classes.
+            auto lb = line_break(c);
+            switch (lb) {
+                case LB::AI:
+                case LB::SG:
+                case LB::XX:  return LB::AL;
+                case LB::CB:  return LB::ID;
+                case LB::CJ:  return LB::NS;
+                case LB::SA:  return char_general_category(c) == GC::Mn || char_general_category(c) == GC::Mc ? LB::CM : LB::AL;
+                default:      return lb;
+            }
+        }
+
+        LineBreakAction line_break_action(Line_Break before, Line_Break after) noexcept {
+            int i = line_break_index[int(before)], j = line_break_index[int(after)];
+            if (i < 0 || j < 0)
+                return LineBreakAction::indirect;
+            return LineBreakAction(line_break_pairs[i][j]);
+        }
+
     }
 
 }
@@ -4,10 +4,12 @@
 #include "unicorn/character.hpp"
 #include "unicorn/utf.hpp"
 #include <algorithm>
+#include <array>
 #include <deque>
 #include <iterator>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <utility>
 
 namespace RS::Unicorn {
@@ -26,7 +28,10 @@ namespace RS::Unicorn {
 
     };
 
-    // Common base template for grapheme, word, and sentence iterators
+    // Common base template for grapheme, word, and sentence iterators. The
+    // segment iterators are templated on the underlying UTF iterator, so
+    // the same code serves strings (UtfIterator) and string views
+    // (UtfViewIterator).
 
     namespace UnicornDetail {
 
@@ -39,11 +44,11 @@ namespace RS::Unicorn {
 
     }
 
-    template <typename C, typename Property, UnicornDetail::PropertyQuery<Property> PQ, UnicornDetail::SegmentFunction<Property> SF>
+    template <typename UI, typename Property, UnicornDetail::PropertyQuery<Property> PQ, UnicornDetail::SegmentFunction<Property> SF>
     class BasicSegmentIterator:
-    public ForwardIterator<BasicSegmentIterator<C, Property, PQ, SF>, const Irange<UtfIterator<C>>> {
+    public ForwardIterator<BasicSegmentIterator<UI, Property, PQ, SF>, const Irange<UI>> {
     public:
-        using utf_iterator = UtfIterator<C>;
+        using utf_iterator = UI;
         BasicSegmentIterator() noexcept {}
         BasicSegmentIterator(const utf_iterator& i, const utf_iterator& j, uint32_t flags):
             seg{i, i}, ends(j), next(i), bufsize(initsize), mode(flags) { ++*this; }
@@ -62,8 +67,8 @@ namespace RS::Unicorn {
         bool select_segment() const noexcept;
     };
 
-    template <typename C, typename Property, UnicornDetail::PropertyQuery<Property> PQ, UnicornDetail::SegmentFunction<Property> SF>
-    BasicSegmentIterator<C, Property, PQ, SF>& BasicSegmentIterator<C, Property, PQ, SF>::operator++() noexcept {
+    template <typename UI, typename Property, UnicornDetail::PropertyQuery<Property> PQ, UnicornDetail::SegmentFunction<Property> SF>
+    BasicSegmentIterator<UI, Property, PQ, SF>& BasicSegmentIterator<UI, Property, PQ, SF>::operator++() noexcept {
         do {
             seg.first = seg.second;
             if (seg.first == ends)
@@ -85,8 +90,8 @@ namespace RS::Unicorn {
         return *this;
     }
 
-    template <typename C, typename Property, UnicornDetail::PropertyQuery<Property> PQ, UnicornDetail::SegmentFunction<Property> SF>
-    bool BasicSegmentIterator<C, Property, PQ, SF>::select_segment() const noexcept {
+    template <typename UI, typename Property, UnicornDetail::PropertyQuery<Property> PQ, UnicornDetail::SegmentFunction<Property> SF>
+    bool BasicSegmentIterator<UI, Property, PQ, SF>::select_segment() const noexcept {
         if (mode & Segment::graphic)
             return std::find_if_not(seg.begin(), seg.end(), char_is_white_space) != seg.end();
         else if (mode & Segment::alpha)
@@ -97,7 +102,9 @@ namespace RS::Unicorn {
 
     // Grapheme cluster boundaries
 
-    template <typename C> using GraphemeIterator = BasicSegmentIterator<C, Grapheme_Cluster_Break, grapheme_cluster_break, UnicornDetail::find_grapheme_break>;
+    template <typename UI> using BasicGraphemeIterator = BasicSegmentIterator<UI, Grapheme_Cluster_Break, grapheme_cluster_break, UnicornDetail::find_grapheme_break>;
+    template <typename C> using GraphemeIterator = BasicGraphemeIterator<UtfIterator<C>>;
+    template <typename C> using GraphemeViewIterator = BasicGraphemeIterator<UtfViewIterator<C>>;
 
     template <typename C> Irange<GraphemeIterator<C>>
     grapheme_range(const UtfIterator<C>& i, const UtfIterator<C>& j) {
@@ -114,14 +121,39 @@ namespace RS::Unicorn {
         return grapheme_range(utf_range(source));
     }
 
+    template <typename C> Irange<GraphemeViewIterator<C>>
+    grapheme_range(const UtfViewIterator<C>& i, const UtfViewIterator<C>& j) {
+        return {{i, j, {}}, {j, j, {}}};
+    }
+
+    template <typename C> Irange<GraphemeViewIterator<C>>
+    grapheme_range(const Irange<UtfViewIterator<C>>& source) {
+        return grapheme_range(source.begin(), source.end());
+    }
+
+    template <typename C> Irange<GraphemeViewIterator<C>>
+    grapheme_range(std::basic_string_view<C> source) {
+        return grapheme_range(utf_range(source));
+    }
+
     // Word boundaries
 
-    template <typename C> using WordIterator = BasicSegmentIterator<C, Word_Break, word_break, UnicornDetail::find_word_break>;
+    namespace UnicornDetail {
+
+        inline void check_word_flags(uint32_t flags) {
+            if (ibits(flags & (Segment::unicode | Segment::graphic | Segment::alpha)) > 1)
+                throw std::invalid_argument("Inconsistent word breaking flags");
+        }
+
+    }
+
+    template <typename UI> using BasicWordIterator = BasicSegmentIterator<UI, Word_Break, word_break, UnicornDetail::find_word_break>;
+    template <typename C> using WordIterator = BasicWordIterator<UtfIterator<C>>;
+    template <typename C> using WordViewIterator = BasicWordIterator<UtfViewIterator<C>>;
 
     template <typename C> Irange<WordIterator<C>>
     word_range(const UtfIterator<C>& i, const UtfIterator<C>& j, uint32_t flags = 0) {
-        if (ibits(flags & (Segment::unicode | Segment::graphic | Segment::alpha)) > 1)
-            throw std::invalid_argument("Inconsistent word breaking flags");
+        UnicornDetail::check_word_flags(flags);
         return {{i, j, flags}, {j, j, flags}};
     }
 
@@ -135,9 +167,27 @@ namespace RS::Unicorn {
         return word_range(utf_range(source), flags);
     }
 
+    template <typename C> Irange<WordViewIterator<C>>
+    word_range(const UtfViewIterator<C>& i, const UtfViewIterator<C>& j, uint32_t flags = 0) {
+        UnicornDetail::check_word_flags(flags);
+        return {{i, j, flags}, {j, j, flags}};
+    }
+
+    template <typename C> Irange<WordViewIterator<C>>
+    word_range(const Irange<UtfViewIterator<C>>& source, uint32_t flags = 0) {
+        return word_range(source.begin(), source.end(), flags);
+    }
+
+    template <typename C> Irange<WordViewIterator<C>>
+    word_range(std::basic_string_view<C> source, uint32_t flags = 0) {
+        return word_range(utf_range(source), flags);
+    }
+
     // Sentence boundaries
 
-    template <typename C> using SentenceIterator = BasicSegmentIterator<C, Sentence_Break, sentence_break, UnicornDetail::find_sentence_break>;
+    template <typename UI> using BasicSentenceIterator = BasicSegmentIterator<UI, Sentence_Break, sentence_break, UnicornDetail::find_sentence_break>;
+    template <typename C> using SentenceIterator = BasicSentenceIterator<UtfIterator<C>>;
+    template <typename C> using SentenceViewIterator = BasicSentenceIterator<UtfViewIterator<C>>;
 
     template <typename C> Irange<SentenceIterator<C>>
     sentence_range(const UtfIterator<C>& i, const UtfIterator<C>& j) {
@@ -154,21 +204,299 @@ namespace RS::Unicorn {
         return sentence_range(utf_range(source));
     }
 
+    template <typename C> Irange<SentenceViewIterator<C>>
+    sentence_range(const UtfViewIterator<C>& i, const UtfViewIterator<C>& j) {
+        return {{i, j, {}}, {j, j, {}}};
+    }
+
+    template <typename C> Irange<SentenceViewIterator<C>>
+    sentence_range(const Irange<UtfViewIterator<C>>& source) {
+        return sentence_range(source.begin(), source.end());
+    }
+
+    template <typename C> Irange<SentenceViewIterator<C>>
+    sentence_range(std::basic_string_view<C> source) {
+        return sentence_range(utf_range(source));
+    }
+
+    // Line break opportunities
+
+    namespace UnicornDetail {
+
+        // Actions from the UAX #14 pair table, keyed by the symbols used in
+        // the table in the standard
+
+        enum class LineBreakAction: char {
+            direct                = '_',  // Break allowed
+            indirect              = '%',  // Break allowed only if spaces intervene
+            combining_indirect    = '#',  // Combining mark: break allowed only after spaces, otherwise attach to base
+            combining_prohibited  = '@',  // Combining mark: no break, attach to base
+            prohibited            = '^',  // No break, even if spaces intervene
+        };
+
+        Line_Break resolved_line_break(char32_t c) noexcept;
+        LineBreakAction line_break_action(Line_Break before, Line_Break after) noexcept;
+
+    }
+
+    template <typename UI>
+    class BasicLineBreakIterator:
+    public ForwardIterator<BasicLineBreakIterator<UI>, const Irange<UI>> {
+    public:
+        using utf_iterator = UI;
+        BasicLineBreakIterator() = default;
+        BasicLineBreakIterator(const utf_iterator& i, const utf_iterator& j) noexcept;
+        const Irange<utf_iterator>& operator*() const noexcept { return seg; }
+        BasicLineBreakIterator& operator++() noexcept;
+        bool operator==(const BasicLineBreakIterator& rhs) const noexcept { return seg.begin() == rhs.seg.begin(); }
+        bool mandatory() const noexcept { return hard; }
+    private:
+        Irange<utf_iterator> seg;         // Iterator pair marking current segment
+        utf_iterator ends;                // End of source string
+        Line_Break cls = Line_Break::XX;  // Class of last character, after combining marks and spaces
+        Line_Break prev = Line_Break::XX; // Class of the character immediately before the current position
+        bool hard = false;                // Segment ends with a mandatory break
+        void start(Line_Break lb) noexcept;
+    };
+
+    template <typename UI>
+    BasicLineBreakIterator<UI>::BasicLineBreakIterator(const utf_iterator& i, const utf_iterator& j) noexcept:
+    seg{i, i}, ends(j) {
+        if (i != j) {
+            start(UnicornDetail::resolved_line_break(*i));
+            ++*this;
+        }
+    }
+
+    template <typename UI>
+    BasicLineBreakIterator<UI>& BasicLineBreakIterator<UI>::operator++() noexcept {
+        using namespace UnicornDetail;
+        using Act = LineBreakAction;
+        using LB = Line_Break;
+        seg.first = seg.second;
+        hard = false;
+        if (seg.first == ends)
+            return *this;
+        auto i = std::next(seg.first);
+        for (; i != ends; ++i) {
+            auto lb = resolved_line_break(*i);
+            // LB4-5. Always break after hard line breaks (but never between CR and LF)
+            if (cls == LB::BK || (cls == LB::CR && lb != LB::LF)) {
+                hard = true;
+                start(lb);
+                break;
+            }
+            bool after_space = prev == LB::SP;
+            prev = lb;
+            // LB6-7. Do not break before hard line breaks or spaces
+            if (lb == LB::SP)
+                continue;
+            if (lb == LB::BK || lb == LB::LF || lb == LB::NL) {
+                cls = LB::BK;
+                continue;
+            }
+            if (lb == LB::CR) {
+                cls = LB::CR;
+                continue;
+            }
+            auto act = line_break_action(cls, lb);
+            bool brk = act == Act::direct || (after_space && (act == Act::indirect || act == Act::combining_indirect));
+            // LB9-10. Combining marks take the class of their base character,
+            // unless they follow a space, in which case they are treated as AL
+            if ((act != Act::combining_indirect && act != Act::combining_prohibited) || after_space)
+                cls = lb;
+            if (brk)
+                break;
+        }
+        if (i == ends)
+            hard = cls == LB::BK || cls == LB::CR;
+        seg.second = i;
+        return *this;
+    }
+
+    template <typename UI>
+    void BasicLineBreakIterator<UI>::start(Line_Break lb) noexcept {
+        // LB2. Never break at the start of text (or of a line)
+        prev = lb;
+        if (lb == Line_Break::SP)
+            cls = Line_Break::WJ;
+        else if (lb == Line_Break::LF || lb == Line_Break::NL)
+            cls = Line_Break::BK;
+        else
+            cls = lb;
+    }
+
+    template <typename C> using LineBreakIterator = BasicLineBreakIterator<UtfIterator<C>>;
+    template <typename C> using LineBreakViewIterator = BasicLineBreakIterator<UtfViewIterator<C>>;
+
+    template <typename C> Irange<LineBreakIterator<C>>
+    line_break_range(const UtfIterator<C>& i, const UtfIterator<C>& j) {
+        return {{i, j}, {j, j}};
+    }
+
+    template <typename C> Irange<LineBreakIterator<C>>
+    line_break_range(const Irange<UtfIterator<C>>& source) {
+        return line_break_range(source.begin(), source.end());
+    }
+
+    template <typename C> Irange<LineBreakIterator<C>>
+    line_break_range(const std::basic_string<C>& source) {
+        return line_break_range(utf_range(source));
+    }
+
+    template <typename C> Irange<LineBreakViewIterator<C>>
+    line_break_range(const UtfViewIterator<C>& i, const UtfViewIterator<C>& j) {
+        return {{i, j}, {j, j}};
+    }
+
+    template <typename C> Irange<LineBreakViewIterator<C>>
+    line_break_range(const Irange<UtfViewIterator<C>>& source) {
+        return line_break_range(source.begin(), source.end());
+    }
+
+    template <typename C> Irange<LineBreakViewIterator<C>>
+    line_break_range(std::basic_string_view<C> source) {
+        return line_break_range(utf_range(source));
+    }
+
+    // Script runs
+
+    template <typename UI>
+    class BasicScriptRunIterator:
+    public ForwardIterator<BasicScriptRunIterator<UI>, const Irange<UI>> {
+    public:
+        using utf_iterator = UI;
+        BasicScriptRunIterator() = default;
+        BasicScriptRunIterator(const utf_iterator& i, const utf_iterator& j) noexcept: seg{i, i}, ends(j) { ++*this; }
+        const Irange<utf_iterator>& operator*() const noexcept { return seg; }
+        BasicScriptRunIterator& operator++() noexcept;
+        bool operator==(const BasicScriptRunIterator& rhs) const noexcept { return seg.begin() == rhs.seg.begin(); }
+        Script script() const noexcept { return sc; }
+    private:
+        struct bracket {
+            char32_t close;  // Matching closing bracket
+            size_t run;      // Run containing the opening bracket
+            Script script;   // Script of that run, once resolved
+        };
+        static constexpr size_t max_brackets = 16;
+        Irange<utf_iterator> seg;                      // Iterator pair marking current run
+        utf_iterator ends;                             // End of source string
+        Script sc = Script::Zzzz;                      // Script of current run
+        size_t run = 0;                                // Serial number of current run
+        std::array<bracket, max_brackets> brackets{};  // Stack of open paired brackets
+        size_t depth = 0;                              // Number of open brackets
+        size_t find_bracket(char32_t c) const noexcept;
+    };
+
+    template <typename UI>
+    BasicScriptRunIterator<UI>& BasicScriptRunIterator<UI>::operator++() noexcept {
+        seg.first = seg.second;
+        if (seg.first == ends)
+            return *this;
+        ++run;
+        // The run's candidate scripts are narrowed down by each character's
+        // script extensions; Common and Inherited characters with no
+        // extensions do not constrain the run. The run ends before the first
+        // character that has no script in common with it.
+        static constexpr ScriptSet any = ~ ScriptSet();
+        ScriptSet cand = any;
+        auto i = seg.first;
+        for (; i != ends; ++i) {
+            char32_t c = *i;
+            auto id = char_script_id(c);
+            auto set = char_script_extensions(c);
+            char type = 'n';
+            size_t match = depth;
+            if (id == Script::Zyyy || id == Script::Zinh) {
+                if (set == ScriptSet(id))
+                    set = any;
+                if (id == Script::Zyyy)
+                    type = bidi_paired_bracket_type(c);
+                // A closing bracket takes the script of its opening bracket
+                if (type == 'c') {
+                    match = find_bracket(c);
+                    if (match < depth && brackets[match].run != run && brackets[match].script != Script::Zyyy)
+                        set = ScriptSet(brackets[match].script);
+                }
+            }
+            auto next = cand & set;
+            if (next.empty())
+                break;
+            cand = next;
+            if (type == 'o') {
+                if (depth == max_brackets) {
+                    std::copy(brackets.begin() + 1, brackets.end(), brackets.begin());
+                    --depth;
+                }
+                brackets[depth++] = {bidi_paired_bracket(c), run, Script::Zyyy};
+            } else if (match < depth) {
+                depth = match;
+            }
+        }
+        seg.second = i;
+        sc = cand == any ? Script::Zyyy : cand.first();
+        for (size_t j = 0; j < depth; ++j)
+            if (brackets[j].run == run)
+                brackets[j].script = sc;
+        return *this;
+    }
+
+    template <typename UI>
+    size_t BasicScriptRunIterator<UI>::find_bracket(char32_t c) const noexcept {
+        for (size_t j = depth; j > 0; --j)
+            if (brackets[j - 1].close == c)
+                return j - 1;
+        return depth;
+    }
+
+    template <typename C> using ScriptRunIterator = BasicScriptRunIterator<UtfIterator<C>>;
+    template <typename C> using ScriptRunViewIterator = BasicScriptRunIterator<UtfViewIterator<C>>;
+
+    template <typename C> Irange<ScriptRunIterator<C>>
+    script_run_range(const UtfIterator<C>& i, const UtfIterator<C>& j) {
+        return {{i, j}, {j, j}};
+    }
+
+    template <typename C> Irange<ScriptRunIterator<C>>
+    script_run_range(const Irange<UtfIterator<C>>& source) {
+        return script_run_range(source.begin(), source.end());
+    }
+
+    template <typename C> Irange<ScriptRunIterator<C>>
+    script_run_range(const std::basic_string<C>& source) {
+        return script_run_range(utf_range(source));
+    }
+
+    template <typename C> Irange<ScriptRunViewIterator<C>>
+    script_run_range(const UtfViewIterator<C>& i, const UtfViewIterator<C>& j) {
+        return {{i, j}, {j, j}};
+    }
+
+    template <typename C> Irange<ScriptRunViewIterator<C>>
+    script_run_range(const Irange<UtfViewIterator<C>>& source) {
+        return script_run_range(source.begin(), source.end());
+    }
+
+    template <typename C> Irange<ScriptRunViewIterator<C>>
+    script_run_range(std::basic_string_view<C> source) {
+        return script_run_range(utf_range(source));
+    }
+
     // Common base template for line and paragraph iterators
 
     namespace UnicornDetail {
 
         // This takes a pair of UTF iterators marking the current position and
         // the end of the subject string, and returns a pair delimiting the
-        // end-of-block marker.
+        // end-of-block marker. UI is either UtfIterator or UtfViewIterator.
 
-        template <typename C> using FindBlockFunction = Irange<UtfIterator<C>> (*)(const UtfIterator<C>&, const UtfIterator<C>&);
+        template <typename UI> using FindBlockFunction = Irange<UI> (*)(const UI&, const UI&);
 
         inline bool is_restricted_line_break(char32_t c) { return c == U'\n' || c == U'\v' || c == U'\r' || c == 0x85; }
         inline bool is_basic_para_break(char32_t c) { return is_restricted_line_break(c) || c == paragraph_separator_char; }
 
-        template <typename C>
-        Irange<UtfIterator<C>> find_end_of_line(const UtfIterator<C>& current, const UtfIterator<C>& endstr) {
+        template <typename UI>
+        Irange<UI> find_end_of_line(const UI& current, const UI& endstr) {
             auto i = std::find_if(current, endstr, char_is_line_break);
             auto j = i;
             if (j != endstr)
@@ -178,8 +506,8 @@ namespace RS::Unicorn {
             return {i, j};
         }
 
-        template <typename C>
-        Irange<UtfIterator<C>> find_basic_para(const UtfIterator<C>& current, const UtfIterator<C>& endstr) {
+        template <typename UI>
+        Irange<UI> find_basic_para(const UI& current, const UI& endstr) {
             auto i = std::find_if(current, endstr, is_basic_para_break);
             auto j = i;
             if (j != endstr)
@@ -189,10 +517,10 @@ namespace RS::Unicorn {
             return {i, j};
         }
 
-        template <typename C>
-        Irange<UtfIterator<C>> find_multiline_para(const UtfIterator<C>& current, const UtfIterator<C>& endstr) {
+        template <typename UI>
+        Irange<UI> find_multiline_para(const UI& current, const UI& endstr) {
             auto from = current;
-            UtfIterator<C> i, j;
+            UI i, j;
             for (;;) {
                 i = j = std::find_if(from, endstr, char_is_line_break);
                 if (i == endstr)
@@ -220,8 +548,8 @@ namespace RS::Unicorn {
             return {i, j};
         }
 
-        template <typename C>
-        Irange<UtfIterator<C>> find_unicode_para(const UtfIterator<C>& current, const UtfIterator<C>& endstr) {
+        template <typename UI>
+        Irange<UI> find_unicode_para(const UI& current, const UI& endstr) {
             auto i = std::find(current, endstr, paragraph_separator_char);
             auto j = i;
             if (j != endstr)
@@ -231,13 +559,13 @@ namespace RS::Unicorn {
 
     }
 
-    template <typename C>
+    template <typename UI>
     class BlockSegmentIterator:
-    public ForwardIterator<BlockSegmentIterator<C>, const Irange<UtfIterator<C>>> {
+    public ForwardIterator<BlockSegmentIterator<UI>, const Irange<UI>> {
     private:
-        using find_block = UnicornDetail::FindBlockFunction<C>;
+        using find_block = UnicornDetail::FindBlockFunction<UI>;
     public:
-        using utf_iterator = UtfIterator<C>;
+        using utf_iterator = UI;
         BlockSegmentIterator() = default;
         BlockSegmentIterator(const utf_iterator& i, const utf_iterator& j, uint32_t flags, find_block f) noexcept:
             next(i), ends(j), mode(flags), find(f) { ++*this; }
@@ -252,8 +580,8 @@ namespace RS::Unicorn {
         find_block find = nullptr;  // Find end of block
     };
 
-    template <typename C>
-    BlockSegmentIterator<C>& BlockSegmentIterator<C>::operator++() noexcept {
+    template <typename UI>
+    BlockSegmentIterator<UI>& BlockSegmentIterator<UI>::operator++() noexcept {
         seg.first = seg.second = next;
         if (next == ends)
             return *this;
@@ -266,53 +594,102 @@ namespace RS::Unicorn {
 
     // Line boundaries
 
-    template <typename C> using LineIterator = BlockSegmentIterator<C>;
+    namespace UnicornDetail {
+
+        template <typename UI>
+        Irange<BlockSegmentIterator<UI>> make_line_range(const UI& i, const UI& j, uint32_t flags) {
+            if (ibits(flags & (Segment::keep | Segment::strip)) > 1)
+                throw std::invalid_argument("Inconsistent line breaking flags");
+            FindBlockFunction<UI> f = find_end_of_line;
+            return {{i, j, flags, f}, {j, j, flags, f}};
+        }
+
+    }
+
+    template <typename C> using LineIterator = BlockSegmentIterator<UtfIterator<C>>;
+    template <typename C> using LineViewIterator = BlockSegmentIterator<UtfViewIterator<C>>;
 
     template <typename C>
-    Irange<BlockSegmentIterator<C>> line_range(const UtfIterator<C>& i, const UtfIterator<C>& j, uint32_t flags = 0) {
-        using namespace UnicornDetail;
-        if (ibits(flags & (Segment::keep | Segment::strip)) > 1)
-            throw std::invalid_argument("Inconsistent line breaking flags");
-        return {{i, j, flags, find_end_of_line}, {j, j, flags, find_end_of_line}};
+    Irange<LineIterator<C>> line_range(const UtfIterator<C>& i, const UtfIterator<C>& j, uint32_t flags = 0) {
+        return UnicornDetail::make_line_range(i, j, flags);
+    }
+
+    template <typename C>
+    Irange<LineIterator<C>> line_range(const Irange<UtfIterator<C>>& source, uint32_t flags = 0) {
+        return line_range(source.begin(), source.end(), flags);
     }
 
     template <typename C>
-    Irange<BlockSegmentIterator<C>> line_range(const Irange<UtfIterator<C>>& source, uint32_t flags = 0) {
+    Irange<LineIterator<C>> line_range(const std::basic_string<C>& source, uint32_t flags = 0) {
+        return line_range(utf_range(source), flags);
+    }
+
+    template <typename C>
+    Irange<LineViewIterator<C>> line_range(const UtfViewIterator<C>& i, const UtfViewIterator<C>& j, uint32_t flags = 0) {
+        return UnicornDetail::make_line_range(i, j, flags);
+    }
+
+    template <typename C>
+    Irange<LineViewIterator<C>> line_range(const Irange<UtfViewIterator<C>>& source, uint32_t flags = 0) {
         return line_range(source.begin(), source.end(), flags);
     }
 
     template <typename C>
-    Irange<BlockSegmentIterator<C>> line_range(const std::basic_string<C>& source, uint32_t flags = 0) {
+    Irange<LineViewIterator<C>> line_range(std::basic_string_view<C> source, uint32_t flags = 0) {
         return line_range(utf_range(source), flags);
     }
 
     // Paragraph boundaries
 
-    template <typename C> using ParagraphIterator = BlockSegmentIterator<C>;
+    namespace UnicornDetail {
+
+        template <typename UI>
+        Irange<BlockSegmentIterator<UI>> make_paragraph_range(const UI& i, const UI& j, uint32_t flags) {
+            if (ibits(flags & (Segment::keep | Segment::strip)) > 1
+                    || ibits(flags & (Segment::multiline | Segment::line | Segment::unicode)) > 1)
+                throw std::invalid_argument("Inconsistent paragraph breaking flags");
+            FindBlockFunction<UI> f;
+            if (flags & Segment::unicode)
+                f = find_unicode_para;
+            else if (flags & Segment::line)
+                f = find_basic_para;
+            else
+                f = find_multiline_para;
+            return {{i, j, flags, f}, {j, j, flags, f}};
+        }
+
+    }
+
+    template <typename C> using ParagraphIterator = BlockSegmentIterator<UtfIterator<C>>;
+    template <typename C> using ParagraphViewIterator = BlockSegmentIterator<UtfViewIterator<C>>;
 
     template <typename C>
-    Irange<BlockSegmentIterator<C>> paragraph_range(const UtfIterator<C>& i, const UtfIterator<C>& j, uint32_t flags = 0) {
-        using namespace UnicornDetail;
-        if (ibits(flags & (Segment::keep | Segment::strip)) > 1
-                || ibits(flags & (Segment::multiline | Segment::line | Segment::unicode)) > 1)
-            throw std::invalid_argument("Inconsistent paragraph breaking flags");
-        FindBlockFunction<C> f;
-        if (flags & Segment::unicode)
-            f = find_unicode_para;
-        else if (flags & Segment::line)
-            f = find_basic_para;
-        else
-            f = find_multiline_para;
-        return {{i, j, flags, f}, {j, j, flags, f}};
+    Irange<ParagraphIterator<C>> paragraph_range(const UtfIterator<C>& i, const UtfIterator<C>& j, uint32_t flags = 0) {
+        return UnicornDetail::make_paragraph_range(i, j, flags);
+    }
+
+    template <typename C>
+    Irange<ParagraphIterator<C>> paragraph_range(const Irange<UtfIterator<C>>& source, uint32_t flags = 0) {
+        return paragraph_range(source.begin(), source.end(), flags);
+    }
+
+    template <typename C>
+    Irange<ParagraphIterator<C>> paragraph_range(const std::basic_string<C>& source, uint32_t flags = 0) {
+        return paragraph_range(utf_range(source), flags);
+    }
+
+    template <typename C>
+    Irange<ParagraphViewIterator<C>> paragraph_range(const UtfViewIterator<C>& i, const UtfViewIterator<C>& j, uint32_t flags = 0) {
+        return UnicornDetail::make_paragraph_range(i, j, flags);
     }
 
     template <typename C>
-    Irange<BlockSegmentIterator<C>> paragraph_range(const Irange<UtfIterator<C>>& source, uint32_t flags = 0) {
+    Irange<ParagraphViewIterator<C>> paragraph_range(const Irange<UtfViewIterator<C>>& source, uint32_t flags = 0) {
         return paragraph_range(source.begin(), source.end(), flags);
     }
 
     template <typename C>
-    Irange<BlockSegmentIterator<C>> paragraph_range(const std::basic_string<C>& source, uint32_t flags = 0) {
+    Irange<ParagraphViewIterator<C>> paragraph_range(std::basic_string_view<C> source, uint32_t flags = 0) {
         return paragraph_range(utf_range(source), flags);
     }
 
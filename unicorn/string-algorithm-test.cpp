@@ -4,6 +4,8 @@
 #include "unicorn/utf.hpp"
 #include "rs-core/unit-test.hpp"
 #include <iterator>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 
 using namespace RS;
@@ -12,6 +14,81 @@ using namespace std::literals;
 
 namespace {
 
+    void check_character_sets() {
+
+        CharSet set;
+        CharMap map;
+        U8string s;
+        Utf8Iterator i;
+
+        TEST(set.empty());
+        TEST(! set(U'a'));
+
+        TRY(set = CharSet(u8"aeiou€∈"));
+        TEST(! set.empty());
+        TEST(set(U'a'));
+        TEST(set(U'u'));
+        TEST(! set(U'b'));
+        TEST(! set(U'A'));
+        TEST(set(U'€'));
+        TEST(set(U'∈'));
+        TEST(! set(U'∉'));
+        TEST(! set(0x10ffff));
+
+        TRY(set.insert(U'α', U'ω'));
+        TEST(set(U'α'));
+        TEST(set(U'λ'));
+        TEST(set(U'ω'));
+        TEST(! set(U'ϊ'));
+        TRY(set.insert(U'ϊ'));
+        TEST(set(U'ϊ'));
+        TRY(set.insert(0x10fff0, 0xffffffff));
+        TEST(set(0x10ffff));
+        TEST(! set(0x110000));
+
+        TRY(set = CharSet(char_is_white_space));
+        TEST(set(U' '));
+        TEST(set(U'\t'));
+        TEST(set(0x2028));
+        TEST(set(0x3000));
+        TEST(! set(U'x'));
+        TEST(! set(0x200b));
+
+        TRY(set = CharSet(GC::Lu));
+        TEST(set(U'A'));
+        TEST(set(U'Z'));
+        TEST(set(U'Ä'));
+        TEST(set(U'Ω'));
+        TEST(! set(U'a'));
+        TEST(! set(U'ω'));
+
+        s = u8"€uro ∈lement";
+        TRY(set = CharSet(u8"€∈"));
+        TRY(i = str_find_first_of(s, set));             TEST_EQUAL(std::distance(utf_begin(s), i), 0);
+        TRY(i = str_find_first_not_of(s, set));         TEST_EQUAL(std::distance(utf_begin(s), i), 1);
+        TRY(i = str_find_last_of(utf_range(s), set));   TEST_EQUAL(std::distance(utf_begin(s), i), 5);
+        TRY(i = str_find_last_not_of(s, set));          TEST_EQUAL(std::distance(utf_begin(s), i), 11);
+        TRY(set = CharSet(GC::Ll));
+        TRY(i = str_find_first_not_of(utf_begin(s), utf_end(s), set));  TEST_EQUAL(std::distance(utf_begin(s), i), 0);
+        TRY(i = str_find_first_of(utf_begin(s), utf_end(s), set));      TEST_EQUAL(std::distance(utf_begin(s), i), 1);
+        TRY(i = str_find_last_not_of(utf_begin(s), utf_end(s), set));   TEST_EQUAL(std::distance(utf_begin(s), i), 5);
+
+        TEST(map.empty());
+        TEST_EQUAL(map(U'a'), U'a');
+        TEST_EQUAL(map(U'€'), U'€');
+        TRY(map = CharMap(u8"abc€a", u8"xyz∇"));
+        TEST(! map.empty());
+        TEST_EQUAL(map(U'a'), U'x');
+        TEST_EQUAL(map(U'b'), U'y');
+        TEST_EQUAL(map(U'c'), U'z');
+        TEST_EQUAL(map(U'd'), U'd');
+        TEST_EQUAL(map(U'€'), U'∇');
+        TEST_EQUAL(map(U'∈'), U'∈');
+        TRY(map.insert(U'∈', U'e'));
+        TEST_EQUAL(map(U'∈'), U'e');
+
+    }
+
     void check_common() {
 
         U8string a, b = "Hello", c = "Hello world", d = "Hellfire", e = "Goodbye";
@@ -151,6 +228,71 @@ namespace {
         ofs = 21;  TEST_EQUAL(s3[ofs], '\n');  TRY(lc = str_line_column(s3, ofs));  TEST_EQUAL(lc.first, 2);  TEST_EQUAL(lc.second, 9);
         ofs = 22;  TEST_EQUAL(s3[ofs], '\0');  TRY(lc = str_line_column(s3, ofs));  TEST_EQUAL(lc.first, 3);  TEST_EQUAL(lc.second, 1);
 
+        LineIndex index;
+
+        TEST(! (std::is_constructible<LineIndex, U8string&&>::value));
+        TEST((std::is_constructible<LineIndex, const U8string&>::value));
+        TEST((std::is_constructible<LineIndex, std::string_view, uint32_t>::value));
+
+        TEST_EQUAL(index.lines(), 0);
+        TEST_EQUAL(index.line_offset(1), npos);
+
+        TRY(index = LineIndex(s0));
+        TEST_EQUAL(index.lines(), 1);
+        TRY(lc = index.line_column(0));  TEST_EQUAL(lc.first, 1);  TEST_EQUAL(lc.second, 1);
+
+        TRY(index = LineIndex(s1));
+        TEST_EQUAL(index.lines(), 1);
+        TRY(lc = index.line_column(0));   TEST_EQUAL(lc.first, 1);  TEST_EQUAL(lc.second, 1);
+        TRY(lc = index.line_column(10));  TEST_EQUAL(lc.first, 1);  TEST_EQUAL(lc.second, 11);
+        TRY(lc = index.line_column(11));  TEST_EQUAL(lc.first, 1);  TEST_EQUAL(lc.second, 12);
+        TRY(lc = index.line_column(99));  TEST_EQUAL(lc.first, 1);  TEST_EQUAL(lc.second, 12);
+
+        TRY(index = LineIndex(s3));
+        TEST_EQUAL(index.lines(), 3);
+        TEST_EQUAL(index.line_offset(0), npos);
+        TEST_EQUAL(index.line_offset(1), 0);
+        TEST_EQUAL(index.line_offset(2), 13);
+        TEST_EQUAL(index.line_offset(3), 22);
+        TEST_EQUAL(index.line_offset(4), npos);
+        for (ofs = 0; ofs <= s3.size(); ++ofs) {
+            TRY(lc = index.line_column(ofs));
+            TEST_EQUAL(lc, str_line_column(s3, ofs));
+        }
+
+        s0 = u8"αβγ\r\rδεζ\u2028ηθι\u0085κλμ\n";
+        TEST_EQUAL(s0.size(), 32);
+        TRY(index = LineIndex(s0));
+        TEST_EQUAL(index.lines(), 6);
+        TEST_EQUAL(index.line_offset(2), 7);
+        TEST_EQUAL(index.line_offset(3), 8);
+        TEST_EQUAL(index.line_offset(4), 17);
+        TEST_EQUAL(index.line_offset(5), 25);
+        TEST_EQUAL(index.line_offset(6), 32);
+        TRY(lc = index.line_column(4));   TEST_EQUAL(lc.first, 1);  TEST_EQUAL(lc.second, 3);
+        TRY(lc = index.line_column(5));   TEST_EQUAL(lc.first, 1);  TEST_EQUAL(lc.second, 3);
+        TRY(lc = index.line_column(7));   TEST_EQUAL(lc.first, 2);  TEST_EQUAL(lc.second, 1);
+        TRY(lc = index.line_column(14));  TEST_EQUAL(lc.first, 3);  TEST_EQUAL(lc.second, 4);
+        TRY(lc = index.line_column(23));  TEST_EQUAL(lc.first, 4);  TEST_EQUAL(lc.second, 4);
+        TRY(lc = index.line_column(32));  TEST_EQUAL(lc.first, 6);  TEST_EQUAL(lc.second, 1);
+        for (ofs = 0; ofs <= s0.size(); ++ofs) {
+            TRY(lc = index.line_column(ofs));
+            TEST_EQUAL(lc, str_line_column(s0, ofs));
+        }
+
+        s0 = u8"Hello\t世界\nGoodbye\t世界\n";
+        TRY(index = LineIndex(s0, Length::wide));
+        TRY(lc = index.line_column(12));  TEST_EQUAL(lc.first, 1);  TEST_EQUAL(lc.second, 11);
+        TRY(lc = index.line_column(13));  TEST_EQUAL(lc.first, 2);  TEST_EQUAL(lc.second, 1);
+        TRY(lc = index.line_column(21));  TEST_EQUAL(lc.first, 2);  TEST_EQUAL(lc.second, 9);
+        TRY(lc = index.line_column(24));  TEST_EQUAL(lc.first, 2);  TEST_EQUAL(lc.second, 11);
+        TEST_THROW(LineIndex(s0, Length::narrow | Length::wide), std::invalid_argument);
+
+        s0 = "a\xc2\xff" "b\n";
+        TRY(index = LineIndex(s0));
+        TEST_EQUAL(index.lines(), 2);
+        TRY(lc = index.line_column(2));  TEST_EQUAL(lc.first, 1);  TEST_EQUAL(lc.second, 2);
+        TRY(lc = index.line_column(3));  TEST_EQUAL(lc.first, 1);  TEST_EQUAL(lc.second, 3);
     }
 
     void check_search() {
@@ -167,6 +309,34 @@ namespace {
         TRY(r = str_search(utf_range(s), u8"∈lement"));  TEST_EQUAL(std::distance(utf_begin(s), r.first), 5);   TEST_EQUAL(std::distance(r.first, r.second), 7);
         TRY(r = str_search(utf_range(s), u8"Hello"));    TEST_EQUAL(std::distance(utf_begin(s), r.first), 12);  TEST_EQUAL(std::distance(r.first, r.second), 0);
 
+        s = u8"αβγ the quick brown fox, the quick brown dog, the quick brown cat";
+        Utf8Iterator i, j;
+
+        TRY(r = str_search(s, u8"the quick brown dog"));          TEST_EQUAL(std::distance(utf_begin(s), r.first), 25);  TEST_EQUAL(std::distance(r.first, r.second), 19);
+        TRY(r = str_search(s, u8"the quick brown cow"));          TEST_EQUAL(std::distance(utf_begin(s), r.first), 65);  TEST_EQUAL(std::distance(r.first, r.second), 0);
+        TRY(r = str_search(s, u8"γ the quick brown fox"));        TEST_EQUAL(std::distance(utf_begin(s), r.first), 2);   TEST_EQUAL(std::distance(r.first, r.second), 21);
+        TRY(r = str_search(s, u8"brown"));                        TEST_EQUAL(std::distance(utf_begin(s), r.first), 14);  TEST_EQUAL(std::distance(r.first, r.second), 5);
+        TRY(j = str_search(s, u8"dog").first);                    TEST_EQUAL(std::distance(utf_begin(s), j), 41);
+        TRY(r = str_search(utf_begin(s), j, u8"brown dog"));      TEST(r.first == j);                                     TEST(r.second == j);
+        TRY(r = str_search(utf_begin(s), j, u8"brown "));         TEST_EQUAL(std::distance(utf_begin(s), r.first), 14);
+        TRY(i = str_find_char(s, U'γ'));                     TEST_EQUAL(std::distance(utf_begin(s), i), 2);
+        TRY(i = str_find_char(utf_begin(s), j, U'c'));            TEST_EQUAL(std::distance(utf_begin(s), i), 11);
+        TRY(i = str_find_char(utf_begin(s), j, U't'));            TEST_EQUAL(std::distance(utf_begin(s), i), 4);
+        TRY(i = str_find_char(j, utf_end(s), U'x'));              TEST(i == utf_end(s));
+        TRY(i = str_find_first_of(j, utf_end(s), u8"γc"));        TEST_EQUAL(std::distance(utf_begin(s), i), 53);
+        TRY(i = str_find_last_of(utf_begin(s), j, u8"βx"));       TEST_EQUAL(std::distance(utf_begin(s), i), 22);
+        TRY(i = str_find_last_not_of(utf_begin(s), j, u8" dlor"));  TEST_EQUAL(std::distance(utf_begin(s), i), 39);
+
+        std::string_view v(s.data() + 7, 36);  // "the quick brown fox, the quick brown"
+        Irange<Utf8ViewIterator> rv;
+
+        TRY(rv = str_search(v, u8"brown"));                      TEST_EQUAL(rv.first.offset(), 10);  TEST_EQUAL(u_view(rv), u8"brown");
+        TRY(rv = str_search(v, u8"quick brown dog"));            TEST(rv.first == utf_end(v));       TEST(rv.second == utf_end(v));
+        TRY(rv = str_search(v, u8"γ the"));                      TEST(rv.first == utf_end(v));
+        TRY(rv = str_search(utf_iterator(v, 11), utf_end(v), u8"brown"));  TEST_EQUAL(rv.first.offset(), 31);
+        TRY(rv = str_search(utf_range(v), u8""));                TEST_EQUAL(rv.first.offset(), 0);   TEST_EQUAL(rv.second.offset(), 0);
+        TRY(rv = str_search(std::string_view(s), u8"βγ"));        TEST_EQUAL(rv.first.offset(), 2);   TEST_EQUAL(u_str(rv), u8"βγ");
+
     }
 
     void check_skipws() {
@@ -188,6 +358,7 @@ namespace {
 
 TEST_MODULE(unicorn, string_algorithm) {
 
+    check_character_sets();
     check_common();
     check_expect();
     check_find_char();
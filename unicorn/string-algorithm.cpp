@@ -1,8 +1,209 @@
 #include "unicorn/string.hpp"
 #include <algorithm>
+#include <cstring>
 
 namespace RS::Unicorn {
 
+    namespace {
+
+        // UTF-8 is self synchronizing, so a valid UTF-8 target can be
+        // searched for directly in the encoded subject string. This gives
+        // the same result as searching the decoded characters, unless the
+        // target contains U+FFFD, which can be matched by an invalid
+        // sequence in the subject after decoding.
+
+        bool byte_searchable(std::string_view target) noexcept {
+            return valid_string(target) && target.find("\xef\xbf\xbd") == npos;
+        }
+
+        // Returns the offset of the target in the subject, or npos. Short
+        // targets use memchr() to find candidates for the first byte, then
+        // check the last byte before comparing the rest; longer targets use
+        // Boyer-Moore-Horspool.
+
+        size_t byte_search(const char* src, size_t n, const char* target, size_t m) noexcept {
+            if (m == 0)
+                return 0;
+            if (m > n)
+                return npos;
+            static constexpr size_t horspool_threshold = 16;
+            if (m < horspool_threshold) {
+                auto ptr = src, stop = src + n - m + 1;
+                while (ptr < stop) {
+                    ptr = static_cast<const char*>(std::memchr(ptr, target[0], stop - ptr));
+                    if (! ptr)
+                        return npos;
+                    if (ptr[m - 1] == target[m - 1] && std::memcmp(ptr, target, m) == 0)
+                        return ptr - src;
+                    ++ptr;
+                }
+                return npos;
+            }
+            size_t skip[256];
+            std::fill(skip, skip + 256, m);
+            for (size_t i = 0; i < m - 1; ++i)
+                skip[uint8_t(target[i])] = m - 1 - i;
+            char last = target[m - 1];
+            for (size_t pos = 0; pos <= n - m; pos += skip[uint8_t(src[pos + m - 1])])
+                if (src[pos + m - 1] == last && std::memcmp(src + pos, target, m - 1) == 0)
+                    return pos;
+            return npos;
+        }
+
+        // Substring search, for both string and string view iterators
+
+        template <typename UI>
+        Irange<UI> search_helper(const UI& b, const UI& e, std::string_view target) {
+            if (byte_searchable(target)) {
+                auto ptr = b.source().data() + b.offset();
+                size_t pos = byte_search(ptr, e.offset() - b.offset(), target.data(), target.size());
+                if (pos == npos)
+                    return {e, e};
+                auto i = b.offset_by(ptrdiff_t(pos));
+                return {i, i.offset_by(ptrdiff_t(target.size()))};
+            }
+            auto u_target = recode<char32_t>(target);
+            auto ub = u_target.begin(), ue = u_target.end();
+            auto i = std::search(b, e, ub, ue);
+            if (i == e)
+                return {i, i};
+            auto j = i.offset_by(target.size());
+            return {i, j};
+        }
+
+        // ASCII bytes are tested without decoding
+
+        Utf8Iterator find_first_in_set(const Utf8Iterator& b, const Utf8Iterator& e, const CharSet& set, bool want) {
+            auto ptr = b.source().data();
+            size_t i = b.offset(), end = e.offset();
+            while (i < end) {
+                auto c = uint8_t(ptr[i]);
+                if (c < 0x80) {
+                    if (set.contains(c) == want)
+                        return b.offset_by(ptrdiff_t(i - b.offset()));
+                    ++i;
+                } else {
+                    auto it = b.offset_by(ptrdiff_t(i - b.offset()));
+                    if (set(*it) == want)
+                        return it;
+                    i += std::max(it.count(), size_t(1));
+                }
+            }
+            return e;
+        }
+
+        Utf8Iterator find_last_in_set(const Utf8Iterator& b, const Utf8Iterator& e, const CharSet& set, bool want) {
+            auto ptr = e.source().data();
+            size_t i = e.offset(), begin = b.offset();
+            while (i > begin) {
+                auto c = uint8_t(ptr[i - 1]);
+                if (c < 0x80) {
+                    --i;
+                    if (set.contains(c) == want)
+                        return e.offset_by(ptrdiff_t(i) - ptrdiff_t(e.offset()));
+                } else {
+                    auto it = e.offset_by(ptrdiff_t(i) - ptrdiff_t(e.offset()));
+                    --it;
+                    if (set(*it) == want)
+                        return it;
+                    i = it.offset();
+                }
+            }
+            return e;
+        }
+
+    }
+
+    // Class CharSet
+
+    CharSet::CharSet(const U8string& chars) {
+        for (char32_t c: utf_range(chars))
+            insert(c);
+    }
+
+    CharSet::CharSet(GC cat):
+    CharSet([cat] (char32_t c) { return char_general_category(c) == cat; }) {}
+
+    void CharSet::insert(char32_t first, char32_t last) {
+        last = std::min(last, last_unicode_char);
+        if (first > last)
+            return;
+        for (; first < 0x80 && first <= last; ++first)
+            ascii[first >> 6] |= uint64_t(1) << (first & 63);
+        if (first > last)
+            return;
+        auto lt = [] (const std::pair<char32_t, char32_t>& r, char32_t c) { return r.second + 1 < c; };
+        auto i = std::lower_bound(ranges.begin(), ranges.end(), first, lt);
+        auto j = i;
+        while (j != ranges.end() && j->first <= last + 1) {
+            first = std::min(first, j->first);
+            last = std::max(last, j->second);
+            ++j;
+        }
+        i = ranges.erase(i, j);
+        ranges.insert(i, {first, last});
+    }
+
+    bool CharSet::contains_other(char32_t c) const noexcept {
+        auto i = std::upper_bound(ranges.begin(), ranges.end(), c,
+            [] (char32_t c, const std::pair<char32_t, char32_t>& r) { return c < r.first; });
+        return i != ranges.begin() && c <= i[-1].second;
+    }
+
+    // Class CharMap
+
+    CharMap::CharMap() noexcept {
+        for (char32_t c = 0; c < 0x80; ++c)
+            ascii[c] = c;
+    }
+
+    CharMap::CharMap(const U8string& target, const U8string& sub):
+    CharMap() {
+        if (target.empty() || sub.empty())
+            return;
+        auto s = to_utf32(sub);
+        CharSet seen;
+        size_t i = 0;
+        for (char32_t c: utf_range(target)) {
+            // The first mapping for a given character takes precedence
+            if (! seen(c)) {
+                seen.insert(c);
+                insert(c, s[std::min(i, s.size() - 1)]);
+            }
+            ++i;
+        }
+    }
+
+    bool CharMap::empty() const noexcept {
+        if (! others.empty())
+            return false;
+        for (char32_t c = 0; c < 0x80; ++c)
+            if (ascii[c] != c)
+                return false;
+        return true;
+    }
+
+    void CharMap::insert(char32_t from, char32_t to) {
+        if (from < 0x80) {
+            ascii[from] = to;
+            return;
+        }
+        auto i = std::lower_bound(others.begin(), others.end(), from,
+            [] (const std::pair<char32_t, char32_t>& m, char32_t c) { return m.first < c; });
+        if (i != others.end() && i->first == from)
+            i->second = to;
+        else
+            others.insert(i, {from, to});
+    }
+
+    char32_t CharMap::map_other(char32_t c) const noexcept {
+        auto i = std::lower_bound(others.begin(), others.end(), c,
+            [] (const std::pair<char32_t, char32_t>& m, char32_t c) { return m.first < c; });
+        return i != others.end() && i->first == c ? i->second : c;
+    }
+
+    // Other string algorithms
+
     size_t str_common(const U8string& s1, const U8string& s2, size_t start) noexcept {
         if (start >= s1.size() || start >= s2.size())
             return 0;
@@ -38,11 +239,16 @@ namespace RS::Unicorn {
     }
 
     Utf8Iterator str_find_char(const Utf8Iterator& b, const Utf8Iterator& e, char32_t c) {
-        return std::find(b, e, c);
+        if (! char_is_unicode(c) || c == replacement_char)
+            return std::find(b, e, c);
+        auto target = str_char(c);
+        auto ptr = b.source().data() + b.offset();
+        size_t pos = byte_search(ptr, e.offset() - b.offset(), target.data(), target.size());
+        return pos == npos ? e : b.offset_by(ptrdiff_t(pos));
     }
 
     Utf8Iterator str_find_char(const Irange<Utf8Iterator>& range, char32_t c) {
-        return std::find(range.begin(), range.end(), c);
+        return str_find_char(range.begin(), range.end(), c);
     }
 
     Utf8Iterator str_find_char(const U8string& str, char32_t c) {
@@ -68,9 +274,7 @@ namespace RS::Unicorn {
     }
 
     Utf8Iterator str_find_first_of(const Utf8Iterator& b, const Utf8Iterator& e, const U8string& target) {
-        auto u_target = to_utf32(target);
-        return std::find_if(b, e,
-            [&] (char32_t c) { return u_target.find(c) != npos; });
+        return find_first_in_set(b, e, CharSet(target), true);
     }
 
     Utf8Iterator str_find_first_of(const Irange<Utf8Iterator>& range, const U8string& target) {
@@ -81,10 +285,20 @@ namespace RS::Unicorn {
         return str_find_first_of(utf_begin(str), utf_end(str), target);
     }
 
+    Utf8Iterator str_find_first_of(const Utf8Iterator& b, const Utf8Iterator& e, const CharSet& target) {
+        return find_first_in_set(b, e, target, true);
+    }
+
+    Utf8Iterator str_find_first_of(const Irange<Utf8Iterator>& range, const CharSet& target) {
+        return find_first_in_set(range.begin(), range.end(), target, true);
+    }
+
+    Utf8Iterator str_find_first_of(const U8string& str, const CharSet& target) {
+        return find_first_in_set(utf_begin(str), utf_end(str), target, true);
+    }
+
     Utf8Iterator str_find_first_not_of(const Utf8Iterator& b, const Utf8Iterator& e, const U8string& target) {
-        auto u_target = to_utf32(target);
-        return std::find_if(b, e,
-            [&] (char32_t c) { return u_target.find(c) == npos; });
+        return find_first_in_set(b, e, CharSet(target), false);
     }
 
     Utf8Iterator str_find_first_not_of(const Irange<Utf8Iterator>& range, const U8string& target) {
@@ -95,15 +309,20 @@ namespace RS::Unicorn {
         return str_find_first_not_of(utf_begin(str), utf_end(str), target);
     }
 
+    Utf8Iterator str_find_first_not_of(const Utf8Iterator& b, const Utf8Iterator& e, const CharSet& target) {
+        return find_first_in_set(b, e, target, false);
+    }
+
+    Utf8Iterator str_find_first_not_of(const Irange<Utf8Iterator>& range, const CharSet& target) {
+        return find_first_in_set(range.begin(), range.end(), target, false);
+    }
+
+    Utf8Iterator str_find_first_not_of(const U8string& str, const CharSet& target) {
+        return find_first_in_set(utf_begin(str), utf_end(str), target, false);
+    }
+
     Utf8Iterator str_find_last_of(const Utf8Iterator& b, const Utf8Iterator& e, const U8string& target) {
-        auto u_target = to_utf32(target);
-        auto i = e;
-        while (i != b) {
-            --i;
-            if (u_target.find(*i) != npos)
-                return i;
-        }
-        return e;
+        return find_last_in_set(b, e, CharSet(target), true);
     }
 
     Utf8Iterator str_find_last_of(const Irange<Utf8Iterator>& range, const U8string& target) {
@@ -114,15 +333,20 @@ namespace RS::Unicorn {
         return str_find_last_of(utf_begin(str), utf_end(str), target);
     }
 
+    Utf8Iterator str_find_last_of(const Utf8Iterator& b, const Utf8Iterator& e, const CharSet& target) {
+        return find_last_in_set(b, e, target, true);
+    }
+
+    Utf8Iterator str_find_last_of(const Irange<Utf8Iterator>& range, const CharSet& target) {
+        return find_last_in_set(range.begin(), range.end(), target, true);
+    }
+
+    Utf8Iterator str_find_last_of(const U8string& str, const CharSet& target) {
+        return find_last_in_set(utf_begin(str), utf_end(str), target, true);
+    }
+
     Utf8Iterator str_find_last_not_of(const Utf8Iterator& b, const Utf8Iterator& e, const U8string& target) {
-        auto u_target = to_utf32(target);
-        auto i = e;
-        while (i != b) {
-            --i;
-            if (u_target.find(*i) == npos)
-                return i;
-        }
-        return e;
+        return find_last_in_set(b, e, CharSet(target), false);
     }
 
     Utf8Iterator str_find_last_not_of(const Irange<Utf8Iterator>& range, const U8string& target) {
@@ -133,6 +357,18 @@ namespace RS::Unicorn {
         return str_find_last_not_of(utf_begin(str), utf_end(str), target);
     }
 
+    Utf8Iterator str_find_last_not_of(const Utf8Iterator& b, const Utf8Iterator& e, const CharSet& target) {
+        return find_last_in_set(b, e, target, false);
+    }
+
+    Utf8Iterator str_find_last_not_of(const Irange<Utf8Iterator>& range, const CharSet& target) {
+        return find_last_in_set(range.begin(), range.end(), target, false);
+    }
+
+    Utf8Iterator str_find_last_not_of(const U8string& str, const CharSet& target) {
+        return find_last_in_set(utf_begin(str), utf_end(str), target, false);
+    }
+
     std::pair<size_t, size_t> str_line_column(const U8string& str, size_t offset, size_t flags) {
         offset = std::min(offset, str.size());
         size_t line = 1;
@@ -167,14 +403,74 @@ namespace RS::Unicorn {
         return {line, column};
     }
 
+    LineIndex::LineIndex(std::string_view str, uint32_t flags):
+    src(str), fset(flags) {
+        UnicornDetail::check_length_flags(fset);
+        // An 8 byte block can be skipped if every byte is in 0x0e-0x7f,
+        // i.e. ASCII with no line breaks
+        static constexpr uint64_t ones = 0x0101010101010101ull, highs = ones << 7;
+        auto ptr = str.data();
+        size_t i = 0, n = str.size();
+        bool line_ascii = true;
+        starts.push_back(0);
+        while (i < n) {
+            if (n - i >= 8) {
+                uint64_t x;
+                std::memcpy(&x, ptr + i, 8);
+                if (((((x - 0x0e * ones) & ~ x) | x) & highs) == 0) {
+                    i += 8;
+                    continue;
+                }
+            }
+            auto c = uint8_t(ptr[i]);
+            bool brk = false;
+            if (c < 0x80) {
+                ++i;
+                brk = c >= 0x0a && c <= 0x0d;
+                if (c == '\r' && i < n && ptr[i] == '\n')
+                    ++i;
+            } else {
+                auto it = utf_iterator(str, i);
+                line_ascii = false;
+                brk = char_is_line_break(*it);
+                i += std::max(it.count(), size_t(1));
+            }
+            if (brk) {
+                ascii.push_back(line_ascii);
+                starts.push_back(i);
+                line_ascii = true;
+            }
+        }
+        ascii.push_back(line_ascii);
+    }
+
+    std::pair<size_t, size_t> LineIndex::line_column(size_t offset) const {
+        if (starts.empty())
+            return {1, 1};
+        offset = std::min(offset, src.size());
+        size_t line = std::upper_bound(starts.begin(), starts.end(), offset) - starts.begin();
+        size_t lstart = starts[line - 1];
+        if (ascii[line - 1])
+            return {line, offset - lstart + 1};
+        auto i = utf_iterator(src, lstart), j = i, k = i;
+        while (k.offset() < offset) {
+            j = k;
+            ++k;
+        }
+        if (k.offset() == offset)
+            j = k;
+        return {line, str_length(i, j, fset) + 1};
+    }
+
+    size_t LineIndex::line_offset(size_t line) const noexcept {
+        if (line == 0 || line > starts.size())
+            return npos;
+        else
+            return starts[line - 1];
+    }
+
     Irange<Utf8Iterator> str_search(const Utf8Iterator& b, const Utf8Iterator& e, const U8string& target) {
-        auto u_target = to_utf32(target);
-        auto ub = u_target.begin(), ue = u_target.end();
-        auto i = std::search(b, e, ub, ue);
-        if (i == e)
-            return {i, i};
-        auto j = i.offset_by(target.size());
-        return {i, j};
+        return search_helper(b, e, target);
     }
 
     Irange<Utf8Iterator> str_search(const Irange<Utf8Iterator>& range, const U8string& target) {
@@ -185,6 +481,18 @@ namespace RS::Unicorn {
         return str_search(utf_begin(str), utf_end(str), target);
     }
 
+    Irange<Utf8ViewIterator> str_search(const Utf8ViewIterator& b, const Utf8ViewIterator& e, std::string_view target) {
+        return search_helper(b, e, target);
+    }
+
+    Irange<Utf8ViewIterator> str_search(const Irange<Utf8ViewIterator>& range, std::string_view target) {
+        return str_search(range.begin(), range.end(), target);
+    }
+
+    Irange<Utf8ViewIterator> str_search(std::string_view str, std::string_view target) {
+        return str_search(utf_begin(str), utf_end(str), target);
+    }
+
     size_t str_skipws(Utf8Iterator& i, const Utf8Iterator& end) {
         size_t n = 0;
         for (; i != end && char_is_white_space(*i); ++i, ++n) {}
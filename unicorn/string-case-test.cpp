@@ -62,6 +62,61 @@ namespace {
         s = u8"HELLO WORLD";  TRY(str_casefold_in(s));  TEST_EQUAL(s, u8"hello world");
         s = u8"hello world";  TRY(str_casefold_in(s));  TEST_EQUAL(s, u8"hello world");
 
+        // Case mapping a view must not read past its end
+
+        const U8string buf = u8"[hello ΣΑΣ wörld]";
+        std::string_view v(buf.data() + 1, buf.size() - 2);
+
+        TEST_EQUAL(str_uppercase(v), u8"HELLO ΣΑΣ WÖRLD");
+        TEST_EQUAL(str_lowercase(v), u8"hello σας wörld");
+        TEST_EQUAL(str_lowercase(v.substr(6, 6)), u8"σας");
+        TEST_EQUAL(str_titlecase(v), u8"Hello Σας Wörld");
+        TEST_EQUAL(str_casefold(v), u8"hello σασ wörld");
+        TEST_EQUAL(str_uppercase("hello"), u8"HELLO");
+
+        s = u8"<";  TRY(str_uppercase_to(s, v));  TEST_EQUAL(s, u8"<HELLO ΣΑΣ WÖRLD");
+        s = u8"<";  TRY(str_titlecase_to(s, v));  TEST_EQUAL(s, u8"<Hello Σας Wörld");
+
+    }
+
+    void check_mixed_case_conversions() {
+
+        U8string s;
+
+        TEST_EQUAL(str_uppercase(u8"@AZ[`az{ @AZ[`az{ @AZ[`az{"s), u8"@AZ[`AZ{ @AZ[`AZ{ @AZ[`AZ{");
+        TEST_EQUAL(str_lowercase(u8"@AZ[`az{ @AZ[`az{ @AZ[`az{"s), u8"@az[`az{ @az[`az{ @az[`az{");
+        TEST_EQUAL(str_casefold(u8"@AZ[`az{ @AZ[`az{ @AZ[`az{"s), u8"@az[`az{ @az[`az{ @az[`az{");
+
+        TEST_EQUAL(str_uppercase(u8"hello αβγ world ǆ"s), u8"HELLO ΑΒΓ WORLD Ǆ");
+        TEST_EQUAL(str_lowercase(u8"HELLO ΑΒΓ WORLD Ǆ"s), u8"hello αβγ world ǆ");
+        TEST_EQUAL(str_uppercase(u8"straße straße"s), u8"STRASSE STRASSE");
+        TEST_EQUAL(str_casefold(u8"Straße Straße"s), u8"strasse strasse");
+        TEST_EQUAL(str_lowercase(u8"ΟΔΟΣ ΟΔΟΣ."s), u8"οδος οδος.");
+        TEST_EQUAL(str_lowercase(u8"AΣ ΣA Σ"s), u8"aς σa σ");
+        TEST_EQUAL(str_uppercase(u8"aⱥb"s), u8"AȺB");
+
+        s = u8"hello αβγ world ǆ";  TRY(str_uppercase_in(s));  TEST_EQUAL(s, u8"HELLO ΑΒΓ WORLD Ǆ");
+        s = u8"HELLO ΑΒΓ WORLD Ǆ";  TRY(str_lowercase_in(s));  TEST_EQUAL(s, u8"hello αβγ world ǆ");
+        s = u8"straße straße";      TRY(str_uppercase_in(s));  TEST_EQUAL(s, u8"STRASSE STRASSE");
+        s = u8"Straße Straße";      TRY(str_casefold_in(s));   TEST_EQUAL(s, u8"strasse strasse");
+        s = u8"ΟΔΟΣ ΟΔΟΣ.";         TRY(str_lowercase_in(s));  TEST_EQUAL(s, u8"οδος οδος.");
+        s = u8"AΣ ΣA Σ";            TRY(str_lowercase_in(s));  TEST_EQUAL(s, u8"aς σa σ");
+        s = u8"aⱥb";                TRY(str_uppercase_in(s));  TEST_EQUAL(s, u8"AȺB");
+
+        s = u8"abc ";
+        TRY(str_uppercase_to(s, u8"hello ß"));   TEST_EQUAL(s, u8"abc HELLO SS");
+        TRY(str_lowercase_to(s, u8" ΟΔΟΣ"));     TEST_EQUAL(s, u8"abc HELLO SS οδος");
+        TRY(str_titlecase_to(s, u8" ǆǆǆ"));      TEST_EQUAL(s, u8"abc HELLO SS οδος ǅǆǆ");
+        TRY(str_casefold_to(s, u8" Straße"));    TEST_EQUAL(s, u8"abc HELLO SS οδος ǅǆǆ strasse");
+
+        Arena arena;
+        PmrString p = arena.str(u8"abc ");
+        TRY(str_uppercase_to(p, u8"hello ß"));   TEST_EQUAL(U8string(p), u8"abc HELLO SS");
+        TRY(str_lowercase_to(p, u8" ΟΔΟΣ"));     TEST_EQUAL(U8string(p), u8"abc HELLO SS οδος");
+        TRY(str_titlecase_to(p, u8" ǆǆǆ"));      TEST_EQUAL(U8string(p), u8"abc HELLO SS οδος ǅǆǆ");
+        TRY(str_casefold_to(p, u8" Straße"));    TEST_EQUAL(U8string(p), u8"abc HELLO SS οδος ǅǆǆ strasse");
+        TEST(p.get_allocator().resource() == arena.resource());
+
     }
 
 }
@@ -69,5 +124,6 @@ namespace {
 TEST_MODULE(unicorn, string_case) {
 
     check_case_conversions();
+    check_mixed_case_conversions();
 
 }
@@ -1,20 +1,34 @@
 #include "unicorn/string.hpp"
 #include <algorithm>
+#include <cstring>
 
 namespace RS::Unicorn {
 
     namespace {
 
-        template <typename F>
-        const U8string casemap_helper(const U8string& src, F f) {
-            U8string dst;
-            char32_t buf[max_case_decomposition];
-            auto out = utf_writer(dst);
-            for (auto c: utf_range(src)) {
-                auto n = f(c, buf);
-                std::copy_n(buf, n, out);
+        using UnicornDetail::ascii_run;
+
+        constexpr uint64_t ones = 0x0101010101010101ull, highs = ones << 7;
+
+        // Toggle the case of ASCII letters in the range First-Last, 8 bytes
+        // at a time. Every byte must be ASCII; adding the offsets to a byte
+        // sets its high bit if the byte is at least First, or above Last, so
+        // the high bits of the XOR mark the bytes in the range, and shifting
+        // them down gives the 0x20 case bit.
+
+        template <char First, char Last>
+        void ascii_case(char* ptr, size_t n) noexcept {
+            static constexpr uint64_t lo = (0x80 - First) * ones, hi = (0x7f - Last) * ones;
+            size_t i = 0;
+            for (; n - i >= 8; i += 8) {
+                uint64_t x;
+                std::memcpy(&x, ptr + i, 8);
+                x ^= (((x + lo) ^ (x + hi)) & highs) >> 2;
+                std::memcpy(ptr + i, &x, 8);
             }
-            return dst;
+            for (; i < n; ++i)
+                if (ptr[i] >= First && ptr[i] <= Last)
+                    ptr[i] ^= 0x20;
         }
 
         template <typename FwdIter>
@@ -27,70 +41,202 @@ namespace RS::Unicorn {
             return false;
         }
 
+        // Case mapping classes for casemap_helper() and casemap_in_helper().
+        // The ascii() function converts a run of ASCII bytes in place; map()
+        // writes the full mapping of the character at i to buf and returns
+        // its length.
+
+        struct UpperChar {
+            void ascii(char* ptr, size_t n) noexcept { ascii_case<'a', 'z'>(ptr, n); }
+            template <typename FwdIter> size_t map(FwdIter i, FwdIter /*e*/, char32_t* buf) noexcept { return char_to_full_uppercase(*i, buf); }
+        };
+
+        struct FoldChar {
+            void ascii(char* ptr, size_t n) noexcept { ascii_case<'A', 'Z'>(ptr, n); }
+            template <typename FwdIter> size_t map(FwdIter i, FwdIter /*e*/, char32_t* buf) noexcept { return char_to_full_casefold(*i, buf); }
+        };
+
         struct LowerChar {
             static constexpr char32_t sigma = 0x3c3;
             static constexpr char32_t final_sigma = 0x3c2;
             bool last_cased = false;
             char32_t buf[max_case_decomposition];
-            template <typename FwdIter, typename OutIter> void convert(FwdIter i, FwdIter e, OutIter to) {
-                auto n = char_to_full_lowercase(*i, buf);
-                if (buf[0] == sigma && last_cased && ! next_cased(i, e))
-                    buf[0] = final_sigma;
-                std::copy_n(buf, n, to);
+            void ascii(char* ptr, size_t n) noexcept {
+                ascii_case<'A', 'Z'>(ptr, n);
+                for (size_t i = n; i > 0; --i) {
+                    char32_t c = ptr[i - 1];
+                    if (! char_is_case_ignorable(c)) {
+                        last_cased = char_is_cased(c);
+                        break;
+                    }
+                }
+            }
+            template <typename FwdIter> size_t map(FwdIter i, FwdIter e, char32_t* dst) {
+                auto n = char_to_full_lowercase(*i, dst);
+                if (dst[0] == sigma && last_cased && ! next_cased(i, e))
+                    dst[0] = final_sigma;
                 if (! char_is_case_ignorable(*i))
                     last_cased = char_is_cased(*i);
+                return n;
+            }
+            template <typename FwdIter, typename S> void convert(FwdIter i, FwdIter e, S& dst) {
+                auto n = map(i, e, buf);
+                UnicornDetail::append_utf8(dst, buf, n);
             }
         };
 
+        // Append the case mapped form of src, starting at offset pos, to
+        // dst. ASCII runs are copied in one block and converted in place.
+        // The destination may be a U8string or a PmrString.
+
+        template <typename S, typename Mapper>
+        void casemap_helper(S& dst, std::string_view src, size_t pos, Mapper& m) {
+            dst.reserve(dst.size() + src.size() - pos);
+            char32_t buf[max_case_decomposition];
+            auto e = utf_end(src);
+            while (pos < src.size()) {
+                size_t n = ascii_run(src.data() + pos, src.size() - pos);
+                if (n > 0) {
+                    size_t k = dst.size();
+                    dst.append(src, pos, n);
+                    m.ascii(&dst[k], n);
+                    pos += n;
+                    if (pos == src.size())
+                        break;
+                }
+                auto i = utf_iterator(src, pos);
+                UnicornDetail::append_utf8(dst, buf, m.map(i, e, buf));
+                pos += i.count();
+            }
+        }
+
+        // Case map a string in place, as long as each character maps to a
+        // single character of the same encoded length; from the first
+        // character that does not, the rest of the string is copied through
+        // casemap_helper().
+
+        template <typename Mapper>
+        void casemap_in_helper(U8string& str, Mapper& m) {
+            char32_t buf[max_case_decomposition];
+            char code[UnicornDetail::UtfEncoding<char>::max_units];
+            auto e = utf_end(str);
+            size_t pos = 0;
+            while (pos < str.size()) {
+                size_t n = ascii_run(str.data() + pos, str.size() - pos);
+                if (n > 0) {
+                    m.ascii(&str[pos], n);
+                    pos += n;
+                    if (pos == str.size())
+                        break;
+                }
+                auto i = utf_iterator(str, pos);
+                auto k = m.map(i, e, buf);
+                if (k == 1 && UnicornDetail::UtfEncoding<char>::encode(buf[0], code) == i.count()) {
+                    std::memcpy(&str[pos], code, i.count());
+                    pos += i.count();
+                } else {
+                    U8string dst(str, 0, pos);
+                    std::copy_n(buf, k, utf_writer(dst));
+                    casemap_helper(dst, str, pos + i.count(), m);
+                    str.swap(dst);
+                    break;
+                }
+            }
+        }
+
+        // Implementations of the _to functions, shared by the U8string and
+        // PmrString versions
+
+        template <typename S>
+        void uppercase_to(S& dst, std::string_view src) {
+            UNICORN_STAT(case_calls, 1);
+            UNICORN_STAT(case_bytes, src.size());
+            UNICORN_STAT_BUFFER(dst);
+            UpperChar uc;
+            casemap_helper(dst, src, 0, uc);
+        }
+
+        template <typename S>
+        void lowercase_to(S& dst, std::string_view src) {
+            UNICORN_STAT(case_calls, 1);
+            UNICORN_STAT(case_bytes, src.size());
+            UNICORN_STAT_BUFFER(dst);
+            LowerChar lc;
+            casemap_helper(dst, src, 0, lc);
+        }
+
+        template <typename S>
+        void titlecase_to(S& dst, std::string_view src) {
+            UNICORN_STAT(case_calls, 1);
+            UNICORN_STAT(case_bytes, src.size());
+            UNICORN_STAT_BUFFER(dst);
+            LowerChar lc;
+            auto e = utf_end(src);
+            dst.reserve(dst.size() + src.size());
+            for (auto& w: word_range(src)) {
+                bool initial = true;
+                for (auto i = w.begin(); i != w.end(); ++i) {
+                    if (initial && char_is_cased(*i)) {
+                        auto n = char_to_full_titlecase(*i, lc.buf);
+                        UnicornDetail::append_utf8(dst, lc.buf, n);
+                        lc.last_cased = true;
+                        initial = false;
+                    } else {
+                        lc.convert(i, e, dst);
+                    }
+                }
+            }
+        }
+
+        template <typename S>
+        void casefold_to(S& dst, std::string_view src) {
+            UNICORN_STAT(case_calls, 1);
+            UNICORN_STAT(case_bytes, src.size());
+            UNICORN_STAT_BUFFER(dst);
+            FoldChar fc;
+            casemap_helper(dst, src, 0, fc);
+        }
+
     }
 
-    U8string str_uppercase(const U8string& str) {
-        return casemap_helper(str, char_to_full_uppercase);
+    U8string str_uppercase(std::string_view str) {
+        U8string dst;
+        str_uppercase_to(dst, str);
+        return dst;
     }
 
-    U8string str_lowercase(const U8string& str) {
+    U8string str_lowercase(std::string_view str) {
         U8string dst;
-        LowerChar lc;
-        auto range = utf_range(str);
-        auto out = utf_writer(dst);
-        for (auto i = range.begin(), e = range.end(); i != e; ++i)
-            lc.convert(i, e, out);
+        str_lowercase_to(dst, str);
         return dst;
     }
 
-    U8string str_titlecase(const U8string& str) {
+    U8string str_titlecase(std::string_view str) {
         U8string dst;
-        LowerChar lc;
-        auto e = utf_end(str);
-        auto out = utf_writer(dst);
-        for (auto& w: word_range(str)) {
-            bool initial = true;
-            for (auto i = w.begin(); i != w.end(); ++i) {
-                if (initial && char_is_cased(*i)) {
-                    auto n = char_to_full_titlecase(*i, lc.buf);
-                    std::copy_n(lc.buf, n, out);
-                    lc.last_cased = true;
-                    initial = false;
-                } else {
-                    lc.convert(i, e, out);
-                }
-            }
-        }
+        str_titlecase_to(dst, str);
         return dst;
     }
 
-    U8string str_casefold(const U8string& str) {
-        return casemap_helper(str, char_to_full_casefold);
+    U8string str_casefold(std::string_view str) {
+        U8string dst;
+        str_casefold_to(dst, str);
+        return dst;
     }
 
     void str_uppercase_in(U8string& str) {
-        auto result = str_uppercase(str);
-        str.swap(result);
+        UNICORN_STAT(case_calls, 1);
+        UNICORN_STAT(case_bytes, str.size());
+        UNICORN_STAT_BUFFER(str);
+        UpperChar uc;
+        casemap_in_helper(str, uc);
     }
 
     void str_lowercase_in(U8string& str) {
-        auto result = str_lowercase(str);
-        str.swap(result);
+        UNICORN_STAT(case_calls, 1);
+        UNICORN_STAT(case_bytes, str.size());
+        UNICORN_STAT_BUFFER(str);
+        LowerChar lc;
+        casemap_in_helper(str, lc);
     }
 
     void str_titlecase_in(U8string& str) {
@@ -99,8 +245,43 @@ namespace RS::Unicorn {
     }
 
     void str_casefold_in(U8string& str) {
-        auto result = str_casefold(str);
-        str.swap(result);
+        UNICORN_STAT(case_calls, 1);
+        UNICORN_STAT(case_bytes, str.size());
+        UNICORN_STAT_BUFFER(str);
+        FoldChar fc;
+        casemap_in_helper(str, fc);
+    }
+
+    void str_uppercase_to(U8string& dst, std::string_view src) {
+        uppercase_to(dst, src);
+    }
+
+    void str_lowercase_to(U8string& dst, std::string_view src) {
+        lowercase_to(dst, src);
+    }
+
+    void str_titlecase_to(U8string& dst, std::string_view src) {
+        titlecase_to(dst, src);
+    }
+
+    void str_casefold_to(U8string& dst, std::string_view src) {
+        casefold_to(dst, src);
+    }
+
+    void str_uppercase_to(PmrString& dst, std::string_view src) {
+        uppercase_to(dst, src);
+    }
+
+    void str_lowercase_to(PmrString& dst, std::string_view src) {
+        lowercase_to(dst, src);
+    }
+
+    void str_titlecase_to(PmrString& dst, std::string_view src) {
+        titlecase_to(dst, src);
+    }
+
+    void str_casefold_to(PmrString& dst, std::string_view src) {
+        casefold_to(dst, src);
     }
 
 }
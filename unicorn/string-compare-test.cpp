@@ -1,6 +1,7 @@
 #include "unicorn/string.hpp"
 #include "unicorn/core.hpp"
 #include "rs-core/unit-test.hpp"
+#include <unordered_map>
 
 using namespace RS;
 using namespace RS::Unicorn;
@@ -64,6 +65,52 @@ namespace {
         TEST(! str_icase_equal(u8"hello world"s, u8"HELLO!WORLD"s));
         TEST(! str_icase_equal(u8"HELLO WORLD"s, u8"hello!world"s));
 
+        // Long enough to exercise the block comparison, with the
+        // difference or the first non-ASCII character at different offsets
+
+        U8string a = "The quick brown fox jumps over the lazy dog";
+        U8string b = "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG";
+        U8string c = "The quick brown fox jumps over the lazy dot";
+        U8string d = u8"The quick brown fox jumps over the lazy dög";
+        U8string e = u8"THE QUICK BROWN FOX JUMPS OVER THE LAZY DÖG";
+
+        TEST(str_icase_equal(a, b));
+        TEST(! str_icase_compare(a, b));
+        TEST(! str_icase_compare(b, a));
+        TEST(! str_icase_equal(a, c));
+        TEST(str_icase_compare(a, c));
+        TEST(! str_icase_compare(c, a));
+        TEST(str_icase_equal(d, e));
+        TEST(! str_icase_compare(d, e));
+        TEST(! str_icase_equal(a, d));
+        TEST(str_icase_compare(a, d));
+        TEST(! str_icase_compare(d, a));
+        TEST(str_icase_compare(a, a + "!"));
+        TEST(! str_icase_compare(a + "!", a));
+        TEST(str_icase_compare(u8"stra\u00dfe"s, u8"STRASSE!"s));
+        TEST(! str_icase_compare(u8"stra\u00dfe"s, u8"STRASSE"s));
+        TEST(! str_icase_compare(u8"STRASSE"s, u8"stra\u00dfe"s));
+        TEST(str_icase_compare(u8"Kelvin"s, u8"\u212aelvin!"s));
+        TEST(! str_icase_compare(u8"\u212aelvin"s, u8"kelvin"s));
+
+        TEST_EQUAL(str_icase_hash(""), str_icase_hash(""));
+        TEST_EQUAL(str_icase_hash(a), str_icase_hash(b));
+        TEST_EQUAL(str_icase_hash(d), str_icase_hash(e));
+        TEST_EQUAL(str_icase_hash(u8"stra\u00dfe"s), str_icase_hash(u8"STRASSE"s));
+        TEST_EQUAL(str_icase_hash(u8"Kelvin"s), str_icase_hash(u8"\u212aelvin"s));
+        TEST_EQUAL(str_icase_hash(u8"\u0391\u0392\u0393"s), str_icase_hash(u8"\u03b1\u03b2\u03b3"s));
+        TEST_COMPARE(str_icase_hash(a), !=, str_icase_hash(c));
+        TEST_COMPARE(str_icase_hash(a), !=, str_icase_hash(d));
+
+        std::unordered_map<U8string, int, IcaseHash, IcaseEqual> map;
+        TRY(map["Hello"] = 1);
+        TRY(map["HELLO"] = 2);
+        TRY(map[u8"stra\u00dfe"] = 3);
+        TRY(map["STRASSE"] = 4);
+        TEST_EQUAL(map.size(), 2);
+        TEST_EQUAL(map["hello"], 2);
+        TEST_EQUAL(map["strasse"], 4);
+
     }
 
     void check_natural_compare() {
@@ -96,6 +143,36 @@ namespace {
 
     }
 
+    void check_sort_keys() {
+
+        Strings list = {
+            "", "abc 123", "abc 45", "ABC 67", "abc 000123", "abc 123 xyz", "abc 123 456", "+abc 123",
+            "file10.txt", "file9.txt", "File9.txt", "file09.txt", "file.txt", "10", "9", "009", "x", "X",
+            u8"αβγ", u8"ΑΒΓ", u8"αβγ2", u8"straße", u8"STRASSE", "hello world", "HELLO!WORLD", "hello",
+        };
+
+        for (auto& a: list) {
+            for (auto& b: list) {
+                TEST_EQUAL(str_natural_sort_key(a) < str_natural_sort_key(b), str_natural_compare(a, b));
+                TEST_EQUAL(str_icase_sort_key(a) < str_icase_sort_key(b), str_icase_compare(a, b));
+            }
+        }
+
+        Strings v;
+        U8string s;
+
+        v = {"file10.txt", "file9.txt", "File1.txt", "file100.txt", "file09.txt"};
+        TRY(str_natural_sort(v));
+        TRY(s = str_join(v, " "));
+        TEST_EQUAL(s, "File1.txt file09.txt file9.txt file10.txt file100.txt");
+
+        v = {"delta", "Charlie", "BRAVO", "alpha", "Bravo"};
+        TRY(str_icase_sort(v));
+        TRY(s = str_join(v, " "));
+        TEST_EQUAL(s, "alpha BRAVO Bravo Charlie delta");
+
+    }
+
     void check_utf_compare() {
 
         U8string a8 = u8"\uff00\U00010000";
@@ -127,6 +204,7 @@ TEST_MODULE(unicorn, string_compare) {
     check_compare_3way();
     check_icase_compare();
     check_natural_compare();
+    check_sort_keys();
     check_utf_compare();
 
 }
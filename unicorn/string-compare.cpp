@@ -1,5 +1,6 @@
 #include "unicorn/string.hpp"
 #include <algorithm>
+#include <cstring>
 
 namespace RS::Unicorn {
 
@@ -13,64 +14,130 @@ namespace RS::Unicorn {
             return size1 < size2 ? -1 : size1 == size2 ? 0 : 1;
     }
 
-    bool str_icase_compare(const U8string& lhs, const U8string& rhs) noexcept {
-        if (lhs.empty() || rhs.empty())
-            return ! rhs.empty();
-        auto u1 = utf_range(lhs), u2 = utf_range(rhs);
-        auto i1 = u1.begin(), i2 = u2.begin();
-        char32_t buf1[max_case_decomposition], buf2[max_case_decomposition];
-        size_t p1 = 0, p2 = 0;
-        size_t n1 = char_to_full_casefold(*i1, buf1);
-        size_t n2 = char_to_full_casefold(*i2, buf2);
-        for (;;) {
-            if (p1 == n1) {
-                p1 = 0;
-                if (++i1 != u1.end())
-                    n1 = char_to_full_casefold(*i1, buf1);
+    namespace {
+
+        // ASCII fast path for case insensitive comparison. Blocks of 8 bytes
+        // are folded in parallel as long as both strings are pure ASCII;
+        // full Unicode case folding is only needed from the first non-ASCII
+        // byte onwards.
+
+        constexpr uint64_t ones = 0x0101010101010101ull;
+        constexpr uint64_t high_bits = 0x8080808080808080ull;
+
+        char ascii_fold(char c) noexcept {
+            return c >= 'A' && c <= 'Z' ? char(c + 32) : c;
+        }
+
+        uint64_t ascii_fold_block(uint64_t x) noexcept {
+            // Only valid if all bytes are ASCII
+            uint64_t above_z = x + (0x7f - 'Z') * ones;
+            uint64_t from_a = x + (0x80 - 'A') * ones;
+            uint64_t upper = (from_a ^ above_z) & high_bits;
+            return x | (upper >> 2);
+        }
+
+        // Returns the length of the common prefix where both strings are
+        // ASCII and equal apart from case
+
+        size_t icase_ascii_prefix(const U8string& lhs, const U8string& rhs) noexcept {
+            const char* p1 = lhs.data();
+            const char* p2 = rhs.data();
+            size_t i = 0, n = std::min(lhs.size(), rhs.size());
+            for (; i + 8 <= n; i += 8) {
+                uint64_t a, b;
+                std::memcpy(&a, p1 + i, 8);
+                std::memcpy(&b, p2 + i, 8);
+                if (((a | b) & high_bits) || ascii_fold_block(a) != ascii_fold_block(b))
+                    break;
             }
-            if (p2 == n2) {
-                p2 = 0;
-                if (++i2 != u2.end())
-                    n2 = char_to_full_casefold(*i2, buf2);
+            for (; i < n; ++i)
+                if (((p1[i] | p2[i]) & 0x80) || ascii_fold(p1[i]) != ascii_fold(p2[i]))
+                    break;
+            return i;
+        }
+
+        // Returns -1, 0, or 1, comparing the case folded strings from the
+        // given offset, which must be a character boundary in both
+
+        int icase_compare_from(const U8string& lhs, const U8string& rhs, size_t offset) noexcept {
+            auto i1 = utf_iterator(lhs, offset), e1 = utf_end(lhs);
+            auto i2 = utf_iterator(rhs, offset), e2 = utf_end(rhs);
+            if (i1 == e1 || i2 == e2)
+                return i1 != e1 ? 1 : i2 != e2 ? -1 : 0;
+            char32_t buf1[max_case_decomposition], buf2[max_case_decomposition];
+            size_t p1 = 0, p2 = 0;
+            size_t n1 = char_to_full_casefold(*i1, buf1);
+            size_t n2 = char_to_full_casefold(*i2, buf2);
+            for (;;) {
+                if (p1 == n1) {
+                    p1 = 0;
+                    if (++i1 != e1)
+                        n1 = char_to_full_casefold(*i1, buf1);
+                }
+                if (p2 == n2) {
+                    p2 = 0;
+                    if (++i2 != e2)
+                        n2 = char_to_full_casefold(*i2, buf2);
+                }
+                bool end1 = p1 == 0 && i1 == e1, end2 = p2 == 0 && i2 == e2;
+                if (end1 || end2)
+                    return end1 && end2 ? 0 : end1 ? -1 : 1;
+                if (buf1[p1] != buf2[p2])
+                    return buf1[p1] < buf2[p2] ? -1 : 1;
+                ++p1;
+                ++p2;
             }
-            if ((p1 == 0 && i1 == u1.end()) || (p2 == 0 && i2 == u2.end()))
-                return i2 != u2.end();
-            if (buf1[p1] != buf2[p2])
-                return buf1[p1] < buf2[p2];
-            ++p1;
-            ++p2;
         }
+
     }
 
-    bool str_icase_equal(const U8string& lhs, const U8string& rhs) noexcept {
-        if (lhs.empty() && rhs.empty())
+    bool str_icase_compare(const U8string& lhs, const U8string& rhs) noexcept {
+        size_t i = icase_ascii_prefix(lhs, rhs);
+        if (i == rhs.size())
+            return false;
+        if (i == lhs.size())
             return true;
+        if (((lhs[i] | rhs[i]) & 0x80) == 0)
+            return uint8_t(ascii_fold(lhs[i])) < uint8_t(ascii_fold(rhs[i]));
+        return icase_compare_from(lhs, rhs, i) < 0;
+    }
+
+    bool str_icase_equal(const U8string& lhs, const U8string& rhs) noexcept {
         if (lhs.size() != rhs.size())
             return false;
-        auto u1 = utf_range(lhs), u2 = utf_range(rhs);
-        auto i1 = u1.begin(), i2 = u2.begin();
-        char32_t buf1[max_case_decomposition], buf2[max_case_decomposition];
-        size_t p1 = 0, p2 = 0;
-        size_t n1 = char_to_full_casefold(*i1, buf1);
-        size_t n2 = char_to_full_casefold(*i2, buf2);
-        for (;;) {
-            if (p1 == n1) {
-                p1 = 0;
-                if (++i1 != u1.end())
-                    n1 = char_to_full_casefold(*i1, buf1);
-            }
-            if (p2 == n2) {
-                p2 = 0;
-                if (++i2 != u2.end())
-                    n2 = char_to_full_casefold(*i2, buf2);
+        size_t i = icase_ascii_prefix(lhs, rhs);
+        if (i == lhs.size())
+            return true;
+        if (((lhs[i] | rhs[i]) & 0x80) == 0)
+            return false;
+        return icase_compare_from(lhs, rhs, i) == 0;
+    }
+
+    size_t str_icase_hash(const U8string& str) noexcept {
+        // FNV-1a over the UTF-8 encoding of the case folded string
+        static constexpr uint64_t basis = 0xcbf29ce484222325ull;
+        static constexpr uint64_t prime = 0x100000001b3ull;
+        uint64_t h = basis;
+        const char* ptr = str.data();
+        size_t i = 0, n = str.size();
+        while (i < n) {
+            if ((ptr[i] & 0x80) == 0) {
+                h = (h ^ uint8_t(ascii_fold(ptr[i]))) * prime;
+                ++i;
+            } else {
+                auto it = utf_iterator(str, i);
+                char32_t buf[max_case_decomposition];
+                char units[UnicornDetail::UtfEncoding<char>::max_units];
+                size_t nc = char_to_full_casefold(*it, buf);
+                for (size_t j = 0; j < nc; ++j) {
+                    size_t nu = UnicornDetail::UtfEncoding<char>::encode(buf[j], units);
+                    for (size_t k = 0; k < nu; ++k)
+                        h = (h ^ uint8_t(units[k])) * prime;
+                }
+                i += it.count();
             }
-            if ((p1 == 0 && i1 == u1.end()) || (p2 == 0 && i2 == u2.end()))
-                return i1 == u1.end() && i2 == u2.end();
-            if (buf1[p1] != buf2[p2])
-                return false;
-            ++p1;
-            ++p2;
         }
+        return size_t(h);
     }
 
     namespace {
@@ -166,4 +233,38 @@ namespace RS::Unicorn {
             return lhs < rhs;
     }
 
+    U8string str_icase_sort_key(const U8string& str) {
+        return str_casefold(str);
+    }
+
+    U8string str_natural_sort_key(const U8string& str) {
+        // Each number segment is written as a 01 byte, the length of the
+        // number without leading zeros (4 bytes, big endian), and the
+        // digits. Each text segment is written as a 02 byte and the cooked
+        // text, followed by a 00 byte (cooked text never contains a null).
+        // A 00 byte marks the end of the segments, and is followed by the
+        // original string as the tie breaker.
+        U8string key;
+        key.reserve(str.size() + 16);
+        auto b = utf_begin(str), e = utf_end(str);
+        NaturalSegmentIterator i(b, e), end(e, e);
+        for (; i != end; ++i) {
+            auto& cooked = i->cooked;
+            if (i->is_number) {
+                auto n = uint32_t(cooked.size());
+                key += '\x01';
+                for (int shift = 24; shift >= 0; shift -= 8)
+                    key += char((n >> shift) & 0xff);
+                key += cooked;
+            } else {
+                key += '\x02';
+                key += cooked;
+                key += '\0';
+            }
+        }
+        key += '\0';
+        key += str;
+        return key;
+    }
+
 }
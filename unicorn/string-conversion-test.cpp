@@ -3,8 +3,10 @@
 #include "unicorn/character.hpp"
 #include "unicorn/utf.hpp"
 #include "rs-core/unit-test.hpp"
+#include <clocale>
 #include <limits>
 #include <stdexcept>
+#include <vector>
 
 using namespace RS;
 using namespace RS::Unicorn;
@@ -146,6 +148,24 @@ namespace {
         TEST_THROW(str_to_int<uint64_t>("18446744073709551616"s, Utf::throws), std::range_error);
         TEST_THROW(str_to_int<uint64_t>("42xyz"s, Utf::throws), std::invalid_argument);
 
+        TEST_EQUAL(str_to_int<int64_t>("1234567890123456789"s), 1234567890123456789ll);
+        TEST_EQUAL(str_to_int<int64_t>("-1234567890123456789"s), -1234567890123456789ll);
+        TEST_EQUAL(str_to_int<int64_t>("00000000000000000000000042"s), 42);
+        TEST_EQUAL(str_to_int<uint64_t>("12345678901234567890"s), 12345678901234567890ull);
+        TEST_EQUAL(str_to_int<uint64_t>("123456789012345678901"s), std::numeric_limits<uint64_t>::max());
+        TEST_EQUAL(str_to_int<int32_t>("+12345678"s), 12345678);
+        TEST_EQUAL(str_to_int<int32_t>("12345678xyz"s), 12345678);
+        TEST_EQUAL(str_to_int<int32_t>("1234567x90"s), 1234567);
+        TEST_EQUAL(str_to_int<int32_t>("+-42"s), 0);
+        TEST_EQUAL(str_to_int<int32_t>("-"s), 0);
+
+        s = "12345678901234567890xyz";
+        i64 = 42;
+        TEST_THROW(str_to_int(i64, s, 0, Utf::throws), std::invalid_argument);
+        TEST_EQUAL(i64, 42);
+        TEST_THROW(str_to_int(i64, s.substr(0, 20), 0, Utf::throws), std::range_error);
+        TEST_EQUAL(i64, 42);
+
     }
 
     void check_hexadecimal_integer_conversion() {
@@ -309,6 +329,106 @@ namespace {
         s = "123456.75";  TEST_EQUAL(str_to_float<double>(utf_iterator(s, 3)), 456.75);
         s = "answer 42";  TEST_EQUAL(str_to_float<double>(utf_iterator(s, 7)), 42);
 
+        TEST_EQUAL(str_to_float<double>("42."s), 42);
+        TEST_EQUAL(str_to_float<double>(".5"s), 0.5);
+        TEST_EQUAL(str_to_float<double>("."s), 0);
+        TEST_EQUAL(str_to_float<double>("0.1"s), 0.1);
+        TEST_EQUAL(str_to_float<double>("0.30000000000000004"s), 0.30000000000000004);
+        TEST_EQUAL(str_to_float<double>("1e23"s), 1e23);
+        TEST_EQUAL(str_to_float<double>("9007199254740993"s), 9007199254740992.0);
+        TEST_EQUAL(str_to_float<double>("123456789012345678901234567890"s), 123456789012345678901234567890.0);
+        TEST_EQUAL(str_to_float<double>("1.7976931348623157e308"s), std::numeric_limits<double>::max());
+        TEST_EQUAL(str_to_float<double>("4.9e-324"s), std::numeric_limits<double>::denorm_min());
+        TEST_EQUAL(str_to_float<float>("0.1"s), 0.1f);
+        TEST_EQUAL(str_to_float<float>("3.4028235e38"s), std::numeric_limits<float>::max());
+        TEST_EQUAL(str_to_float<float>("1e39"s), std::numeric_limits<float>::max());
+        TEST_EQUAL(str_to_float<long double>("0.1"s), 0.1l);
+        TEST_EQUAL(str_to_float<long double>("-6.25e-2"s), -0.0625l);
+
+        // Numbers outside the fast path must not follow the locale's decimal
+        // point; this is only tested if a comma decimal locale is installed
+
+        s = "3.14159265358979323846264338327950288";  TEST_EQUAL(str_to_float(d, s), 37);  TEST_EQUAL(d, 3.14159265358979323846264338327950288);
+        s = "1.5e300";                                TEST_EQUAL(str_to_float(d, s), 7);   TEST_EQUAL(d, 1.5e300);
+        s = "+1.5e-300";                              TEST_EQUAL(str_to_float(d, s), 9);   TEST_EQUAL(d, 1.5e-300);
+
+        U8string saved_locale = std::setlocale(LC_NUMERIC, nullptr);
+        for (auto name: {"de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "fr_FR.utf8", "de_DE", "fr_FR"}) {
+            if (! std::setlocale(LC_NUMERIC, name))
+                continue;
+            s = "3.14159265358979323846264338327950288";  TEST_EQUAL(str_to_float(d, s), 37);  TEST_EQUAL(d, 3.14159265358979323846264338327950288);
+            s = "1.5e300";                                TEST_EQUAL(str_to_float(d, s), 7);   TEST_EQUAL(d, 1.5e300);
+            s = "-1.5e400";                               TEST_EQUAL(str_to_float(d, s), 8);   TEST_EQUAL(d, - std::numeric_limits<double>::max());
+            s = "0.1";                                    TEST_EQUAL(str_to_float(ld, s), 3);  TEST_EQUAL(ld, 0.1l);
+            break;
+        }
+        std::setlocale(LC_NUMERIC, saved_locale.data());
+
+        s = "1.5e";     TEST_EQUAL(str_to_float(d, s), 3);  TEST_EQUAL(d, 1.5);
+        s = "1.5e+";    TEST_EQUAL(str_to_float(d, s), 3);  TEST_EQUAL(d, 1.5);
+        s = "1.5e+2x";  TEST_EQUAL(str_to_float(d, s), 6);  TEST_EQUAL(d, 150);
+        s = "0x10";     TEST_EQUAL(str_to_float(d, s), 1);  TEST_EQUAL(d, 0);
+        s = "-0";       TEST_EQUAL(str_to_float(d, s), 2);  TEST_EQUAL(d, 0);  TEST(std::signbit(d));
+
+    }
+
+    void check_batch_integer_conversion() {
+
+        std::vector<int> v;
+        std::vector<uint8_t> u;
+
+        TEST_EQUAL(str_to_ints<int>("", std::back_inserter(v)), 0);
+        TEST(v.empty());
+        TEST_EQUAL(str_to_ints<int>("1,2,3", std::back_inserter(v)), 3);
+        TEST_EQUAL_RANGE(v, (std::vector<int>{1, 2, 3}));
+        v.clear();
+        TEST_EQUAL(str_to_ints<int>(" 10, -20,,30\t40\r\n", std::back_inserter(v)), 5);
+        TEST_EQUAL_RANGE(v, (std::vector<int>{10, -20, 0, 30, 40}));
+        v.clear();
+        TEST_EQUAL(str_to_ints<int>(" \t\r\n", std::back_inserter(v)), 0);
+        TEST(v.empty());
+        TEST_EQUAL(str_to_ints<int>("1,,3", std::back_inserter(v)), 3);
+        TEST_EQUAL_RANGE(v, (std::vector<int>{1, 0, 3}));
+        v.clear();
+        TEST_EQUAL(str_to_ints<int>("1,2,", std::back_inserter(v)), 3);
+        TEST_EQUAL_RANGE(v, (std::vector<int>{1, 2, 0}));
+        v.clear();
+        TEST_EQUAL(str_to_ints<int>(",2, ,4 ,\n", std::back_inserter(v)), 5);
+        TEST_EQUAL_RANGE(v, (std::vector<int>{0, 2, 0, 4, 0}));
+        v.clear();
+        TEST_EQUAL(str_to_ints<int>("1||3|", std::back_inserter(v), "|"), 4);
+        TEST_EQUAL_RANGE(v, (std::vector<int>{1, 0, 3, 0}));
+        v.clear();
+        TEST_EQUAL(str_to_ints<int>(",", std::back_inserter(v)), 2);
+        TEST_EQUAL_RANGE(v, (std::vector<int>{0, 0}));
+        v.clear();
+        TEST_EQUAL(str_to_ints<int>("12345678901|-42|7x", std::back_inserter(v), "|"), 3);
+        TEST_EQUAL_RANGE(v, (std::vector<int>{2147483647, -42, 7}));
+        v.clear();
+        TEST_EQUAL(str_to_ints<int>(u8"1\u00b72\u00b73", std::back_inserter(v), u8"\u00b7"), 3);
+        TEST_EQUAL_RANGE(v, (std::vector<int>{1, 2, 3}));
+        v.clear();
+        TEST_EQUAL(str_to_ints<int>("1;2 3", std::back_inserter(v), CharSet(";")), 2);
+        TEST_EQUAL_RANGE(v, (std::vector<int>{1, 2}));
+        v.clear();
+        TEST_EQUAL(str_to_ints<int>("1\t\t3", std::back_inserter(v), "\t"), 3);
+        TEST_EQUAL_RANGE(v, (std::vector<int>{1, 0, 3}));
+        v.clear();
+        TEST_EQUAL(str_to_ints<int>(" 1\t\t 3 \t", std::back_inserter(v), "\t"), 4);
+        TEST_EQUAL_RANGE(v, (std::vector<int>{1, 0, 3, 0}));
+        v.clear();
+        TEST_EQUAL(str_to_ints<int>("1\t\t3", std::back_inserter(v), "\t", Fields::merge), 2);
+        TEST_EQUAL_RANGE(v, (std::vector<int>{1, 3}));
+        v.clear();
+        TEST_EQUAL(str_to_ints<int>(" 1 , 2 ,, 3 ", std::back_inserter(v), ","), 4);
+        TEST_EQUAL_RANGE(v, (std::vector<int>{1, 2, 0, 3}));
+        TEST_EQUAL(str_to_ints<uint8_t>("1 255", std::back_inserter(u), " ", Utf::throws), 2);
+        TEST_EQUAL(u.size(), 2u);
+
+        TEST_THROW(str_to_ints<int>("1,2x,3", std::back_inserter(v), ",", Utf::throws), std::invalid_argument);
+        TEST_THROW(str_to_ints<int>("1,,3", std::back_inserter(v), ",", Utf::throws), std::invalid_argument);
+        TEST_THROW(str_to_ints<uint8_t>("1 256", std::back_inserter(u), " ", Utf::throws), std::range_error);
+
     }
 
 }
@@ -318,5 +438,6 @@ TEST_MODULE(unicorn, string_conversion) {
     check_decimal_integer_conversion();
     check_hexadecimal_integer_conversion();
     check_floating_point_conversion();
+    check_batch_integer_conversion();
 
 }
@@ -0,0 +1,320 @@
+#include "unicorn/string.hpp"
+#include <charconv>
+#include <clocale>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+namespace RS::Unicorn {
+
+    namespace {
+
+        constexpr uint64_t ones = 0x0101010101010101ull;
+        constexpr uint64_t max_u64 = ~ uint64_t(0);
+
+        // Load the next 8 bytes with the first byte in the low bits
+
+        uint64_t load_le64(const char* ptr) noexcept {
+            uint64_t x;
+            std::memcpy(&x, ptr, 8);
+            #if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+                x = __builtin_bswap64(x);
+            #endif
+            return x;
+        }
+
+        // A block is all digits if every high nibble is 3, and adding 6 to
+        // each byte does not carry out of the low nibble
+
+        bool is_eight_digits(uint64_t x) noexcept {
+            static constexpr uint64_t high_nibbles = 0xf0 * ones;
+            return ((x & high_nibbles) | (((x + 6 * ones) & high_nibbles) >> 4)) == 0x33 * ones;
+        }
+
+        // Combine 8 digits in three multiplications: adjacent pairs of
+        // digits, then pairs of pairs, then the two halves
+
+        uint64_t eight_digits_value(uint64_t x) noexcept {
+            static constexpr uint64_t mask = 0x000000ff000000ffull;
+            static constexpr uint64_t mul1 = 100 + (1000000ull << 32);
+            static constexpr uint64_t mul2 = 1 + (10000ull << 32);
+            x -= 0x30 * ones;
+            x = x * 10 + (x >> 8);
+            return (((x & mask) * mul1) + (((x >> 16) & mask) * mul2)) >> 32;
+        }
+
+        // Accumulate a run of decimal digits into value, 8 at a time while
+        // that cannot overflow. Returns the length of the run; over is set
+        // if the value no longer fits.
+
+        size_t accumulate_decimal(const char* ptr, size_t n, uint64_t& value, bool& over) noexcept {
+            static constexpr uint64_t max_before_block = 100'000'000'000ull;
+            size_t i = 0;
+            for (; n - i >= 8 && value < max_before_block; i += 8) {
+                uint64_t x = load_le64(ptr + i);
+                if (! is_eight_digits(x))
+                    break;
+                value = value * 100'000'000 + eight_digits_value(x);
+            }
+            for (; i < n; ++i) {
+                unsigned d = uint8_t(ptr[i]) - unsigned('0');
+                if (d > 9)
+                    break;
+                if (value > (max_u64 - d) / 10)
+                    over = true;
+                else
+                    value = value * 10 + d;
+            }
+            return i;
+        }
+
+        int hex_digit_value(char c) noexcept {
+            if (c >= '0' && c <= '9')
+                return c - '0';
+            else if (c >= 'A' && c <= 'F')
+                return c - 'A' + 10;
+            else if (c >= 'a' && c <= 'f')
+                return c - 'a' + 10;
+            else
+                return -1;
+        }
+
+        // Limits within which a decimal mantissa and power of ten are both
+        // exactly representable, so that one multiplication or division
+        // gives a correctly rounded result (Clinger's fast path). Long
+        // double is only assumed to be at least as precise as double.
+
+        template <typename T> struct FloatLimits;
+        template <> struct FloatLimits<float> {
+            static constexpr uint64_t max_mantissa = uint64_t(1) << 24;
+            static constexpr int max_exponent = 10;
+            static float convert(const char* ptr) noexcept { return std::strtof(ptr, nullptr); }
+        };
+        template <> struct FloatLimits<double> {
+            static constexpr uint64_t max_mantissa = uint64_t(1) << 53;
+            static constexpr int max_exponent = 22;
+            static double convert(const char* ptr) noexcept { return std::strtod(ptr, nullptr); }
+        };
+        template <> struct FloatLimits<long double> {
+            static constexpr uint64_t max_mantissa = uint64_t(1) << 53;
+            static constexpr int max_exponent = 22;
+            static long double convert(const char* ptr) noexcept { return std::strtold(ptr, nullptr); }
+        };
+
+        constexpr double exact_powers_of_ten[] = {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+        };
+
+        // Convert a number already known to be valid, independently of the
+        // current locale. This uses from_chars() where it is available;
+        // otherwise, or if the value is out of range (where from_chars()
+        // leaves it unset), strtod() is called on a copy with the decimal
+        // point replaced by the one the C locale currently expects. The copy
+        // is made in a stack buffer, unless the number is too long to fit.
+
+        template <typename T>
+        T convert_float(const char* ptr, size_t n) {
+            #ifdef __cpp_lib_to_chars
+                // from_chars() does not accept a leading plus sign
+                size_t i = n > 0 && ptr[0] == '+' ? 1 : 0;
+                T value = T(0);
+                auto rc = std::from_chars(ptr + i, ptr + n, value);
+                if (rc.ec == std::errc() && rc.ptr == ptr + n)
+                    return value;
+            #endif
+            const char* point = "";
+            size_t point_len = 0;
+            if (std::memchr(ptr, '.', n)) {
+                auto lc = std::localeconv();
+                if (lc && lc->decimal_point && std::strcmp(lc->decimal_point, ".") != 0) {
+                    point = lc->decimal_point;
+                    point_len = std::strlen(point);
+                }
+            }
+            char buf[128];
+            std::unique_ptr<char[]> heap;
+            char* str = buf;
+            if (n + point_len >= sizeof(buf)) {
+                heap.reset(new char[n + point_len + 1]);
+                str = heap.get();
+            }
+            char* out = str;
+            for (size_t i = 0; i < n; ++i) {
+                if (ptr[i] == '.' && point_len > 0) {
+                    std::memcpy(out, point, point_len);
+                    out += point_len;
+                } else {
+                    *out++ = ptr[i];
+                }
+            }
+            *out = '\0';
+            return FloatLimits<T>::convert(str);
+        }
+
+        // Read a decimal floating point number, following the syntax of
+        // strtod() without leading whitespace, hexadecimal, infinity, or
+        // NaN. Numbers outside the fast path are passed to convert_float(),
+        // on a copy of the number alone.
+
+        template <typename T>
+        size_t parse_float_helper(const char* ptr, size_t n, T& t) {
+            using limits = FloatLimits<T>;
+            static constexpr size_t max_exponent_digits = 6;
+            size_t i = 0;
+            bool neg = false;
+            if (n > 0 && (ptr[0] == '+' || ptr[0] == '-')) {
+                neg = ptr[0] == '-';
+                ++i;
+            }
+            uint64_t mantissa = 0;
+            bool over = false;
+            size_t int_digits = accumulate_decimal(ptr + i, n - i, mantissa, over);
+            size_t frac_digits = 0;
+            i += int_digits;
+            if (i < n && ptr[i] == '.') {
+                frac_digits = accumulate_decimal(ptr + i + 1, n - i - 1, mantissa, over);
+                if (int_digits + frac_digits > 0)
+                    i += frac_digits + 1;
+            }
+            if (int_digits + frac_digits == 0)
+                return 0;
+            long exponent = 0;
+            if (i + 1 < n && (ptr[i] == 'E' || ptr[i] == 'e')) {
+                size_t j = i + 1;
+                bool exp_neg = false;
+                if (ptr[j] == '+' || ptr[j] == '-') {
+                    exp_neg = ptr[j] == '-';
+                    ++j;
+                }
+                size_t k = j;
+                for (; k < n && ptr[k] >= '0' && ptr[k] <= '9'; ++k)
+                    if (k - j < max_exponent_digits)
+                        exponent = 10 * exponent + (ptr[k] - '0');
+                if (k > j) {
+                    if (k - j > max_exponent_digits)
+                        over = true;
+                    if (exp_neg)
+                        exponent = - exponent;
+                    i = k;
+                }
+            }
+            exponent -= long(frac_digits);
+            if (! over && mantissa == 0) {
+                t = neg ? - T(0) : T(0);
+            } else if (! over && mantissa <= limits::max_mantissa
+                    && exponent >= - limits::max_exponent && exponent <= limits::max_exponent) {
+                T value = T(mantissa);
+                if (exponent < 0)
+                    value /= T(exact_powers_of_ten[- exponent]);
+                else
+                    value *= T(exact_powers_of_ten[exponent]);
+                t = neg ? - value : value;
+            } else {
+                t = convert_float<T>(ptr, i);
+            }
+            return i;
+        }
+
+    }
+
+    namespace UnicornDetail {
+
+        size_t parse_integer(const char* ptr, size_t n, int base, unsigned long long& value, bool& neg, bool& over) noexcept {
+            uint64_t v = 0;
+            size_t i = 0;
+            neg = over = false;
+            if (n > 0 && (ptr[0] == '+' || ptr[0] == '-')) {
+                neg = ptr[0] == '-';
+                ++i;
+            }
+            size_t start = i;
+            if (base == 16) {
+                for (int d; i < n && (d = hex_digit_value(ptr[i])) >= 0; ++i) {
+                    if (v > (max_u64 >> 4))
+                        over = true;
+                    else
+                        v = (v << 4) + unsigned(d);
+                }
+            } else {
+                i += accumulate_decimal(ptr + i, n - i, v, over);
+            }
+            if (i == start)
+                return 0;
+            value = v;
+            return i;
+        }
+
+        size_t parse_float(const char* ptr, size_t n, float& t) { return parse_float_helper(ptr, n, t); }
+        size_t parse_float(const char* ptr, size_t n, double& t) { return parse_float_helper(ptr, n, t); }
+        size_t parse_float(const char* ptr, size_t n, long double& t) { return parse_float_helper(ptr, n, t); }
+
+        // Decode one character from a string view, returning its length
+
+        size_t field_char(std::string_view src, size_t i, char32_t& c) noexcept {
+            if (uint8_t(src[i]) < 0x80) {
+                c = char32_t(src[i]);
+                return 1;
+            }
+            auto u = utf_iterator(src, i);
+            c = *u;
+            return std::max(u.count(), size_t(1));
+        }
+
+        // Whitespace around a field is padding, unless it is a delimiter;
+        // whitespace delimiters are also padding in merge mode
+
+        bool is_padding(char32_t c, const CharSet& delim, bool merge) noexcept {
+            return char_is_white_space(c) && (merge || ! delim(c));
+        }
+
+        size_t skip_padding(std::string_view src, const CharSet& delim, bool merge, size_t i) noexcept {
+            char32_t c = 0;
+            while (i < src.size()) {
+                size_t k = field_char(src, i, c);
+                if (! is_padding(c, delim, merge))
+                    break;
+                i += k;
+            }
+            return i;
+        }
+
+        // On entry pos is where to start scanning, or npos when there are no
+        // more fields; on return the field is [start,start+len), and pos is
+        // just past the delimiter that ended it. A field that reaches the
+        // end of the string (or an empty string) leaves pos at npos.
+
+        bool next_field(std::string_view src, const CharSet& delim, bool merge, size_t& pos, size_t& start, size_t& len) noexcept {
+            size_t n = src.size();
+            if (pos == npos)
+                return false;
+            size_t i = skip_padding(src, delim, merge, pos);
+            if (i == n && pos == 0) {
+                pos = npos;
+                return false;
+            }
+            start = i;
+            size_t end = i;
+            char32_t c = 0;
+            while (i < n) {
+                size_t k = field_char(src, i, c);
+                if (delim(c))
+                    break;
+                i += k;
+                if (! is_padding(c, delim, merge))
+                    end = i;
+            }
+            len = end - start;
+            i = skip_padding(src, delim, merge, i);
+            if (i == n) {
+                pos = npos;
+            } else {
+                size_t k = field_char(src, i, c);
+                pos = delim(c) ? i + k : i;
+            }
+            return true;
+        }
+
+    }
+
+}
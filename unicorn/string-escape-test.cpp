@@ -81,6 +81,10 @@ namespace {
         s1 = u8"(\"\u0001\u0080§¶ \\ €uro \U00012000\n\")";  TRY(s2 = str_escape(s1, Escape::nostdc));  TEST_EQUAL(s2, u8"(\"\\x01\u0080§¶ \\\\ €uro \U00012000\\x0a\")");
         s1 = u8"(\"\u0001\u0080§¶ \\ €uro \U00012000\n\")";  TRY(s2 = str_escape(s1, Escape::pcre));    TEST_EQUAL(s2, u8"(\"\\x01\\x{80}\\x{a7}\\x{b6} \\\\ \\x{20ac}uro \\x{12000}\\n\")");
         s1 = u8"(\"\u0001\u0080§¶ \\ €uro \U00012000\n\")";  TRY(s2 = str_escape(s1, Escape::punct));   TEST_EQUAL(s2, u8"\\(\\\"\\x01\u0080§¶ \\\\ €uro \U00012000\\n\\\"\\)");
+        s1 = u8"(\"\u0001\u0080§¶ \\ €uro \U00012000\n\")";  TRY(s2 = str_escape(s1, Escape::json));                   TEST_EQUAL(s2, u8"(\\\"\\u0001\u0080§¶ \\\\ €uro \U00012000\\n\\\")");
+        s1 = u8"(\"\u0001\u0080§¶ \\ €uro \U00012000\n\")";  TRY(s2 = str_escape(s1, Escape::json | Escape::ascii));   TEST_EQUAL(s2, u8"(\\\"\\u0001\\u0080\\u00a7\\u00b6 \\\\ \\u20acuro \\ud808\\udc00\\n\\\")");
+        s1 = u8"(\"\u0001\u0080§¶ \\ €uro \U00012000\n\")";  TRY(s2 = str_escape(s1, Escape::json | Escape::nostdc));  TEST_EQUAL(s2, u8"(\\\"\\u0001\u0080§¶ \\\\ €uro \U00012000\\u000a\\\")");
+        s1 = u8"\a\b\t\v\f\r\u007f/'";                          TRY(s2 = str_escape(s1, Escape::json));                   TEST_EQUAL(s2, u8"\\u0007\\b\\t\\u000b\\f\\r\u007f/'");
 
         s1 = "";                                             TRY(str_escape_in(s1));                  TEST_EQUAL(s1, "");
         s1 = "Hello world";                                  TRY(str_escape_in(s1));                  TEST_EQUAL(s1, "Hello world");
@@ -101,6 +105,8 @@ namespace {
         s1 = u8"(\"\\x01\u0080§¶ \\\\ €uro \U00012000\\x0a\")";                     TRY(s2 = str_unescape(s1));  TEST_EQUAL(s2, u8"(\"\u0001\u0080§¶ \\ €uro \U00012000\n\")");
         s1 = u8"(\"\\x01\\x{80}\\x{a7}\\x{b6} \\\\ \\x{20ac}uro \\x{12000}\\n\")";  TRY(s2 = str_unescape(s1));  TEST_EQUAL(s2, u8"(\"\u0001\u0080§¶ \\ €uro \U00012000\n\")");
         s1 = u8"\\(\\\"\\x01\u0080§¶ \\\\ €uro \U00012000\\n\\\"\\)";               TRY(s2 = str_unescape(s1));  TEST_EQUAL(s2, u8"(\"\u0001\u0080§¶ \\ €uro \U00012000\n\")");
+        s1 = u8"(\\\"\\u0001\\u0080\\u00a7\\u00b6 \\\\ \\u20acuro \\ud808\\udc00\\n\\\")";    TRY(s2 = str_unescape(s1));  TEST_EQUAL(s2, u8"(\"\u0001\u0080§¶ \\ €uro \U00012000\n\")");
+        s1 = u8"\\ud83d\\ude00 \\/ \\ud83dx";                                              TRY(s2 = str_unescape(s1));  TEST_EQUAL(s2, u8"\U0001f600 / \ufffdx");
 
         s1 = "";                                                                    TRY(str_unescape_in(s1));  TEST_EQUAL(s1, "");
         s1 = "Hello world";                                                         TRY(str_unescape_in(s1));  TEST_EQUAL(s1, "Hello world");
@@ -129,6 +135,10 @@ namespace {
         s1 = u8"(\"\u0001\u0080§¶ \\ €uro \U00012000\n\")";  TRY(s2 = str_quote(s1, Escape::pcre));    TEST_EQUAL(s2, u8"\"(\\\"\\x01\\x{80}\\x{a7}\\x{b6} \\\\ \\x{20ac}uro \\x{12000}\\n\\\")\"");
         s1 = u8"(\"\u0001\u0080§¶ \\ €uro \U00012000\n\")";  TRY(s2 = str_quote(s1, Escape::punct));   TEST_EQUAL(s2, u8"\"\\(\\\"\\x01\u0080§¶ \\\\ €uro \U00012000\\n\\\"\\)\"");
         s1 = u8"(\"\u0001\u0080§¶ \\ €uro \U00012000\n\")";  TRY(s2 = str_quote(s1, 0, U'\''));        TEST_EQUAL(s2, u8"'(\"\\x01\u0080§¶ \\\\ €uro \U00012000\\n\")'");
+        s1 = u8"(\"\u0001\u0080§¶ \\ €uro \U00012000\n\")";  TRY(s2 = str_quote(s1, Escape::json));    TEST_EQUAL(s2, u8"\"(\\\"\\u0001\u0080§¶ \\\\ €uro \U00012000\\n\\\")\"");
+        s1 = u8"It's \"€uro\"";                              TRY(s2 = str_quote(s1, Escape::json, U'\''));             TEST_EQUAL(s2, u8"'It\\u0027s \\\"€uro\\\"'");
+        s1 = u8"«€uro»";                                     TRY(s2 = str_quote(s1, Escape::json, U'»'));              TEST_EQUAL(s2, u8"»«€uro\\u00bb»");
+        s1 = u8"«€uro»";                                     TRY(s2 = str_quote(s1, Escape::json | Escape::ascii, U'»'));  TEST_EQUAL(s2, u8"»\\u00ab\\u20acuro\\u00bb»");
 
         s1 = "";                                             TRY(str_quote_in(s1));                  TEST_EQUAL(s1, "\"\"");
         s1 = "Hello world";                                  TRY(str_quote_in(s1));                  TEST_EQUAL(s1, "\"Hello world\"");
@@ -61,24 +61,76 @@ namespace RS::Unicorn {
             append_hex_digits(uint8_t(c), dst, 2);
         }
 
-        void encode_uri_helper(const U8string& src, U8string& dst, const char* escaped) {
-            for (auto in = utf_begin(src), end = utf_end(src); in != end; ++in) {
-                if (*in >= 33 && *in <= 126 && ! strchr(escaped, char(*in))) {
-                    dst += char(*in);
-                } else {
-                    for (char c: in.range()) {
-                        dst += '%';
-                        RS_Detail::append_hex_byte(uint8_t(c), dst);
-                    }
+        constexpr uint32_t decode_xdigit(char32_t c) {
+            return c >= U'0' && c <= U'9' ? c - U'0'
+                : c >= U'A' && c <= U'F' ? c - U'A' + 10
+                : c >= U'a' && c <= U'f' ? c - U'a' + 10 : 0;
+        }
+
+        // Tables of the bytes that can be copied to the output unchanged,
+        // so runs of them can be found with one lookup per byte and copied
+        // in bulk
+
+        struct ByteTable {
+            bool plain[256];
+            bool operator[](char c) const noexcept { return plain[uint8_t(c)]; }
+        };
+
+        constexpr bool in_set(const char* set, char32_t c) {
+            for (; *set; ++set)
+                if (char32_t(*set) == c)
+                    return true;
+            return false;
+        }
+
+        template <typename Pred>
+        constexpr ByteTable make_byte_table(Pred p) {
+            ByteTable t = {};
+            for (char32_t c = 0; c < 256; ++c)
+                t.plain[c] = p(c);
+            return t;
+        }
+
+        constexpr auto uri_comp_plain = make_byte_table([] (char32_t c) { return c >= 33 && c <= 126 && ! in_set(uri_comp_escaped, c); });
+        constexpr auto uri_full_plain = make_byte_table([] (char32_t c) { return c >= 33 && c <= 126 && ! in_set(uri_full_escaped, c); });
+        constexpr auto escape_plain = make_byte_table([] (char32_t c) { return c >= 32 && c <= 126 && c != U'\\'; });
+        constexpr auto escape_punct_plain = make_byte_table([] (char32_t c) {
+            return c == U' ' || (c >= U'0' && c <= U'9') || (c >= U'A' && c <= U'Z') || (c >= U'a' && c <= U'z');
+        });
+        constexpr auto json_plain = make_byte_table([] (char32_t c) { return c >= 32 && c <= 126 && c != U'\\' && c != U'\"'; });
+
+        void encode_uri_helper(const U8string& src, U8string& dst, const ByteTable& table) {
+            size_t i = 0, size = src.size(), escaped = 0;
+            for (char c: src)
+                escaped += ! table[c];
+            dst.reserve(dst.size() + size + 2 * escaped);
+            while (i < size) {
+                size_t j = i;
+                while (j < size && table[src[j]])
+                    ++j;
+                dst.append(src, i, j - i);
+                for (i = j; i < size && ! table[src[i]]; ++i) {
+                    auto b = uint8_t(src[i]);
+                    dst += '%';
+                    dst += hexdigits[b >> 4];
+                    dst += hexdigits[b & 15];
                 }
             }
         }
 
         void unencode_uri_helper(const U8string& src, U8string& dst) {
             size_t i = 0, size = src.size();
+            dst.reserve(dst.size() + size);
             while (i < size) {
-                if (src[i] == '%' && size - i >= 3 && ascii_isxdigit(src[i + 1]) && ascii_isxdigit(src[i + 2])) {
-                    dst += char(hexnum(src.substr(i + 1, 2)));
+                size_t j = src.find('%', i);
+                if (j == npos)
+                    j = size;
+                dst.append(src, i, j - i);
+                i = j;
+                if (i == size)
+                    break;
+                if (size - i >= 3 && ascii_isxdigit(src[i + 1]) && ascii_isxdigit(src[i + 2])) {
+                    dst += char((decode_xdigit(src[i + 1]) << 4) + decode_xdigit(src[i + 2]));
                     i += 3;
                 } else {
                     dst += src[i++];
@@ -86,35 +138,69 @@ namespace RS::Unicorn {
             }
         }
 
-        void escape_helper(const U8string& src, U8string& dst, uint32_t flags, char32_t quote = 0xffffffff) {
+        void escape_char_c(char32_t c, U8string& dst, uint32_t flags, char32_t quote) {
             const bool ascii = flags & (Escape::ascii | Escape::pcre);
             const bool nostdc = flags & Escape::nostdc;
             const bool pcre = flags & Escape::pcre;
             const bool punct = flags & Escape::punct;
-            for (char32_t c: utf_range(src)) {
-                if (! nostdc && (c == 0 || (c >= U'\a' && c <= U'\r'))) {
-                    append_escape_stdc(c, dst);
-                } else if (c <= 0x1f || c == 0x7f) {
-                    append_escape_x2(c, dst);
-                } else if (c == U'\\' || c == quote || (punct && c < 0x80 && ascii_ispunct(char(c)))) {
-                    dst += '\\';
-                    dst += char(c);
-                } else if (c < 0x80 || ! ascii) {
-                    str_append_char(dst, c);
-                } else if (pcre) {
-                    append_escape_pcre(c, dst);
-                } else if (c <= 0xffff) {
-                    append_escape_u4(c, dst);
-                } else {
-                    append_escape_u8(c, dst);
-                }
+            if (! nostdc && (c == 0 || (c >= U'\a' && c <= U'\r'))) {
+                append_escape_stdc(c, dst);
+            } else if (c <= 0x1f || c == 0x7f) {
+                append_escape_x2(c, dst);
+            } else if (c == U'\\' || c == quote || (punct && c < 0x80 && ascii_ispunct(char(c)))) {
+                dst += '\\';
+                dst += char(c);
+            } else if (c < 0x80 || ! ascii) {
+                str_append_char(dst, c);
+            } else if (pcre) {
+                append_escape_pcre(c, dst);
+            } else if (c <= 0xffff) {
+                append_escape_u4(c, dst);
+            } else {
+                append_escape_u8(c, dst);
             }
         }
 
-        constexpr uint32_t decode_xdigit(char32_t c) {
-            return c >= U'0' && c <= U'9' ? c - U'0'
-                : c >= U'A' && c <= U'F' ? c - U'A' + 10
-                : c >= U'a' && c <= U'f' ? c - U'a' + 10 : 0;
+        void escape_char_json(char32_t c, U8string& dst, uint32_t flags, char32_t quote) {
+            const bool ascii = flags & Escape::ascii;
+            const bool nostdc = flags & Escape::nostdc;
+            // JSON has no escape for any other quote character, so a custom
+            // quote is written as a \u escape
+            if (c == U'\\' || c == U'\"') {
+                dst += '\\';
+                str_append_char(dst, c);
+            } else if (! nostdc && (c == U'\b' || c == U'\t' || c == U'\n' || c == U'\f' || c == U'\r')) {
+                append_escape_stdc(c, dst);
+            } else if (c > 0x1f && c != quote && (c < 0x80 || ! ascii)) {
+                str_append_char(dst, c);
+            } else if (c <= 0xffff) {
+                append_escape_u4(c, dst);
+            } else {
+                c -= 0x10000;
+                append_escape_u4(char16_t(0xd800 + (c >> 10)), dst);
+                append_escape_u4(char16_t(0xdc00 + (c & 0x3ff)), dst);
+            }
+        }
+
+        void escape_helper(const U8string& src, U8string& dst, uint32_t flags, char32_t quote = 0xffffffff) {
+            const bool json = flags & Escape::json;
+            const auto& table = json ? json_plain : flags & Escape::punct ? escape_punct_plain : escape_plain;
+            const auto escape_char = json ? escape_char_json : escape_char_c;
+            // A backslash is never plain, so it can stand in for a non-ASCII quote
+            const char q = quote < 0x80 ? char(quote) : '\\';
+            size_t i = 0, size = src.size();
+            dst.reserve(dst.size() + size);
+            while (i < size) {
+                size_t j = i;
+                while (j < size && table[src[j]] && src[j] != q)
+                    ++j;
+                dst.append(src, i, j - i);
+                if (j == size)
+                    break;
+                auto k = utf_iterator(src, j);
+                escape_char(*k, dst, flags, quote);
+                i = j + k.count();
+            }
         }
 
         void read_hex_char(Utf8Iterator& i, Utf8Iterator end, char32_t& c, size_t maxlen, bool varlen) {
@@ -136,11 +222,43 @@ namespace RS::Unicorn {
             }
         }
 
+        void read_low_surrogate(Utf8Iterator& i, Utf8Iterator end, char32_t& c) {
+            // Combine a UTF-16 surrogate pair written as two \u escapes (as
+            // in JSON); a high surrogate on its own is left for the caller
+            auto j = i;
+            if (j == end || *j != U'\\' || ++j == end || *j != U'u')
+                return;
+            char32_t d = 0;
+            read_hex_char(++j, end, d, 4, false);
+            if (d >= 0xdc00 && d <= 0xdfff) {
+                c = 0x10000 + ((c - 0xd800) << 10) + (d - 0xdc00);
+                i = j;
+            }
+        }
+
         Utf8Iterator unescape_helper(const Utf8Iterator& begin, const Utf8Iterator& end, U8string& dst, char32_t quote = 0xffffffff) {
+            const auto& src = begin.source();
+            const char q = quote < 0x80 ? char(quote) : '\\';
+            const size_t stop = end.offset();
+            dst.reserve(dst.size() + stop - begin.offset());
             auto i = begin, j = begin;
             while (i != end) {
-                for (j = i; j != end && *j != U'\\' && *j != quote; ++j) {}
-                str_append(dst, i, j);
+                // Find the next backslash or quote with one test per byte;
+                // non-ASCII characters only need decoding to check for a
+                // non-ASCII quote
+                size_t p = i.offset(), k = p;
+                for (;;) {
+                    while (k < stop && uint8_t(src[k]) < 0x80 && src[k] != '\\' && src[k] != q)
+                        ++k;
+                    if (k == stop || uint8_t(src[k]) < 0x80)
+                        break;
+                    auto x = Utf8Iterator(src, k);
+                    if (*x == quote)
+                        break;
+                    k += x.count();
+                }
+                dst.append(src, p, k - p);
+                j = k == stop ? end : Utf8Iterator(src, k);
                 if (j == end || *j == quote)
                     return j;
                 i = std::next(j);
@@ -159,10 +277,17 @@ namespace RS::Unicorn {
                     case U'f':  c = U'\f'; ++i; break;
                     case U'r':  c = U'\r'; ++i; break;
                     case U'x':  ++i; read_hex_char(i, end, c, 2, true); break;
-                    case U'u':  ++i; read_hex_char(i, end, c, 4, false); break;
+                    case U'u':
+                        ++i;
+                        read_hex_char(i, end, c, 4, false);
+                        if (c >= 0xd800 && c <= 0xdbff)
+                            read_low_surrogate(i, end, c);
+                        break;
                     case U'U':  ++i; read_hex_char(i, end, c, 8, false); break;
                     default:    ++i; break;
                 }
+                if (char_is_surrogate(c))
+                    c = replacement_char;
                 str_append_char(dst, c);
             }
             return end;
@@ -180,25 +305,25 @@ namespace RS::Unicorn {
 
     U8string str_encode_uri(const U8string& str) {
         U8string result;
-        encode_uri_helper(str, result, uri_full_escaped);
+        encode_uri_helper(str, result, uri_full_plain);
         return result;
     }
 
     U8string str_encode_uri_component(const U8string& str) {
         U8string result;
-        encode_uri_helper(str, result, uri_comp_escaped);
+        encode_uri_helper(str, result, uri_comp_plain);
         return result;
     }
 
     void str_encode_uri_in(U8string& str) {
         U8string result;
-        encode_uri_helper(str, result, uri_full_escaped);
+        encode_uri_helper(str, result, uri_full_plain);
         str = move(result);
     }
 
     void str_encode_uri_component_in(U8string& str) {
         U8string result;
-        encode_uri_helper(str, result, uri_comp_escaped);
+        encode_uri_helper(str, result, uri_comp_plain);
         str = move(result);
     }
 
@@ -165,6 +165,8 @@ namespace {
         TEST(str_partition_by("Hello_world"s, s, t, "+-_"));            TEST_EQUAL(s, "Hello");  TEST_EQUAL(t, "world");
         TEST(str_partition_by("Hello_brave_new_world"s, s, t, "+-_"));  TEST_EQUAL(s, "Hello");  TEST_EQUAL(t, "brave_new_world");
         TEST(str_partition_by("€uro∇√∈lement∇√"s, s, t, "√∫∂∇"));       TEST_EQUAL(s, "€uro");   TEST_EQUAL(t, "∈lement∇√");
+        TEST(str_partition_by("€uro∇√∈lement∇√"s, s, t, CharSet("√∫∂∇")));  TEST_EQUAL(s, "€uro");   TEST_EQUAL(t, "∈lement∇√");
+        TEST(! str_partition_by("€uro"s, s, t, CharSet("√∫∂∇")));            TEST_EQUAL(s, "€uro");   TEST_EQUAL(t, "");
 
     }
 
@@ -176,6 +178,8 @@ namespace {
         s = u8"";             TRY(t = str_remove(s, u8"aeiou"));                                    TEST_EQUAL(t, u8"");
         s = u8"Hello world";  TRY(t = str_remove(s, U'o'));                                         TEST_EQUAL(t, u8"Hell wrld");
         s = u8"Hello world";  TRY(t = str_remove(s, u8"aeiou"));                                    TEST_EQUAL(t, u8"Hll wrld");
+        s = u8"€uro ∈lement";  TRY(t = str_remove(s, u8"€∈"));                                      TEST_EQUAL(t, u8"uro lement");
+        s = u8"€uro ∈lement";  TRY(t = str_remove(s, CharSet(u8"€∈e")));                            TEST_EQUAL(t, u8"uro lmnt");
         s = u8"";             TRY(t = str_remove_if(s, [] (char32_t c) { return c < U'a'; }));      TEST_EQUAL(t, u8"");
         s = u8"Hello world";  TRY(t = str_remove_if(s, [] (char32_t c) { return c < U'a'; }));      TEST_EQUAL(t, u8"elloworld");
         s = u8"";             TRY(t = str_remove_if_not(s, [] (char32_t c) { return c < U'a'; }));  TEST_EQUAL(t, u8"");
@@ -185,11 +189,18 @@ namespace {
         s = u8"";             TRY(str_remove_in(s, u8"aeiou"));                                    TEST_EQUAL(s, u8"");
         s = u8"Hello world";  TRY(str_remove_in(s, U'o'));                                         TEST_EQUAL(s, u8"Hell wrld");
         s = u8"Hello world";  TRY(str_remove_in(s, u8"aeiou"));                                    TEST_EQUAL(s, u8"Hll wrld");
+        s = u8"€uro ∈lement";  TRY(str_remove_in(s, CharSet(u8"€∈e")));                            TEST_EQUAL(s, u8"uro lmnt");
         s = u8"";             TRY(str_remove_in_if(s, [] (char32_t c) { return c < U'a'; }));      TEST_EQUAL(s, u8"");
         s = u8"Hello world";  TRY(str_remove_in_if(s, [] (char32_t c) { return c < U'a'; }));      TEST_EQUAL(s, u8"elloworld");
         s = u8"";             TRY(str_remove_in_if_not(s, [] (char32_t c) { return c < U'a'; }));  TEST_EQUAL(s, u8"");
         s = u8"Hello world";  TRY(str_remove_in_if_not(s, [] (char32_t c) { return c < U'a'; }));  TEST_EQUAL(s, u8"H ");
 
+        s = u8"";                       TRY(t = str_remove_if(s, GcSet("Z,P")));      TEST_EQUAL(t, u8"");
+        s = u8"Hello, wörld! «€10»";    TRY(t = str_remove_if(s, GcSet("Z,P")));      TEST_EQUAL(t, u8"Hellowörld€10");
+        s = u8"Hello, wörld! «€10»";    TRY(t = str_remove_if_not(s, GcSet("L&")));   TEST_EQUAL(t, u8"Hellowörld");
+        s = u8"Hello, wörld! «€10»";    TRY(str_remove_in_if(s, GcSet("Ll")));        TEST_EQUAL(s, u8"H, ! «€10»");
+        s = u8"Hello, wörld! «€10»";    TRY(str_remove_in_if_not(s, GcSet("S,N")));   TEST_EQUAL(s, u8"€10");
+
     }
 
     void check_repeat() {
@@ -283,6 +294,49 @@ namespace {
         s = u8"(∀∃∇)(∀∃∇)(∀∃∇)";  TRY(str_replace_in(s, u8"∀∃∇", u8"xyz", 2));  TEST_EQUAL(s, u8"(xyz)(xyz)(∀∃∇)");
         s = u8"(∀∃∇)(∀∃∇)(∀∃∇)";  TRY(str_replace_in(s, u8"∀∃∇", u8"xyz", 3));  TEST_EQUAL(s, u8"(xyz)(xyz)(xyz)");
         s = u8"(∀∃∇)(∀∃∇)(∀∃∇)";  TRY(str_replace_in(s, u8"∀∃∇", u8"xyz", 4));  TEST_EQUAL(s, u8"(xyz)(xyz)(xyz)");
+        s = u8"(abc)(abc)(abc)";  TRY(str_replace_in(s, u8"bc", u8"x"));       TEST_EQUAL(s, u8"(ax)(ax)(ax)");
+        s = u8"(abc)(abc)(abc)";  TRY(str_replace_in(s, u8"bc", u8"x", 2));    TEST_EQUAL(s, u8"(ax)(ax)(abc)");
+        s = u8"abcabc";           TRY(str_replace_in(s, u8"abc", u8""));       TEST_EQUAL(s, u8"");
+
+        Replacer rep;
+
+        TEST(rep.empty());
+        TEST_EQUAL(str_replace_multi("(abc)"s, rep), "(abc)");
+
+        TRY((rep = {{"abc", "xyz"}, {"∀∃∇", "uvw"}}));
+        TEST(! rep.empty());
+        TEST_EQUAL(str_replace_multi(""s, rep), "");
+        TEST_EQUAL(str_replace_multi("(abc)(∀∃∇)(abc)"s, rep), "(xyz)(uvw)(xyz)");
+        TEST_EQUAL(str_replace_multi("(ab)(∀∃)(bc)"s, rep), "(ab)(∀∃)(bc)");
+
+        TRY((rep = {{"he", "1"}, {"she", "2"}, {"his", "3"}, {"hers", "4"}}));
+        TEST_EQUAL(str_replace_multi("ushers"s, rep), "u2rs");
+        TEST_EQUAL(str_replace_multi("hishers"s, rep), "34");
+        TEST_EQUAL(str_replace_multi("hehe she"s, rep), "11 2");
+
+        TRY((rep = {{"a", "1"}, {"ab", "2"}, {"abc", "3"}, {"bcd", "4"}}));
+        TEST_EQUAL(str_replace_multi("abcd"s, rep), "3d");
+        TEST_EQUAL(str_replace_multi("abd"s, rep), "2d");
+        TEST_EQUAL(str_replace_multi("xbcda"s, rep), "x41");
+        TRY(rep.insert("abcd", "5"));
+        TEST_EQUAL(str_replace_multi("abcd"s, rep), "5");
+        TRY(rep.insert("a", "6"));
+        TEST_EQUAL(str_replace_multi("xa"s, rep), "x6");
+
+        // Targets that use every byte value (not necessarily valid UTF-8)
+
+        U8string all_bytes;
+        for (int c = 0; c < 256; ++c)
+            all_bytes += char(c);
+        TRY((rep = {{all_bytes, "X"}, {"\xff\xfe", "Y"}}));
+        TEST_EQUAL(str_replace_multi("ab" + all_bytes + "cd", rep), "abXcd");
+        TEST_EQUAL(str_replace_multi(all_bytes.substr(0, 255), rep), all_bytes.substr(0, 255));
+        TEST_EQUAL(str_replace_multi("\xff\xfe\xfd\xff"s, rep), "Y\xfd\xff");
+
+        s = "Hello {name}, welcome to {place}!";
+        TEST_EQUAL(str_replace_multi(s, {{"{name}", "Alice"}, {"{place}", "Wonderland"}}), "Hello Alice, welcome to Wonderland!");
+        TRY(str_replace_multi_in(s, {{"{name}", "Bob"}, {"{place}", "Narnia"}, {"{", "("}, {"}", ")"}}));
+        TEST_EQUAL(s, "Hello Bob, welcome to Narnia!");
 
     }
 
@@ -36,6 +36,9 @@ namespace {
         TRY(str_split_by("*****"s, overwrite(v), "@*"s));                 TEST_EQUAL(v.size(), 0);  TEST_EQUAL(str_join(v, "/"), "");
         TRY(str_split_by("“”,“€uro”,“∈lement”"s, overwrite(v), "“”,"));   TEST_EQUAL(v.size(), 2);  TEST_EQUAL(str_join(v, "/"), "€uro/∈lement");
         TRY(str_split_by("“”,“€uro”,“∈lement”"s, overwrite(v), "“”,"s));  TEST_EQUAL(v.size(), 2);  TEST_EQUAL(str_join(v, "/"), "€uro/∈lement");
+        TRY(str_split_by("“”,“€uro”,“∈lement”"s, overwrite(v), CharSet("“”,")));              TEST_EQUAL(v.size(), 2);  TEST_EQUAL(str_join(v, "/"), "€uro/∈lement");
+        TRY(str_split_by("\t Hello \u3000 world \u2028"s, overwrite(v), CharSet(char_is_white_space)));  TEST_EQUAL(v.size(), 2);  TEST_EQUAL(str_join(v, "/"), "Hello/world");
+        TRY(v = str_splitv_by("“”,“€uro”,“∈lement”"s, CharSet("“”,")));                        TEST_EQUAL(v.size(), 2);  TEST_EQUAL(str_join(v, "/"), "€uro/∈lement");
 
         TRY(v = str_splitv(""s));                      TEST_EQUAL(v.size(), 0);  TEST_EQUAL(str_join(v, "/"), "");
         TRY(v = str_splitv("Hello"s));                 TEST_EQUAL(v.size(), 1);  TEST_EQUAL(str_join(v, "/"), "Hello");
@@ -104,6 +107,19 @@ namespace {
             u8"Line six//"
             u8"Line seven/");
 
+        Arena arena;
+        PmrStrings pv = arena.strings();
+
+        TRY(str_split("\t Hello \t world \t"s, string_inserter(pv)));    TEST_EQUAL(pv.size(), 2);  TEST_EQUAL(str_join(pv, "/"), "Hello/world");
+        TRY(str_split_at("<>Hello<>world<>"s, string_inserter(pv), "<>"));  TEST_EQUAL(pv.size(), 6);  TEST_EQUAL(str_join(pv, "/"), "Hello/world//Hello/world/");
+        TRY(str_split_by("**Hello**world**"s, string_inserter(pv), "*"));   TEST_EQUAL(pv.size(), 8);  TEST_EQUAL(str_join(pv, "/"), "Hello/world//Hello/world//Hello/world");
+        TRY(str_split_by(u8"«Hello»world"s, string_inserter(pv), u8"«»"));  TEST_EQUAL(pv.size(), 10); TEST_EQUAL(str_join(pv, "/"), "Hello/world//Hello/world//Hello/world/Hello/world");
+        TRY(str_split_lines("one\r\ntwo\n"s, string_inserter(pv)));        TEST_EQUAL(pv.size(), 12);
+        TEST_EQUAL(U8string(pv[10]), "one");
+        TEST_EQUAL(U8string(pv[11]), "two");
+        for (auto& s: pv)
+            TEST(s.get_allocator().resource() == arena.resource());
+
     }
 
     void check_squeeze() {
@@ -121,6 +137,11 @@ namespace {
         TEST_EQUAL(str_squeeze(u8"Hello world"s, u8"+-*/"s), u8"Hello world"s);
         TEST_EQUAL(str_squeeze(u8"/*-+Hello/*-+world/*-+"s, u8"+-*/"s), u8"+Hello+world+"s);
         TEST_EQUAL(str_squeeze(u8"∇∃∀€uro∇∃∀∈lement∇∃∀"s, u8"∀∃∇"s), u8"∀€uro∀∈lement∀"s);
+        TEST_EQUAL(str_squeeze(u8"/*-+Hello-+/*world+-*/"s, u8"+-*/"s), u8"+Hello+world+"s);
+        TEST_EQUAL(str_squeeze_runs(u8"/*-+Hello-+/*world+-*/"s, CharSet("+-*/")), u8"/Hello-world+"s);
+        TEST_EQUAL(str_squeeze_runs(u8"∇∃∀€uro∃∀∇∈lement∀∇∃"s, CharSet(u8"∀∃∇")), u8"∇€uro∃∈lement∀"s);
+        TEST_EQUAL(str_squeeze_runs(u8"12Hello345world6789"s, GcSet(GC::Nd)), u8"1Hello3world6"s);
+        TEST_EQUAL(str_squeeze_runs(u8"Hello\t\t\u2028world  \u00a0"s, GcSet("Z")), u8"Hello\t\t\u2028world "s);
 
         TEST_EQUAL(str_squeeze_trim(u8""s), u8""s);
         TEST_EQUAL(str_squeeze_trim(u8"\t\t\t"s), u8""s);
@@ -133,6 +154,9 @@ namespace {
         TEST_EQUAL(str_squeeze_trim(u8"Hello world"s, u8"+-*/"s), u8"Hello world"s);
         TEST_EQUAL(str_squeeze_trim(u8"/*-+Hello/*-+world/*-+"s, u8"+-*/"s), u8"Hello+world"s);
         TEST_EQUAL(str_squeeze_trim(u8"∇∃∀€uro∇∃∀∈lement∇∃∀"s, u8"∀∃∇"s), u8"€uro∀∈lement"s);
+        TEST_EQUAL(str_squeeze_runs_trim(u8"/*-+Hello-+/*world+-*/"s, CharSet("+-*/")), u8"Hello-world"s);
+        TEST_EQUAL(str_squeeze_runs_trim(u8"∇∃∀€uro∃∀∇∈lement∀∇∃"s, CharSet(u8"∀∃∇")), u8"€uro∃∈lement"s);
+        TEST_EQUAL(str_squeeze_runs_trim(u8"12Hello345world6789"s, GcSet(GC::Nd)), u8"Hello3world"s);
 
         s = u8""s;                                                 TRY(str_squeeze_in(s));             TEST_EQUAL(s, u8""s);
         s = u8"\t\t\t"s;                                           TRY(str_squeeze_in(s));             TEST_EQUAL(s, u8" "s);
@@ -157,6 +181,10 @@ namespace {
         s = u8"Hello world"s;                                      TRY(str_squeeze_trim_in(s, u8"+-*/"s));  TEST_EQUAL(s, u8"Hello world"s);
         s = u8"/*-+Hello/*-+world/*-+"s;                           TRY(str_squeeze_trim_in(s, u8"+-*/"s));  TEST_EQUAL(s, u8"Hello+world"s);
         s = u8"∇∃∀€uro∇∃∀∈lement∇∃∀"s;                             TRY(str_squeeze_trim_in(s, u8"∀∃∇"s));   TEST_EQUAL(s, u8"€uro∀∈lement"s);
+        s = u8"∇∃∀€uro∃∀∇∈lement∀∇∃"s;                             TRY(str_squeeze_runs_in(s, CharSet(u8"∀∃∇")));       TEST_EQUAL(s, u8"∇€uro∃∈lement∀"s);
+        s = u8"∇∃∀€uro∃∀∇∈lement∀∇∃"s;                             TRY(str_squeeze_runs_trim_in(s, CharSet(u8"∀∃∇")));  TEST_EQUAL(s, u8"€uro∃∈lement"s);
+        s = u8"12Hello345world6789"s;                              TRY(str_squeeze_runs_in(s, GcSet(GC::Nd)));      TEST_EQUAL(s, u8"1Hello3world6"s);
+        s = u8"12Hello345world6789"s;                              TRY(str_squeeze_runs_trim_in(s, GcSet(GC::Nd))); TEST_EQUAL(s, u8"Hello3world"s);
 
     }
 
@@ -267,6 +295,8 @@ namespace {
         TEST_EQUAL(str_translate("€uro ∈lement"s, "€∈", "∇√"), "∇uro √lement");
         TEST_EQUAL(str_translate("€uro ∈lement"s, "€∈", "*"), "*uro *lement");
         TEST_EQUAL(str_translate("€uro ∈lement"s, "e", "∇√"), "€uro ∈l∇m∇nt");
+        TEST_EQUAL(str_translate("Hello world"s, "lol", "01*"), "He001 w1r0d");
+        TEST_EQUAL(str_translate("€uro ∈lement"s, CharMap("€∈e", "∇√*")), "∇uro √l*m*nt");
 
         s = u8"";              TRY(str_translate_in(s, u8"", u8""));            TEST_EQUAL(s, u8"");
         s = u8"Hello world";   TRY(str_translate_in(s, u8"", u8""));            TEST_EQUAL(s, u8"Hello world");
@@ -277,6 +307,7 @@ namespace {
         s = u8"€uro ∈lement";  TRY(str_translate_in(s, u8"€∈", u8"∇√"));        TEST_EQUAL(s, u8"∇uro √lement");
         s = u8"€uro ∈lement";  TRY(str_translate_in(s, u8"€∈", u8"*"));         TEST_EQUAL(s, u8"*uro *lement");
         s = u8"€uro ∈lement";  TRY(str_translate_in(s, u8"e", u8"∇√"));         TEST_EQUAL(s, u8"€uro ∈l∇m∇nt");
+        s = u8"€uro ∈lement";  TRY(str_translate_in(s, CharMap("€∈e", "∇√*")));  TEST_EQUAL(s, u8"∇uro √l*m*nt");
 
     }
 
@@ -295,6 +326,9 @@ namespace {
         TEST_EQUAL(str_trim(u8"≤≤≤≥≥≥"s, u8"≤≥"), u8"");
         TEST_EQUAL(str_trim(u8"≤≤≤€uro≥≥≥"s, u8"≤≥"), u8"€uro");
         TEST_EQUAL(str_trim(u8"≤≤≤€uro≥≥≥ ≤≤≤∈lement≥≥≥"s, u8"≤≥"), u8"€uro≥≥≥ ≤≤≤∈lement");
+        TEST_EQUAL(str_trim(u8"≤≤≤€uro≥≥≥ ≤≤≤∈lement≥≥≥"s, CharSet(u8"≤≥")), u8"€uro≥≥≥ ≤≤≤∈lement");
+        TEST_EQUAL(str_trim(u8"\u3000 Hello world\u2028\n"s, CharSet(char_is_white_space)), u8"Hello world");
+        TEST_EQUAL(str_trim(u8"123€uro456"s, CharSet(GC::Nd)), u8"€uro");
 
         s = u8"";                          TRY(str_trim_in(s));          TEST_EQUAL(s, u8"");
         s = u8"Hello";                     TRY(str_trim_in(s));          TEST_EQUAL(s, u8"Hello");
@@ -307,6 +341,7 @@ namespace {
         s = u8"≤≤≤≥≥≥";                    TRY(str_trim_in(s, u8"≤≥"));  TEST_EQUAL(s, u8"");
         s = u8"≤≤≤€uro≥≥≥";                TRY(str_trim_in(s, u8"≤≥"));  TEST_EQUAL(s, u8"€uro");
         s = u8"≤≤≤€uro≥≥≥ ≤≤≤∈lement≥≥≥";  TRY(str_trim_in(s, u8"≤≥"));  TEST_EQUAL(s, u8"€uro≥≥≥ ≤≤≤∈lement");
+        s = u8"≤≤≤€uro≥≥≥ ≤≤≤∈lement≥≥≥";  TRY(str_trim_in(s, CharSet(u8"≤≥")));  TEST_EQUAL(s, u8"€uro≥≥≥ ≤≤≤∈lement");
 
         TEST_EQUAL(str_trim_left(u8""s), u8"");
         TEST_EQUAL(str_trim_left(u8"Hello"s), u8"Hello");
@@ -319,6 +354,7 @@ namespace {
         TEST_EQUAL(str_trim_left(u8"≤≤≤≥≥≥"s, u8"≤≥"), u8"");
         TEST_EQUAL(str_trim_left(u8"≤≤≤€uro≥≥≥"s, u8"≤≥"), u8"€uro≥≥≥");
         TEST_EQUAL(str_trim_left(u8"≤≤≤€uro≥≥≥ ≤≤≤∈lement≥≥≥"s, u8"≤≥"), u8"€uro≥≥≥ ≤≤≤∈lement≥≥≥");
+        TEST_EQUAL(str_trim_left(u8"≤≤≤€uro≥≥≥ ≤≤≤∈lement≥≥≥"s, CharSet(u8"≤≥")), u8"€uro≥≥≥ ≤≤≤∈lement≥≥≥");
 
         s = u8"";                          TRY(str_trim_left_in(s));          TEST_EQUAL(s, u8"");
         s = u8"Hello";                     TRY(str_trim_left_in(s));          TEST_EQUAL(s, u8"Hello");
@@ -331,6 +367,7 @@ namespace {
         s = u8"≤≤≤≥≥≥";                    TRY(str_trim_left_in(s, u8"≤≥"));  TEST_EQUAL(s, u8"");
         s = u8"≤≤≤€uro≥≥≥";                TRY(str_trim_left_in(s, u8"≤≥"));  TEST_EQUAL(s, u8"€uro≥≥≥");
         s = u8"≤≤≤€uro≥≥≥ ≤≤≤∈lement≥≥≥";  TRY(str_trim_left_in(s, u8"≤≥"));  TEST_EQUAL(s, u8"€uro≥≥≥ ≤≤≤∈lement≥≥≥");
+        s = u8"≤≤≤€uro≥≥≥ ≤≤≤∈lement≥≥≥";  TRY(str_trim_left_in(s, CharSet(u8"≤≥")));  TEST_EQUAL(s, u8"€uro≥≥≥ ≤≤≤∈lement≥≥≥");
 
         TEST_EQUAL(str_trim_right(u8""s), u8"");
         TEST_EQUAL(str_trim_right(u8"Hello"s), u8"Hello");
@@ -343,6 +380,7 @@ namespace {
         TEST_EQUAL(str_trim_right(u8"≤≤≤≥≥≥"s, u8"≤≥"), u8"");
         TEST_EQUAL(str_trim_right(u8"≤≤≤€uro≥≥≥"s, u8"≤≥"), u8"≤≤≤€uro");
         TEST_EQUAL(str_trim_right(u8"≤≤≤€uro≥≥≥ ≤≤≤∈lement≥≥≥"s, u8"≤≥"), u8"≤≤≤€uro≥≥≥ ≤≤≤∈lement");
+        TEST_EQUAL(str_trim_right(u8"≤≤≤€uro≥≥≥ ≤≤≤∈lement≥≥≥"s, CharSet(u8"≤≥")), u8"≤≤≤€uro≥≥≥ ≤≤≤∈lement");
 
         s = u8"";                          TRY(str_trim_right_in(s));          TEST_EQUAL(s, u8"");
         s = u8"Hello";                     TRY(str_trim_right_in(s));          TEST_EQUAL(s, u8"Hello");
@@ -355,6 +393,7 @@ namespace {
         s = u8"≤≤≤≥≥≥";                    TRY(str_trim_right_in(s, u8"≤≥"));  TEST_EQUAL(s, u8"");
         s = u8"≤≤≤€uro≥≥≥";                TRY(str_trim_right_in(s, u8"≤≥"));  TEST_EQUAL(s, u8"≤≤≤€uro");
         s = u8"≤≤≤€uro≥≥≥ ≤≤≤∈lement≥≥≥";  TRY(str_trim_right_in(s, u8"≤≥"));  TEST_EQUAL(s, u8"≤≤≤€uro≥≥≥ ≤≤≤∈lement");
+        s = u8"≤≤≤€uro≥≥≥ ≤≤≤∈lement≥≥≥";  TRY(str_trim_right_in(s, CharSet(u8"≤≥")));  TEST_EQUAL(s, u8"≤≤≤€uro≥≥≥ ≤≤≤∈lement");
 
     }
 
@@ -400,6 +439,22 @@ namespace {
         s = u8"Hello\r\nworld";       TRY(str_trim_right_in_if_not(s, char_is_line_break));  TEST_EQUAL(s, u8"Hello\r\n");
         s = u8"\r\nHello world\r\n";  TRY(str_trim_right_in_if_not(s, char_is_line_break));  TEST_EQUAL(s, u8"\r\nHello world\r\n");
 
+        TEST_EQUAL(str_trim_if(u8""s, GcSet("P,Z")), u8"");
+        TEST_EQUAL(str_trim_if(u8"\u00a0«Hello, world!»\u3000"s, GcSet("P,Z")), u8"Hello, world");
+        TEST_EQUAL(str_trim_left_if(u8"\u00a0«Hello, world!»\u3000"s, GcSet("P,Z")), u8"Hello, world!»\u3000");
+        TEST_EQUAL(str_trim_right_if(u8"\u00a0«Hello, world!»\u3000"s, GcSet("P,Z")), u8"\u00a0«Hello, world");
+        TEST_EQUAL(str_trim_if_not(u8"1. Première étape 2"s, GcSet("L")), u8"Première étape");
+        TEST_EQUAL(str_trim_left_if_not(u8"1. Première étape 2"s, GcSet("L")), u8"Première étape 2");
+        TEST_EQUAL(str_trim_right_if_not(u8"1. Première étape 2"s, GcSet("L")), u8"1. Première étape");
+        TEST_EQUAL(str_trim_if(u8"«»"s, GcSet("P")), u8"");
+
+        s = u8"\u00a0«Hello, world!»\u3000";  TRY(str_trim_in_if(s, GcSet("P,Z")));            TEST_EQUAL(s, u8"Hello, world");
+        s = u8"\u00a0«Hello, world!»\u3000";  TRY(str_trim_left_in_if(s, GcSet("P,Z")));       TEST_EQUAL(s, u8"Hello, world!»\u3000");
+        s = u8"\u00a0«Hello, world!»\u3000";  TRY(str_trim_right_in_if(s, GcSet("P,Z")));      TEST_EQUAL(s, u8"\u00a0«Hello, world");
+        s = u8"1. Première étape 2";           TRY(str_trim_in_if_not(s, GcSet("L")));          TEST_EQUAL(s, u8"Première étape");
+        s = u8"1. Première étape 2";           TRY(str_trim_left_in_if_not(s, GcSet("L")));     TEST_EQUAL(s, u8"Première étape 2");
+        s = u8"1. Première étape 2";           TRY(str_trim_right_in_if_not(s, GcSet("L")));    TEST_EQUAL(s, u8"1. Première étape");
+
     }
 
     void check_unify() {
@@ -556,6 +611,52 @@ namespace {
         TRY(str_wrap_in(s, Wrap::preserve, Wrap::width=40));
         TEST_EQUAL(s, t);
 
+        s = "The quick-brown fox jumps over the well-known lazy dog.";
+        t =
+            //...:....1....:....2....:....3....:....4....:....5
+            "The quick-brown fox\n"
+            "jumps over the well-\n"
+            "known lazy dog.\n";
+        TEST_EQUAL(str_wrap(s, Wrap::width=20), t);
+
+        s = u8"\u65e5\u672c\u8a9e\u306e\u30c6\u30ad\u30b9\u30c8\u306f\u5358\u8a9e\u306e\u9593\u306b\u7a7a\u767d\u3092\u5165\u308c\u305a\u306b\u66f8\u304b\u308c\u307e\u3059\u3002";
+        t =
+            u8"\u65e5\u672c\u8a9e\u306e\u30c6\u30ad\u30b9\u30c8\u306f\u5358\n"
+            u8"\u8a9e\u306e\u9593\u306b\u7a7a\u767d\u3092\u5165\u308c\u305a\n"
+            u8"\u306b\u66f8\u304b\u308c\u307e\u3059\u3002\n";
+        TEST_EQUAL(str_wrap(s, Wrap::width=20, Wrap::flags=Length::wide), t);
+
+        s = u8"Pay $1\u00a0000 to Mr.\u00a0Smith today";
+        t =
+            u8"Pay $1\u00a0000\n"
+            u8"to\n"
+            u8"Mr.\u00a0Smith\n"
+            u8"today\n";
+        TEST_EQUAL(str_wrap(s, Wrap::width=10), t);
+
+        s = "aaa bb cc ddddd";
+        TEST_EQUAL(str_wrap(s, Wrap::width=6), "aaa bb\ncc\nddddd\n");
+        TEST_EQUAL(str_wrap(s, Wrap::width=6, Wrap::optimal), "aaa\nbb cc\nddddd\n");
+        TRY(str_wrap_in(s, Wrap::width=6, Wrap::optimal));
+        TEST_EQUAL(s, "aaa\nbb cc\nddddd\n");
+
+        s = "a verylongword b";
+        TEST_EQUAL(str_wrap(s, Wrap::width=10, Wrap::optimal), "a\nverylongword\nb\n");
+        TEST_THROW(str_wrap(s, Wrap::width=10, Wrap::optimal, Wrap::enforce), std::length_error);
+
+        s =
+            "Lorem ipsum dolor sit amet, consectetur adipisicing elit, "
+            "sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.";
+        t =
+            //...:....1....:....2....:....3....:....4....:....5
+            "    Lorem ipsum dolor\n"
+            "  sit amet, consectetur\n"
+            "  adipisicing elit, sed do\n"
+            "  eiusmod tempor incididunt\n"
+            "  ut labore et dolore magna\n"
+            "  aliqua.\n";
+        TEST_EQUAL(str_wrap(s, Wrap::width=30, Wrap::optimal, Wrap::margin=4, Wrap::margin2=2), t);
+
     }
 
 }
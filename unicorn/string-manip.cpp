@@ -1,5 +1,6 @@
 #include "unicorn/string.hpp"
 #include <algorithm>
+#include <cstring>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -9,14 +10,6 @@ namespace RS::Unicorn {
 
     namespace {
 
-        class CharIn {
-        public:
-            CharIn(const std::u32string& chars) noexcept: x(&chars) {}
-            bool operator()(char32_t c) const noexcept { return x->find(c) != npos; }
-        private:
-            const std::u32string* x;
-        };
-
         void insert_padding(U8string& str, size_t old_length, size_t new_length, char32_t c, uint32_t flags, char side) {
             size_t pad_chars = new_length - old_length;
             if (flags & UnicornDetail::east_asian_flags) {
@@ -54,12 +47,7 @@ namespace RS::Unicorn {
             }
         }
 
-        void squeeze_helper(const U8string& src, U8string& dst, bool trim, const U8string& chars) {
-            if (chars.empty()) {
-                dst = src;
-                return;
-            }
-            auto sub = str_first_char(chars);
+        void squeeze_helper(const U8string& src, U8string& dst, bool trim, const CharSet& chars, char32_t sub) {
             auto i = utf_begin(src), end = utf_end(src);
             if (trim)
                 i = str_find_first_not_of(i, end, chars);
@@ -74,6 +62,165 @@ namespace RS::Unicorn {
             }
         }
 
+        // Each run is replaced with its own first character. The standard
+        // algorithms take the predicate by value, so it is wrapped to avoid
+        // copying a CharSet's range list for every run.
+
+        template <typename Pred>
+        void squeeze_runs_helper(const U8string& src, U8string& dst, bool trim, const Pred& pred) {
+            auto p = [&pred] (char32_t c) { return pred(c); };
+            auto i = utf_begin(src), end = utf_end(src);
+            if (trim)
+                i = std::find_if_not(i, end, p);
+            while (i != end) {
+                auto j = std::find_if(i, end, p);
+                str_append(dst, i, j);
+                if (j == end)
+                    break;
+                i = std::find_if_not(j, end, p);
+                if (! trim || i != end)
+                    str_append(dst, j, std::next(j));
+            }
+        }
+
+        void squeeze_helper(const U8string& src, U8string& dst, bool trim, const U8string& chars) {
+            if (chars.empty())
+                dst = src;
+            else
+                squeeze_helper(src, dst, trim, CharSet(chars), str_first_char(chars));
+        }
+
+        void remove_helper(const U8string& src, U8string& dst, const CharSet& chars) {
+            dst.reserve(src.size());
+            auto i = utf_begin(src), end = utf_end(src);
+            while (i != end) {
+                auto j = str_find_first_of(i, end, chars);
+                str_append(dst, i, j);
+                if (j == end)
+                    break;
+                i = str_find_first_not_of(j, end, chars);
+            }
+        }
+
+        void trim_offsets(const U8string& src, const CharSet& chars, int mode, size_t& first, size_t& last) {
+            auto i = utf_begin(src), j = utf_end(src);
+            if (mode & UnicornDetail::trimleft)
+                i = str_find_first_not_of(i, j, chars);
+            if ((mode & UnicornDetail::trimright) && i != j) {
+                auto k = str_find_last_not_of(i, j, chars);
+                j = k == j ? i : std::next(k);
+            }
+            first = i.offset();
+            last = j.offset();
+        }
+
+        U8string trim_set(const U8string& src, const CharSet& chars, int mode) {
+            size_t i = 0, j = 0;
+            trim_offsets(src, chars, mode, i, j);
+            return src.substr(i, j - i);
+        }
+
+        void trim_set_in(U8string& src, const CharSet& chars, int mode) {
+            size_t i = 0, j = 0;
+            trim_offsets(src, chars, mode, i, j);
+            src.erase(j, npos);
+            src.erase(0, i);
+        }
+
+        // A GcSet with its ASCII members precomputed as a bitmap, so that
+        // ASCII text can be tested a byte at a time without decoding
+
+        class GcMatcher {
+        public:
+            explicit GcMatcher(GcSet set) noexcept: gcs(set) {
+                for (char32_t c = 0; c < 0x80; ++c)
+                    if (set(c))
+                        ascii[c >> 6] |= uint64_t(1) << (c & 63);
+            }
+            bool ascii_contains(uint8_t c) const noexcept { return (ascii[c >> 6] >> (c & 63)) & 1; }
+            bool operator()(char32_t c) const noexcept { return gcs(c); }
+        private:
+            GcSet gcs;
+            uint64_t ascii[2] = {0, 0};
+        };
+
+        // Copy the characters not in the set; kept runs are copied in one
+        // block, as in remove_helper()
+
+        void remove_gc_helper(const U8string& src, U8string& dst, GcSet set) {
+            GcMatcher m(set);
+            size_t i = 0, n = src.size(), keep = 0;
+            dst.reserve(src.size());
+            while (i < n) {
+                auto c = uint8_t(src[i]);
+                size_t k = 1;
+                bool drop;
+                if (c < 0x80) {
+                    drop = m.ascii_contains(c);
+                } else {
+                    auto it = utf_iterator(src, i);
+                    k = std::max(it.count(), size_t(1));
+                    drop = m(*it);
+                }
+                if (drop) {
+                    dst.append(src, keep, i - keep);
+                    keep = i + k;
+                }
+                i += k;
+            }
+            dst.append(src, keep, n - keep);
+        }
+
+        void trim_gc_offsets(const U8string& src, GcSet set, int mode, size_t& first, size_t& last) {
+            GcMatcher m(set);
+            size_t i = 0, j = src.size();
+            if (mode & UnicornDetail::trimleft) {
+                while (i < j) {
+                    auto c = uint8_t(src[i]);
+                    if (c < 0x80) {
+                        if (! m.ascii_contains(c))
+                            break;
+                        ++i;
+                    } else {
+                        auto it = utf_iterator(src, i);
+                        if (! m(*it))
+                            break;
+                        i += std::max(it.count(), size_t(1));
+                    }
+                }
+            }
+            if (mode & UnicornDetail::trimright) {
+                while (j > i) {
+                    auto c = uint8_t(src[j - 1]);
+                    if (c < 0x80) {
+                        if (! m.ascii_contains(c))
+                            break;
+                        --j;
+                    } else {
+                        auto it = std::prev(utf_iterator(src, j));
+                        if (! m(*it))
+                            break;
+                        j = it.offset();
+                    }
+                }
+            }
+            first = i;
+            last = j;
+        }
+
+        U8string trim_gc(const U8string& src, GcSet set, int mode) {
+            size_t i = 0, j = 0;
+            trim_gc_offsets(src, set, mode, i, j);
+            return src.substr(i, j - i);
+        }
+
+        void trim_gc_in(U8string& src, GcSet set, int mode) {
+            size_t i = 0, j = 0;
+            trim_gc_offsets(src, set, mode, i, j);
+            src.erase(j, npos);
+            src.erase(0, i);
+        }
+
     }
 
     namespace UnicornDetail {
@@ -457,22 +604,11 @@ namespace RS::Unicorn {
             suffix.clear();
             return false;
         }
-        auto u_delim = to_utf32(delim);
-        size_t i = 0, j = 0;
-        if (delim.size() == u_delim.size()) {
-            i = str.find_first_of(delim);
-            if (i != npos)
-                j = str.find_first_not_of(delim, i);
-        } else {
-            auto match = [&] (char32_t c) { return u_delim.find(c) != npos; };
-            auto range = utf_range(str);
-            auto p = std::find_if(range.begin(), range.end(), match);
-            i = p.offset();
-            if (p != range.end()) {
-                auto q = std::find_if_not(p, range.end(), match);
-                j = q.offset();
-            }
-        }
+        if (! std::all_of(delim.begin(), delim.end(), [] (char c) { return uint8_t(c) < 0x80; }))
+            return str_partition_by(str, prefix, suffix, CharSet(delim));
+        size_t i = str.find_first_of(delim), j = 0;
+        if (i != npos)
+            j = str.find_first_not_of(delim, i);
         if (i == npos) {
             prefix = str;
             suffix.clear();
@@ -487,6 +623,21 @@ namespace RS::Unicorn {
         return i != npos;
     }
 
+    bool str_partition_by(const U8string& str, U8string& prefix, U8string& suffix, const CharSet& delim) {
+        auto b = utf_begin(str), e = utf_end(str);
+        auto i = str_find_first_of(b, e, delim);
+        if (i == e) {
+            prefix = str;
+            suffix.clear();
+            return false;
+        }
+        auto j = str_find_first_not_of(i, e, delim);
+        auto temp = str.substr(0, i.offset());
+        suffix = str.substr(j.offset(), npos);
+        prefix.swap(temp);
+        return true;
+    }
+
     U8string str_remove(const U8string& str, char32_t c) {
         U8string dst;
         std::copy_if(utf_begin(str), utf_end(str), utf_writer(dst), [c] (char32_t x) { return x != c; });
@@ -494,8 +645,12 @@ namespace RS::Unicorn {
     }
 
     U8string str_remove(const U8string& str, const U8string& chars) {
+        return str_remove(str, CharSet(chars));
+    }
+
+    U8string str_remove(const U8string& str, const CharSet& chars) {
         U8string dst;
-        std::copy_if(utf_begin(str), utf_end(str), utf_writer(dst), [&chars] (char32_t x) { return chars.find(x) == npos; });
+        remove_helper(str, dst, chars);
         return dst;
     }
 
@@ -506,11 +661,35 @@ namespace RS::Unicorn {
     }
 
     void str_remove_in(U8string& str, const U8string& chars) {
+        str_remove_in(str, CharSet(chars));
+    }
+
+    void str_remove_in(U8string& str, const CharSet& chars) {
+        U8string dst;
+        remove_helper(str, dst, chars);
+        str.swap(dst);
+    }
+
+    U8string str_remove_if(const U8string& str, GcSet cats) {
+        U8string dst;
+        remove_gc_helper(str, dst, cats);
+        return dst;
+    }
+
+    U8string str_remove_if_not(const U8string& str, GcSet cats) {
+        return str_remove_if(str, ~ cats);
+    }
+
+    void str_remove_in_if(U8string& str, GcSet cats) {
         U8string dst;
-        std::copy_if(utf_begin(str), utf_end(str), utf_writer(dst), [&chars] (char32_t x) { return chars.find(x) == npos; });
+        remove_gc_helper(str, dst, cats);
         str.swap(dst);
     }
 
+    void str_remove_in_if_not(U8string& str, GcSet cats) {
+        str_remove_in_if(str, ~ cats);
+    }
+
     U8string str_repeat(const U8string& str, size_t n) {
         if (n == 0 || str.empty())
             return {};
@@ -554,7 +733,39 @@ namespace RS::Unicorn {
     }
 
     void str_replace_in(U8string& str, const U8string& target, const U8string& sub, size_t n) {
-        auto result = str_replace(str, target, sub, n);
+        if (target.empty() || n == 0)
+            return;
+        if (sub.size() > target.size()) {
+            auto result = str_replace(str, target, sub, n);
+            str.swap(result);
+            return;
+        }
+        // The replacement is no longer than the target, so the output never
+        // overtakes the input and the string can be compacted in place
+        size_t i = 0, j = 0, size = str.size(), tsize = target.size();
+        for (size_t k = 0; k < n; ++k) {
+            auto m = str.find(target, i);
+            if (m == npos)
+                break;
+            if (i != j)
+                std::memmove(&str[j], &str[i], m - i);
+            j += m - i;
+            std::memcpy(&str[j], sub.data(), sub.size());
+            j += sub.size();
+            i = m + tsize;
+        }
+        if (i != j) {
+            std::memmove(&str[j], &str[i], size - i);
+            str.resize(j + size - i);
+        }
+    }
+
+    U8string str_replace_multi(const U8string& str, const Replacer& rep) {
+        return rep(str);
+    }
+
+    void str_replace_multi_in(U8string& str, const Replacer& rep) {
+        auto result = rep(str);
         str.swap(result);
     }
 
@@ -576,6 +787,12 @@ namespace RS::Unicorn {
         return v;
     }
 
+    Strings str_splitv_by(const U8string& src, const CharSet& delim) {
+        Strings v;
+        str_split_by(src, append(v), delim);
+        return v;
+    }
+
     U8string str_squeeze(const U8string& str) {
         U8string dst;
         squeeze_helper(str, dst, false);
@@ -624,6 +841,54 @@ namespace RS::Unicorn {
         str.swap(dst);
     }
 
+    U8string str_squeeze_runs(const U8string& str, const CharSet& chars) {
+        U8string dst;
+        squeeze_runs_helper(str, dst, false, chars);
+        return dst;
+    }
+
+    U8string str_squeeze_runs(const U8string& str, GcSet cats) {
+        U8string dst;
+        squeeze_runs_helper(str, dst, false, cats);
+        return dst;
+    }
+
+    U8string str_squeeze_runs_trim(const U8string& str, const CharSet& chars) {
+        U8string dst;
+        squeeze_runs_helper(str, dst, true, chars);
+        return dst;
+    }
+
+    U8string str_squeeze_runs_trim(const U8string& str, GcSet cats) {
+        U8string dst;
+        squeeze_runs_helper(str, dst, true, cats);
+        return dst;
+    }
+
+    void str_squeeze_runs_in(U8string& str, const CharSet& chars) {
+        U8string dst;
+        squeeze_runs_helper(str, dst, false, chars);
+        str.swap(dst);
+    }
+
+    void str_squeeze_runs_in(U8string& str, GcSet cats) {
+        U8string dst;
+        squeeze_runs_helper(str, dst, false, cats);
+        str.swap(dst);
+    }
+
+    void str_squeeze_runs_trim_in(U8string& str, const CharSet& chars) {
+        U8string dst;
+        squeeze_runs_helper(str, dst, true, chars);
+        str.swap(dst);
+    }
+
+    void str_squeeze_runs_trim_in(U8string& str, GcSet cats) {
+        U8string dst;
+        squeeze_runs_helper(str, dst, true, cats);
+        str.swap(dst);
+    }
+
     U8string str_substring(const U8string& str, size_t offset, size_t count) {
         if (offset < str.size())
             return str.substr(offset, count);
@@ -642,16 +907,18 @@ namespace RS::Unicorn {
     U8string str_translate(const U8string& str, const U8string& target, const U8string& sub) {
         if (target.empty() || sub.empty())
             return str;
-        auto t = to_utf32(target), s = to_utf32(sub);
-        if (s.size() < t.size())
-            s.resize(t.size(), s.back());
+        return str_translate(str, CharMap(target, sub));
+    }
+
+    U8string str_translate(const U8string& str, const CharMap& map) {
         U8string dst;
         dst.reserve(str.size());
         for (auto c: utf_range(str)) {
-            size_t pos = t.find(c);
-            if (pos != npos)
-                c = s[pos];
-            str_append_char(dst, c);
+            c = map(c);
+            if (c < 0x80)
+                dst += char(c);
+            else
+                str_append_char(dst, c);
         }
         return dst;
     }
@@ -661,8 +928,17 @@ namespace RS::Unicorn {
         str.swap(result);
     }
 
+    void str_translate_in(U8string& str, const CharMap& map) {
+        auto result = str_translate(str, map);
+        str.swap(result);
+    }
+
     U8string str_trim(const U8string& str, const U8string& chars) {
-        return str_trim_if(str, CharIn(to_utf32(chars)));
+        return trim_set(str, CharSet(chars), UnicornDetail::trimleft | UnicornDetail::trimright);
+    }
+
+    U8string str_trim(const U8string& str, const CharSet& chars) {
+        return trim_set(str, chars, UnicornDetail::trimleft | UnicornDetail::trimright);
     }
 
     U8string str_trim(const U8string& str) {
@@ -670,7 +946,11 @@ namespace RS::Unicorn {
     }
 
     U8string str_trim_left(const U8string& str, const U8string& chars) {
-        return str_trim_left_if(str, CharIn(to_utf32(chars)));
+        return trim_set(str, CharSet(chars), UnicornDetail::trimleft);
+    }
+
+    U8string str_trim_left(const U8string& str, const CharSet& chars) {
+        return trim_set(str, chars, UnicornDetail::trimleft);
     }
 
     U8string str_trim_left(const U8string& str) {
@@ -678,7 +958,11 @@ namespace RS::Unicorn {
     }
 
     U8string str_trim_right(const U8string& str, const U8string& chars) {
-        return str_trim_right_if(str, CharIn(to_utf32(chars)));
+        return trim_set(str, CharSet(chars), UnicornDetail::trimright);
+    }
+
+    U8string str_trim_right(const U8string& str, const CharSet& chars) {
+        return trim_set(str, chars, UnicornDetail::trimright);
     }
 
     U8string str_trim_right(const U8string& str) {
@@ -686,7 +970,11 @@ namespace RS::Unicorn {
     }
 
     void str_trim_in(U8string& str, const U8string& chars) {
-        str_trim_in_if(str, CharIn(to_utf32(chars)));
+        trim_set_in(str, CharSet(chars), UnicornDetail::trimleft | UnicornDetail::trimright);
+    }
+
+    void str_trim_in(U8string& str, const CharSet& chars) {
+        trim_set_in(str, chars, UnicornDetail::trimleft | UnicornDetail::trimright);
     }
 
     void str_trim_in(U8string& str) {
@@ -694,7 +982,11 @@ namespace RS::Unicorn {
     }
 
     void str_trim_left_in(U8string& str, const U8string& chars) {
-        str_trim_left_in_if(str, CharIn(to_utf32(chars)));
+        trim_set_in(str, CharSet(chars), UnicornDetail::trimleft);
+    }
+
+    void str_trim_left_in(U8string& str, const CharSet& chars) {
+        trim_set_in(str, chars, UnicornDetail::trimleft);
     }
 
     void str_trim_left_in(U8string& str) {
@@ -702,13 +994,65 @@ namespace RS::Unicorn {
     }
 
     void str_trim_right_in(U8string& str, const U8string& chars) {
-        str_trim_right_in_if(str, CharIn(to_utf32(chars)));
+        trim_set_in(str, CharSet(chars), UnicornDetail::trimright);
+    }
+
+    void str_trim_right_in(U8string& str, const CharSet& chars) {
+        trim_set_in(str, chars, UnicornDetail::trimright);
     }
 
     void str_trim_right_in(U8string& str) {
         str_trim_right_in_if(str, char_is_white_space);
     }
 
+    U8string str_trim_if(const U8string& str, GcSet cats) {
+        return trim_gc(str, cats, UnicornDetail::trimleft | UnicornDetail::trimright);
+    }
+
+    U8string str_trim_left_if(const U8string& str, GcSet cats) {
+        return trim_gc(str, cats, UnicornDetail::trimleft);
+    }
+
+    U8string str_trim_right_if(const U8string& str, GcSet cats) {
+        return trim_gc(str, cats, UnicornDetail::trimright);
+    }
+
+    U8string str_trim_if_not(const U8string& str, GcSet cats) {
+        return trim_gc(str, ~ cats, UnicornDetail::trimleft | UnicornDetail::trimright);
+    }
+
+    U8string str_trim_left_if_not(const U8string& str, GcSet cats) {
+        return trim_gc(str, ~ cats, UnicornDetail::trimleft);
+    }
+
+    U8string str_trim_right_if_not(const U8string& str, GcSet cats) {
+        return trim_gc(str, ~ cats, UnicornDetail::trimright);
+    }
+
+    void str_trim_in_if(U8string& str, GcSet cats) {
+        trim_gc_in(str, cats, UnicornDetail::trimleft | UnicornDetail::trimright);
+    }
+
+    void str_trim_left_in_if(U8string& str, GcSet cats) {
+        trim_gc_in(str, cats, UnicornDetail::trimleft);
+    }
+
+    void str_trim_right_in_if(U8string& str, GcSet cats) {
+        trim_gc_in(str, cats, UnicornDetail::trimright);
+    }
+
+    void str_trim_in_if_not(U8string& str, GcSet cats) {
+        trim_gc_in(str, ~ cats, UnicornDetail::trimleft | UnicornDetail::trimright);
+    }
+
+    void str_trim_left_in_if_not(U8string& str, GcSet cats) {
+        trim_gc_in(str, ~ cats, UnicornDetail::trimleft);
+    }
+
+    void str_trim_right_in_if_not(U8string& str, GcSet cats) {
+        trim_gc_in(str, ~ cats, UnicornDetail::trimright);
+    }
+
     U8string str_unify_lines(const U8string& str, const U8string& newline) {
         auto i = utf_begin(str), e = utf_end(str);
         U8string result;
@@ -755,7 +1099,124 @@ namespace RS::Unicorn {
         str_unify_lines_in(str, "\n");
     }
 
+    Replacer::Replacer(std::initializer_list<std::pair<U8string, U8string>> list) {
+        for (auto& ts: list) {
+            if (ts.first.empty())
+                continue;
+            auto it = std::find(targets.begin(), targets.end(), ts.first);
+            if (it == targets.end()) {
+                targets.push_back(ts.first);
+                subs.push_back(ts.second);
+            } else {
+                subs[it - targets.begin()] = ts.second;
+            }
+        }
+        build();
+    }
+
+    U8string Replacer::operator()(const U8string& str) const {
+        if (targets.empty())
+            return str;
+        U8string dst;
+        dst.reserve(str.size());
+        size_t pos = 0, i = 0, size = str.size();
+        size_t best = 0, best_start = npos, best_end = 0;
+        uint32_t state = 0;
+        for (;;) {
+            if (i < size) {
+                state = delta[state * nclasses + classes[uint8_t(str[i++])]];
+                if (match[state]) {
+                    size_t start = i - targets[match[state] - 1].size();
+                    if (start <= best_start) {
+                        best = match[state] - 1;
+                        best_start = start;
+                        best_end = i;
+                    }
+                }
+                // A longer match starting at the same place is still possible
+                if (best_start == npos || best_start >= i - depth[state])
+                    continue;
+            } else if (best_start == npos) {
+                break;
+            }
+            dst.append(str, pos, best_start - pos);
+            dst += subs[best];
+            pos = i = best_end;
+            best_start = npos;
+            state = 0;
+        }
+        dst.append(str, pos, npos);
+        return dst;
+    }
+
+    void Replacer::insert(const U8string& target, const U8string& sub) {
+        if (target.empty())
+            return;
+        auto it = std::find(targets.begin(), targets.end(), target);
+        if (it == targets.end()) {
+            targets.push_back(target);
+            subs.push_back(sub);
+            build();
+        } else {
+            subs[it - targets.begin()] = sub;
+        }
+    }
+
+    void Replacer::build() {
+        // Build a trie of the targets, then fill in the missing transitions
+        // from the failure links in breadth first order, giving a complete
+        // Aho-Corasick automaton
+        static constexpr uint32_t none = ~ uint32_t(0);
+        std::fill_n(classes, 256, 0);
+        nclasses = 1;
+        for (auto& t: targets)
+            for (char c: t)
+                if (classes[uint8_t(c)] == 0)
+                    classes[uint8_t(c)] = uint16_t(nclasses++);
+        delta.assign(nclasses, none);
+        depth.assign(1, 0);
+        match.assign(1, 0);
+        for (size_t k = 0; k < targets.size(); ++k) {
+            uint32_t state = 0;
+            for (char c: targets[k]) {
+                auto& next = delta[state * nclasses + classes[uint8_t(c)]];
+                if (next == none) {
+                    next = uint32_t(depth.size());
+                    delta.resize(delta.size() + nclasses, none);
+                    depth.push_back(depth[state] + 1);
+                    match.push_back(0);
+                }
+                state = delta[state * nclasses + classes[uint8_t(c)]];
+            }
+            match[state] = uint32_t(k + 1);
+        }
+        std::vector<uint32_t> fail(depth.size(), 0), queue;
+        for (size_t c = 0; c < nclasses; ++c) {
+            auto& next = delta[c];
+            if (next == none)
+                next = 0;
+            else
+                queue.push_back(next);
+        }
+        for (size_t q = 0; q < queue.size(); ++q) {
+            uint32_t state = queue[q];
+            if (match[state] == 0)
+                match[state] = match[fail[state]];
+            for (size_t c = 0; c < nclasses; ++c) {
+                auto& next = delta[state * nclasses + c];
+                uint32_t alt = delta[fail[state] * nclasses + c];
+                if (next == none) {
+                    next = alt;
+                } else {
+                    fail[next] = alt;
+                    queue.push_back(next);
+                }
+            }
+        }
+    }
+
     constexpr Kwarg<bool> Wrap::enforce;
+    constexpr Kwarg<bool> Wrap::optimal;
     constexpr Kwarg<bool> Wrap::preserve;
     constexpr Kwarg<uint32_t> Wrap::flags;
     constexpr Kwarg<size_t> Wrap::margin;
@@ -765,7 +1226,130 @@ namespace RS::Unicorn {
 
     namespace UnicornDetail {
 
-        void str_wrap_helper(const U8string& src, U8string& dst, bool enforce, bool preserve, uint32_t flags, size_t margin, size_t margin2, size_t width, const U8string& newline) {
+        namespace {
+
+            // A word wrapping item is a run of text between two line break
+            // opportunities, with its surrounding white space removed; a
+            // joined item follows the previous one with no white space in
+            // between (e.g. after a hyphen or between ideographs).
+
+            struct WrapItem {
+                size_t offset;
+                size_t size;
+                size_t width;
+                bool joined;
+            };
+
+            class WrapLayout {
+            public:
+                WrapLayout(const U8string& src, U8string& dst, bool enforce, bool optimal, size_t spacing, size_t margin2, size_t width, const U8string& newline):
+                    src(src), dst(dst), enforce(enforce), optimal(optimal), spacing(spacing), margin2(margin2), width(width), newline(newline) {}
+                bool empty() const noexcept { return items.empty(); }
+                void add(const WrapItem& item) { items.push_back(item); }
+                void flush(size_t& spaces);
+            private:
+                const U8string& src;
+                U8string& dst;
+                bool enforce;
+                bool optimal;
+                size_t spacing;
+                size_t margin2;
+                size_t width;
+                const U8string& newline;
+                std::vector<WrapItem> items;
+                std::vector<size_t> cost;
+                std::vector<size_t> prev;
+                size_t separator(size_t k) const noexcept { return items[k].joined ? 0 : spacing; }
+                void emit(size_t a, size_t b, size_t w, size_t& spaces);
+                void greedy(size_t& spaces);
+                void balanced(size_t& spaces);
+            };
+
+            void WrapLayout::flush(size_t& spaces) {
+                if (items.empty())
+                    return;
+                if (optimal)
+                    balanced(spaces);
+                else
+                    greedy(spaces);
+                items.clear();
+            }
+
+            void WrapLayout::emit(size_t a, size_t b, size_t w, size_t& spaces) {
+                if (enforce && w > width)
+                    throw std::length_error("Word is too long for wrapping width");
+                dst.append(spaces, ' ');
+                for (size_t k = a; k < b; ++k) {
+                    if (k > a && ! items[k].joined)
+                        dst += ' ';
+                    dst.append(src, items[k].offset, items[k].size);
+                }
+                dst += newline;
+                spaces = margin2;
+            }
+
+            // Fill each line with as many items as will fit
+
+            void WrapLayout::greedy(size_t& spaces) {
+                size_t a = 0, n = items.size();
+                while (a < n) {
+                    size_t b = a + 1, w = spaces * spacing + items[a].width;
+                    for (; b < n; ++b) {
+                        size_t add = separator(b) + items[b].width;
+                        if (w + add > width)
+                            break;
+                        w += add;
+                    }
+                    emit(a, b, w, spaces);
+                    a = b;
+                }
+            }
+
+            // Choose the break points that minimize the sum of the squares of
+            // the space left at the end of each line except the last; an item
+            // too long to fit is allowed a line of its own
+
+            void WrapLayout::balanced(size_t& spaces) {
+                static constexpr size_t infinity = npos;
+                size_t n = items.size();
+                cost.assign(n + 1, infinity);
+                prev.assign(n + 1, 0);
+                cost[0] = 0;
+                for (size_t b = 1; b <= n; ++b) {
+                    size_t w = items[b - 1].width;
+                    for (size_t a = b; a-- > 0;) {
+                        if (a < b - 1)
+                            w += items[a].width + separator(a + 1);
+                        size_t total = (a == 0 ? spaces : margin2) * spacing + w;
+                        if (total > width && a < b - 1)
+                            break;
+                        if (cost[a] == infinity)
+                            continue;
+                        size_t slack = total < width ? width - total : 0;
+                        size_t c = cost[a] + (b == n ? 0 : slack * slack);
+                        if (c < cost[b]) {
+                            cost[b] = c;
+                            prev[b] = a;
+                        }
+                    }
+                }
+                std::vector<size_t> breaks;
+                for (size_t b = n; b > 0; b = prev[b])
+                    breaks.push_back(b);
+                size_t a = 0;
+                for (auto i = breaks.rbegin(); i != breaks.rend(); ++i) {
+                    size_t w = spaces * spacing;
+                    for (size_t k = a; k < *i; ++k)
+                        w += (k > a ? separator(k) : 0) + items[k].width;
+                    emit(a, *i, w, spaces);
+                    a = *i;
+                }
+            }
+
+        }
+
+        void str_wrap_helper(const U8string& src, U8string& dst, bool enforce, bool optimal, bool preserve, uint32_t flags,
+                size_t margin, size_t margin2, size_t width, const U8string& newline) {
             if (width == npos) {
                 auto columns = decnum(cstr(getenv("COLUMNS")));
                 if (columns < 3)
@@ -777,58 +1361,42 @@ namespace RS::Unicorn {
             if (margin >= width || margin2 >= width)
                 throw std::length_error("Word wrap width and margins are inconsistent");
             size_t spacing = flags & Length::wide ? 2 : 1;
-            auto range = utf_range(src);
-            auto i = range.begin(), e = range.end();
-            size_t linewidth = 0, words = 0, linebreaks = 0, spaces = margin, tailspaces = 0;
-            while (i != e) {
-                auto j = std::find_if_not(i, e, char_is_white_space);
-                if (j == e)
-                    break;
-                check_whitespace(i, j, linebreaks, tailspaces);
-                if (! dst.empty() && linebreaks >= 2) {
-                    if (words > 0) {
-                        dst += newline;
-                        words = linewidth = 0;
-                    }
-                    dst += newline;
-                    spaces = margin;
+            WrapLayout layout(src, dst, enforce, optimal, spacing, margin2, width, newline);
+            auto gap = utf_begin(src), e = utf_end(src);
+            size_t linebreaks = 0, spaces = margin, tailspaces = 0;
+            LineBreakIterator<char> it(gap, e), end(e, e);
+            while (it != end) {
+                auto cb = std::find_if_not(it->begin(), it->end(), char_is_white_space);
+                if (cb == it->end()) {
+                    ++it;
+                    continue;
                 }
-                i = j;
-                if (preserve && linebreaks >= 1 && tailspaces >= 1) {
-                    if (words > 0)
+                auto ce = cb;
+                for (auto k = cb; k != it->end(); ++k)
+                    if (! char_is_white_space(*k))
+                        ce = std::next(k);
+                bool joined = cb == gap;
+                if (! joined) {
+                    check_whitespace(gap, cb, linebreaks, tailspaces);
+                    if ((! dst.empty() || ! layout.empty()) && linebreaks >= 2) {
+                        layout.flush(spaces);
                         dst += newline;
-                    dst.append(tailspaces, ' ');
-                    j = std::find_if(i, e, char_is_line_break);
-                    dst += str_unify_lines(u_str(i, j), newline);
-                    words = linewidth = 0;
-                } else {
-                    j = std::find_if(i, e, char_is_white_space);
-                    auto word = u_str(i, j);
-                    auto wordlen = str_length(word, flags & all_length_flags);
-                    if (words > 0) {
-                        if (linewidth + wordlen + spacing > size_t(width)) {
-                            dst += newline;
-                            words = linewidth = 0;
-                        } else {
-                            dst += ' ';
-                            linewidth += spacing;
-                        }
+                        spaces = margin;
                     }
-                    if (words == 0) {
-                        dst.append(spaces, ' ');
-                        linewidth = spaces * spacing;
-                        spaces = margin2;
+                    if (preserve && linebreaks >= 1 && tailspaces >= 1) {
+                        layout.flush(spaces);
+                        dst.append(tailspaces, ' ');
+                        gap = std::find_if(cb, e, char_is_line_break);
+                        dst += str_unify_lines(u_str(cb, gap), newline);
+                        it = LineBreakIterator<char>(gap, e);
+                        continue;
                     }
-                    dst += word;
-                    ++words;
-                    linewidth += wordlen;
-                    if (enforce && linewidth > size_t(width))
-                        throw std::length_error("Word is too long for wrapping width");
                 }
-                i = j;
+                layout.add({cb.offset(), ce.offset() - cb.offset(), str_length(cb, ce, flags & all_length_flags), joined});
+                gap = ce;
+                ++it;
             }
-            if (words > 0)
-                dst += newline;
+            layout.flush(spaces);
         }
 
     }
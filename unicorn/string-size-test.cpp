@@ -471,11 +471,64 @@ namespace {
 
     }
 
+    void check_display_width() {
+
+        TEST_EQUAL(str_display_width(u8""s), 0);
+        TEST_EQUAL(str_display_width(u8"Hello world"s), 11);
+        TEST_EQUAL(str_display_width(u8"Hello\tworld\n"s), 10);                    // controls
+        TEST_EQUAL(str_display_width(u8"ÀÀÀ"s), 3);                                // neutral
+        TEST_EQUAL(str_display_width(u8"ààà"s), 3);                                // ambiguous
+        TEST_EQUAL(str_display_width(u8"ààà"s, Length::wide), 6);                  // ambiguous
+        TEST_EQUAL(str_display_width(u8"\u3000\u3000\u3000"s), 6);                 // fullwidth
+        TEST_EQUAL(str_display_width(u8"\u20a9\u20a9\u20a9"s), 3);                 // halfwidth
+        TEST_EQUAL(str_display_width(u8"Hello 世界"s), 10);                         // narrow + wide
+        TEST_EQUAL(str_display_width(u8"a\u0301e\u0301"s), 2);                     // combining marks
+        TEST_EQUAL(str_display_width(u8"a\u200bb\u00adc"s), 4);                    // format characters
+        TEST_EQUAL(str_display_width(u8"\u1100\u1161\u11a8"s), 2);                 // conjoining jamo
+        TEST_EQUAL(str_display_width(u8"\U0001f600\U0001f600"s), 4);               // emoji
+        TEST_EQUAL(str_display_width(u8"\U0001f44d\U0001f3fd"s), 2);               // emoji + modifier
+        TEST_EQUAL(str_display_width(u8"\U0001f468\u200d\U0001f469\u200d\U0001f467"s), 2);  // ZWJ sequence
+        TEST_EQUAL(str_display_width(u8"a\u200d\U0001f600"s), 3);                  // ZWJ after non-emoji
+        TEST_THROW(str_display_width(u8"Hello"s, Length::narrow | Length::wide), std::invalid_argument);
+
+        U8string s;
+        for (int i = 0; i < 100; ++i)
+            s += u8"abc 世界 ";
+        TEST_EQUAL(str_display_width(s), 900);
+        TEST_EQUAL(str_length(s, Length::narrow), 900);
+        TEST_EQUAL(str_length(s, Length::characters), 700);
+
+    }
+
+    void check_view_length() {
+
+        U8string s = u8"[a\u0301e\u0301 世界]";
+        std::string_view v(s.data() + 1, s.size() - 2);
+        std::u16string s16 = u"a\u0301e\u0301 世界";
+
+        TEST_EQUAL(str_length(v), 7);
+        TEST_EQUAL(str_length(v, Length::characters), 7);
+        TEST_EQUAL(str_length(v, Length::graphemes), 5);
+        TEST_EQUAL(str_length(v, Length::narrow), 7);
+        TEST_EQUAL(str_length(v, Length::graphemes | Length::narrow), 7);
+        TEST_EQUAL(str_length(v.substr(0, 6)), 4);
+        TEST_EQUAL(str_length(std::u16string_view(s16), Length::graphemes), 5);
+        TEST_EQUAL(str_length(utf_range(v), Length::graphemes), 5);
+        TEST_EQUAL(str_length(utf_iterator(v, 6), utf_end(v)), 3);
+        TEST_EQUAL(Length(Length::narrow)(v), 7);
+        TEST_EQUAL(Length()("Hello"), 5);
+        TEST_EQUAL(str_display_width(v), 7);
+        TEST_EQUAL(str_display_width("Hello"), 5);
+
+    }
+
 }
 
 TEST_MODULE(unicorn, string_size) {
 
     check_length();
     check_find_offset();
+    check_display_width();
+    check_view_length();
 
 }
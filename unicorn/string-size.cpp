@@ -0,0 +1,223 @@
+#include "unicorn/string.hpp"
+#include "unicorn/ucd-tables.hpp"
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+namespace RS::Unicorn {
+
+    namespace {
+
+        using namespace UnicornDetail;
+
+        constexpr uint64_t ones = 0x0101010101010101ull, highs = ones << 7;
+
+        // Ranges of pictographs usually displayed as wide emoji by
+        // terminals, whatever their East Asian width in the UCD
+
+        constexpr std::pair<char32_t, char32_t> emoji_ranges[] = {
+            {0x1f300, 0x1f5ff},  // Miscellaneous Symbols and Pictographs
+            {0x1f600, 0x1f64f},  // Emoticons
+            {0x1f680, 0x1f6ff},  // Transport and Map Symbols
+            {0x1f900, 0x1f9ff},  // Supplemental Symbols and Pictographs
+        };
+
+        // Emoji skin tone modifiers, combined with the preceding emoji
+
+        constexpr char32_t first_emoji_modifier = 0x1f3fb;
+        constexpr char32_t last_emoji_modifier = 0x1f3ff;
+
+        constexpr char32_t soft_hyphen = 0xad;
+        constexpr char32_t zero_width_joiner = 0x200d;
+
+        bool is_hangul_trailing_jamo(char32_t c) noexcept {
+            return (c >= 0x1160 && c <= 0x11ff) || (c >= 0xd7b0 && c <= 0xd7ff);
+        }
+
+        uint8_t calculate_width_class(char32_t c) noexcept {
+            auto gc = char_general_category(c);
+            uint8_t w = width_narrow;
+            if (gc == GC::Mn) {
+                w = width_non_advancing;
+            } else {
+                switch (east_asian_width(c)) {
+                    case East_Asian_Width::F:
+                    case East_Asian_Width::W:  w = width_wide; break;
+                    case East_Asian_Width::A:  w = width_ambiguous; break;
+                    default:                   break;
+                }
+            }
+            if (gc == GC::Mn || gc == GC::Me || gc == GC::Cc || (gc == GC::Cf && c != soft_hyphen)
+                    || is_hangul_trailing_jamo(c) || (c >= first_emoji_modifier && c <= last_emoji_modifier))
+                w |= width_zero_display;
+            for (auto& r: emoji_ranges)
+                if (c >= r.first && c <= r.second && ! (w & width_zero_display))
+                    w |= width_emoji;
+            return w;
+        }
+
+        // The first stage is indexed by the high bits of the code point, and
+        // gives the index of a 256 entry block in the second stage. Blocks
+        // are shared; most of the code space is covered by a few of them.
+        // The properties are only looked up at the points where one of the
+        // underlying tables changes value.
+
+        class WidthTable {
+        public:
+            WidthTable();
+            uint8_t operator[](char32_t c) const noexcept { return blocks[(size_t(index[c >> 8]) << 8) + (c & 0xff)]; }
+        private:
+            std::vector<uint16_t> index;
+            std::vector<uint8_t> blocks;
+        };
+
+        WidthTable::WidthTable() {
+            std::vector<char32_t> breaks;
+            for (auto& kv: general_category_table)
+                breaks.push_back(kv.key);
+            for (auto& kv: east_asian_width_table)
+                breaks.push_back(kv.key);
+            for (auto& r: emoji_ranges) {
+                breaks.push_back(r.first);
+                breaks.push_back(r.second + 1);
+            }
+            for (char32_t c: {soft_hyphen, char32_t(soft_hyphen + 1), char32_t(0x1160), char32_t(0x1200), char32_t(0xd7b0), char32_t(0xd800),
+                    first_emoji_modifier, char32_t(last_emoji_modifier + 1)})
+                breaks.push_back(c);
+            breaks.push_back(0);
+            breaks.push_back(last_unicode_char + 1);
+            std::sort(breaks.begin(), breaks.end());
+            breaks.erase(std::unique(breaks.begin(), breaks.end()), breaks.end());
+            while (breaks.back() > last_unicode_char + 1)
+                breaks.pop_back();
+            std::vector<uint8_t> flat(last_unicode_char + 1);
+            for (size_t i = 0; i + 1 < breaks.size(); ++i)
+                std::fill(flat.begin() + breaks[i], flat.begin() + breaks[i + 1], calculate_width_class(breaks[i]));
+            std::map<std::string, uint16_t> seen;
+            index.resize((last_unicode_char >> 8) + 1);
+            for (size_t i = 0; i < index.size(); ++i) {
+                std::string block(reinterpret_cast<const char*>(flat.data()) + (i << 8), 256);
+                auto it = seen.find(block);
+                if (it == seen.end()) {
+                    it = seen.insert({block, uint16_t(seen.size())}).first;
+                    blocks.insert(blocks.end(), block.begin(), block.end());
+                }
+                index[i] = it->second;
+            }
+        }
+
+        const WidthTable& width_table() {
+            static const WidthTable table;
+            return table;
+        }
+
+    }
+
+    namespace UnicornDetail {
+
+        uint8_t char_width_class(char32_t c) noexcept {
+            return width_table()[std::min(c, last_unicode_char)];
+        }
+
+        size_t ascii_run(const char* ptr, size_t n) noexcept {
+            size_t i = 0;
+            for (; n - i >= 8; i += 8) {
+                uint64_t x;
+                std::memcpy(&x, ptr + i, 8);
+                if (x & highs)
+                    break;
+            }
+            while (i < n && uint8_t(ptr[i]) < 0x80)
+                ++i;
+            return i;
+        }
+
+        size_t printable_ascii_run(const char* ptr, size_t n) noexcept {
+            // A block is printable if no byte has its high bit set, either
+            // already, after subtracting 0x20 (below 0x20), or after adding 1
+            // (0x7f); a borrow can only produce a false negative
+            static constexpr uint64_t low = 0x20 * ones;
+            size_t i = 0;
+            for (; n - i >= 8; i += 8) {
+                uint64_t x;
+                std::memcpy(&x, ptr + i, 8);
+                if (((x - low) | (x + ones) | x) & highs)
+                    break;
+            }
+            while (i < n && ptr[i] >= 0x20 && ptr[i] < 0x7f)
+                ++i;
+            return i;
+        }
+
+    }
+
+    size_t Length::operator()(std::string_view str) const {
+        using namespace UnicornDetail;
+        size_t pos = printable_ascii_run(str.data(), str.size());
+        if (pos == str.size())
+            return pos;
+        if ((flags & Length::graphemes) || ! (flags & (Length::characters | east_asian_flags)))
+            return (*this)(utf_range(str));
+        EastAsianCount eac(flags);
+        eac.add_narrow(pos);
+        while (pos < str.size()) {
+            size_t n = ascii_run(str.data() + pos, str.size() - pos);
+            eac.add_narrow(n);
+            pos += n;
+            if (pos == str.size())
+                break;
+            auto i = utf_iterator(str, pos);
+            if (flags & Length::characters)
+                eac.add_narrow(1);
+            else
+                eac.add(*i);
+            pos += i.count();
+        }
+        return eac.get();
+    }
+
+    size_t str_display_width(std::string_view str, uint32_t flags) {
+        using namespace UnicornDetail;
+        if ((flags & east_asian_flags) == east_asian_flags)
+            throw std::invalid_argument("Inconsistent string length flags");
+        size_t ambiguous = flags & Length::wide ? 2 : 1;
+        size_t pos = 0, width = 0;
+        bool emoji = false, joined = false;
+        while (pos < str.size()) {
+            size_t n = printable_ascii_run(str.data() + pos, str.size() - pos);
+            if (n > 0) {
+                width += n;
+                pos += n;
+                emoji = joined = false;
+                if (pos == str.size())
+                    break;
+            }
+            auto i = utf_iterator(str, pos);
+            pos += i.count();
+            if (*i == zero_width_joiner) {
+                joined = emoji;
+                continue;
+            }
+            auto w = char_width_class(*i);
+            if (w & width_zero_display)
+                continue;
+            // An emoji joined to a preceding emoji by ZWJ forms one glyph
+            if (w & width_emoji) {
+                if (! joined)
+                    width += 2;
+                emoji = true;
+            } else {
+                switch (w & width_mask) {
+                    case width_narrow:     width += 1; break;
+                    case width_wide:       width += 2; break;
+                    case width_ambiguous:  width += ambiguous; break;
+                    default:               break;
+                }
+                emoji = false;
+            }
+            joined = false;
+        }
+        return width;
+    }
+
+}
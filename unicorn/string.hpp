@@ -6,7 +6,6 @@
 #include "unicorn/utf.hpp"
 #include "rs-core/kwargs.hpp"
 #include <algorithm>
-#include <cerrno>
 #include <cmath>
 #include <cstring>
 #include <initializer_list>
@@ -14,6 +13,7 @@
 #include <limits>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -73,6 +73,7 @@ namespace RS::Unicorn {
     }
 
     // String size functions
+    // Defined in string-size.cpp
 
     // Remember that any other set of flags that might be combined with these
     // needs to skip the bits that are already spoken for. The string length
@@ -87,9 +88,15 @@ namespace RS::Unicorn {
         uint32_t flags = 0;
         Length() = default;
         explicit Length(uint32_t length_flags);
+        size_t operator()(std::string_view str) const;
         template <typename C> size_t operator()(const std::basic_string<C>& str) const;
+        template <typename C> size_t operator()(std::basic_string_view<C> str) const;
         template <typename C> size_t operator()(const Irange<UtfIterator<C>>& range) const;
         template <typename C> size_t operator()(const UtfIterator<C>& b, const UtfIterator<C>& e) const;
+        template <typename C> size_t operator()(const Irange<UtfViewIterator<C>>& range) const;
+        template <typename C> size_t operator()(const UtfViewIterator<C>& b, const UtfViewIterator<C>& e) const;
+    private:
+        template <typename UI> size_t count_range(const Irange<UI>& range) const;
     };
 
     namespace UnicornDetail {
@@ -101,8 +108,8 @@ namespace RS::Unicorn {
             return char_general_category(c) != GC::Mn;
         }
 
-        template <typename C>
-        inline bool grapheme_is_advancing(Irange<UtfIterator<C>> g) {
+        template <typename UI>
+        inline bool grapheme_is_advancing(Irange<UI> g) {
             return ! g.empty() && char_is_advancing(*g.begin());
         }
 
@@ -114,26 +121,43 @@ namespace RS::Unicorn {
                 flags |= Length::characters;
         }
 
+        // Width class of a character, looked up in a two stage table built
+        // on first use. The low two bits are the East Asian width class used
+        // by Length (0 = non-advancing, 1 = narrow, 2 = wide, 3 =
+        // ambiguous); the other bits are used only by str_display_width().
+
+        constexpr uint8_t width_non_advancing  = 0;
+        constexpr uint8_t width_narrow         = 1;
+        constexpr uint8_t width_wide           = 2;
+        constexpr uint8_t width_ambiguous      = 3;
+        constexpr uint8_t width_mask           = 3;
+        constexpr uint8_t width_zero_display   = 4;  // Takes no space on a terminal
+        constexpr uint8_t width_emoji          = 8;  // Pictograph displayed as wide
+
+        uint8_t char_width_class(char32_t c) noexcept;
+
+        // Length of the run of ASCII (or printable ASCII) bytes at the start
+        // of a block, checked 8 bytes at a time
+
+        size_t ascii_run(const char* ptr, size_t n) noexcept;
+        size_t printable_ascii_run(const char* ptr, size_t n) noexcept;
+
         class EastAsianCount {
         public:
             explicit EastAsianCount(uint32_t flags) noexcept: count(), fset(flags) { memset(count, 0, sizeof(count)); }
             void add(char32_t c) noexcept {
-                if (char_is_advancing(c))
-                    ++count[unsigned(east_asian_width(c))];
+                if (c < 0x80)
+                    ++count[width_narrow];
+                else
+                    ++count[char_width_class(c) & width_mask];
             }
+            void add_narrow(size_t n) noexcept { count[width_narrow] += n; }
             size_t get() const noexcept {
                 size_t default_width = fset & Length::wide ? 2 : 1;
-                return count[neut] + count[half] + count[narr] + 2 * count[full] + 2 * count[wide]
-                    + default_width * count[ambi];
+                return count[width_narrow] + 2 * count[width_wide] + default_width * count[width_ambiguous];
             }
         private:
-            static constexpr auto neut = int(East_Asian_Width::N);
-            static constexpr auto ambi = int(East_Asian_Width::A);
-            static constexpr auto full = int(East_Asian_Width::F);
-            static constexpr auto half = int(East_Asian_Width::H);
-            static constexpr auto narr = int(East_Asian_Width::Na);
-            static constexpr auto wide = int(East_Asian_Width::W);
-            size_t count[6];
+            size_t count[4];
             uint32_t fset;
         };
 
@@ -191,11 +215,36 @@ namespace RS::Unicorn {
 
     template <typename C>
     size_t Length::operator()(const std::basic_string<C>& str) const {
+        return (*this)(std::basic_string_view<C>(str));
+    }
+
+    template <typename C>
+    size_t Length::operator()(std::basic_string_view<C> str) const {
         return (*this)(utf_range(str));
     }
 
     template <typename C>
     size_t Length::operator()(const Irange<UtfIterator<C>>& range) const {
+        return count_range(range);
+    }
+
+    template <typename C>
+    size_t Length::operator()(const UtfIterator<C>& b, const UtfIterator<C>& e) const {
+        return (*this)(irange(b, e));
+    }
+
+    template <typename C>
+    size_t Length::operator()(const Irange<UtfViewIterator<C>>& range) const {
+        return count_range(range);
+    }
+
+    template <typename C>
+    size_t Length::operator()(const UtfViewIterator<C>& b, const UtfViewIterator<C>& e) const {
+        return (*this)(irange(b, e));
+    }
+
+    template <typename UI>
+    size_t Length::count_range(const Irange<UI>& range) const {
         using namespace UnicornDetail;
         if (flags & Length::characters) {
             return range_count(range);
@@ -211,17 +260,17 @@ namespace RS::Unicorn {
             return eac.get();
         } else {
             auto gr = grapheme_range(range);
-            return std::count_if(gr.begin(), gr.end(), grapheme_is_advancing<C>);
+            return std::count_if(gr.begin(), gr.end(), grapheme_is_advancing<UI>);
         }
     }
 
     template <typename C>
-    size_t Length::operator()(const UtfIterator<C>& b, const UtfIterator<C>& e) const {
-        return (*this)(irange(b, e));
+    size_t str_length(const std::basic_string<C>& str, uint32_t flags = 0) {
+        return Length(flags)(str);
     }
 
     template <typename C>
-    size_t str_length(const std::basic_string<C>& str, uint32_t flags = 0) {
+    size_t str_length(std::basic_string_view<C> str, uint32_t flags = 0) {
         return Length(flags)(str);
     }
 
@@ -235,6 +284,18 @@ namespace RS::Unicorn {
         return Length(flags)(b, e);
     }
 
+    template <typename C>
+    size_t str_length(const Irange<UtfViewIterator<C>>& range, uint32_t flags = 0) {
+        return Length(flags)(range);
+    }
+
+    template <typename C>
+    size_t str_length(const UtfViewIterator<C>& b, const UtfViewIterator<C>& e, uint32_t flags = 0) {
+        return Length(flags)(b, e);
+    }
+
+    size_t str_display_width(std::string_view str, uint32_t flags = 0);
+
     template <typename C>
     UtfIterator<C> str_find_index(const Irange<UtfIterator<C>>& range, size_t pos, uint32_t flags = 0) {
         return UnicornDetail::find_position(range, pos, flags).first;
@@ -288,7 +349,37 @@ namespace RS::Unicorn {
     int str_compare_3way(const U8string& lhs, const U8string& rhs);
     bool str_icase_compare(const U8string& lhs, const U8string& rhs) noexcept;
     bool str_icase_equal(const U8string& lhs, const U8string& rhs) noexcept;
+    size_t str_icase_hash(const U8string& str) noexcept;
     bool str_natural_compare(const U8string& lhs, const U8string& rhs) noexcept;
+    U8string str_icase_sort_key(const U8string& str);
+    U8string str_natural_sort_key(const U8string& str);
+
+    struct IcaseEqual { bool operator()(const U8string& lhs, const U8string& rhs) const noexcept { return str_icase_equal(lhs, rhs); } };
+    struct IcaseHash { size_t operator()(const U8string& str) const noexcept { return str_icase_hash(str); } };
+
+    namespace UnicornDetail {
+
+        template <typename Range, typename KeyFunction>
+        void sort_by_key(Range& range, KeyFunction key) {
+            using std::begin;
+            using std::end;
+            auto first = begin(range);
+            auto n = size_t(std::distance(first, end(range)));
+            std::vector<std::pair<U8string, size_t>> keys(n);
+            for (size_t i = 0; i < n; ++i)
+                keys[i] = {key(first[i]), i};
+            std::sort(keys.begin(), keys.end());
+            std::vector<std::decay_t<decltype(*first)>> sorted;
+            sorted.reserve(n);
+            for (auto& k: keys)
+                sorted.push_back(std::move(first[k.second]));
+            std::move(sorted.begin(), sorted.end(), first);
+        }
+
+    }
+
+    template <typename Range> void str_icase_sort(Range& range) { UnicornDetail::sort_by_key(range, str_icase_sort_key); }
+    template <typename Range> void str_natural_sort(Range& range) { UnicornDetail::sort_by_key(range, str_natural_sort_key); }
 
     template <typename C>
     bool utf_compare(const std::basic_string<C>& lhs, const std::basic_string<C>& rhs) noexcept {
@@ -298,6 +389,66 @@ namespace RS::Unicorn {
             return lhs < rhs;
     }
 
+    // Character sets and maps
+    // Defined in string-algorithm.cpp
+
+    class CharSet {
+    public:
+        CharSet() = default;
+        explicit CharSet(const U8string& chars);
+        explicit CharSet(const char* chars): CharSet(cstr(chars)) {}
+        explicit CharSet(GC cat);
+        template <typename Pred, typename = std::enable_if_t<std::is_invocable_r<bool, Pred, char32_t>::value>>
+            explicit CharSet(Pred p);
+        bool operator()(char32_t c) const noexcept { return contains(c); }
+        bool contains(char32_t c) const noexcept {
+            if (c < 0x80)
+                return (ascii[c >> 6] >> (c & 63)) & 1;
+            else
+                return ! ranges.empty() && contains_other(c);
+        }
+        bool empty() const noexcept { return ascii[0] == 0 && ascii[1] == 0 && ranges.empty(); }
+        void insert(char32_t c) { insert(c, c); }
+        void insert(char32_t first, char32_t last);
+    private:
+        uint64_t ascii[2] = {0, 0};
+        std::vector<std::pair<char32_t, char32_t>> ranges; // Sorted, disjoint, non-adjacent, all >= 0x80
+        bool contains_other(char32_t c) const noexcept;
+    };
+
+    template <typename Pred, typename>
+    CharSet::CharSet(Pred p) {
+        for (char32_t c = 0; c < 0x80; ++c)
+            if (p(c))
+                ascii[c >> 6] |= uint64_t(1) << (c & 63);
+        for (char32_t c = 0x80; c <= last_unicode_char; ++c) {
+            if (p(c)) {
+                if (! ranges.empty() && ranges.back().second == c - 1)
+                    ranges.back().second = c;
+                else
+                    ranges.push_back({c, c});
+            }
+        }
+    }
+
+    class CharMap {
+    public:
+        CharMap() noexcept;
+        CharMap(const U8string& target, const U8string& sub);
+        char32_t operator()(char32_t c) const noexcept {
+            if (c < 0x80)
+                return ascii[c];
+            else
+                return others.empty() ? c : map_other(c);
+        }
+        bool empty() const noexcept;
+        void insert(char32_t from, char32_t to);
+    private:
+        char32_t ascii[0x80];
+        std::vector<std::pair<char32_t, char32_t>> others; // Sorted by key, all keys >= 0x80
+        char32_t map_other(char32_t c) const noexcept;
+    };
+
     // Other string algorithms
     // Defined in string-algorithm.cpp
 
@@ -314,22 +465,73 @@ namespace RS::Unicorn {
     Utf8Iterator str_find_first_of(const Utf8Iterator& b, const Utf8Iterator& e, const U8string& target);
     Utf8Iterator str_find_first_of(const Irange<Utf8Iterator>& range, const U8string& target);
     Utf8Iterator str_find_first_of(const U8string& str, const U8string& target);
+    Utf8Iterator str_find_first_of(const Utf8Iterator& b, const Utf8Iterator& e, const CharSet& target);
+    Utf8Iterator str_find_first_of(const Irange<Utf8Iterator>& range, const CharSet& target);
+    Utf8Iterator str_find_first_of(const U8string& str, const CharSet& target);
     Utf8Iterator str_find_first_not_of(const Utf8Iterator& b, const Utf8Iterator& e, const U8string& target);
     Utf8Iterator str_find_first_not_of(const Irange<Utf8Iterator>& range, const U8string& target);
     Utf8Iterator str_find_first_not_of(const U8string& str, const U8string& target);
+    Utf8Iterator str_find_first_not_of(const Utf8Iterator& b, const Utf8Iterator& e, const CharSet& target);
+    Utf8Iterator str_find_first_not_of(const Irange<Utf8Iterator>& range, const CharSet& target);
+    Utf8Iterator str_find_first_not_of(const U8string& str, const CharSet& target);
     Utf8Iterator str_find_last_of(const Utf8Iterator& b, const Utf8Iterator& e, const U8string& target);
     Utf8Iterator str_find_last_of(const Irange<Utf8Iterator>& range, const U8string& target);
     Utf8Iterator str_find_last_of(const U8string& str, const U8string& target);
+    Utf8Iterator str_find_last_of(const Utf8Iterator& b, const Utf8Iterator& e, const CharSet& target);
+    Utf8Iterator str_find_last_of(const Irange<Utf8Iterator>& range, const CharSet& target);
+    Utf8Iterator str_find_last_of(const U8string& str, const CharSet& target);
     Utf8Iterator str_find_last_not_of(const Utf8Iterator& b, const Utf8Iterator& e, const U8string& target);
     Utf8Iterator str_find_last_not_of(const Irange<Utf8Iterator>& range, const U8string& target);
     Utf8Iterator str_find_last_not_of(const U8string& str, const U8string& target);
+    Utf8Iterator str_find_last_not_of(const Utf8Iterator& b, const Utf8Iterator& e, const CharSet& target);
+    Utf8Iterator str_find_last_not_of(const Irange<Utf8Iterator>& range, const CharSet& target);
+    Utf8Iterator str_find_last_not_of(const U8string& str, const CharSet& target);
     std::pair<size_t, size_t> str_line_column(const U8string& str, size_t offset, size_t flags = 0);
     Irange<Utf8Iterator> str_search(const Utf8Iterator& b, const Utf8Iterator& e, const U8string& target);
     Irange<Utf8Iterator> str_search(const Irange<Utf8Iterator>& range, const U8string& target);
     Irange<Utf8Iterator> str_search(const U8string& str, const U8string& target);
+    Irange<Utf8ViewIterator> str_search(const Utf8ViewIterator& b, const Utf8ViewIterator& e, std::string_view target);
+    Irange<Utf8ViewIterator> str_search(const Irange<Utf8ViewIterator>& range, std::string_view target);
+    Irange<Utf8ViewIterator> str_search(std::string_view str, std::string_view target);
     size_t str_skipws(Utf8Iterator& i, const Utf8Iterator& end);
     size_t str_skipws(Utf8Iterator& i);
 
+    class LineIndex {
+    public:
+        LineIndex() = default;
+        explicit LineIndex(std::string_view str, uint32_t flags = 0);
+        explicit LineIndex(U8string&& str, uint32_t flags = 0) = delete;
+        std::pair<size_t, size_t> line_column(size_t offset) const;
+        size_t line_offset(size_t line) const noexcept;
+        size_t lines() const noexcept { return starts.size(); }
+    private:
+        std::string_view src;
+        uint32_t fset = 0;
+        std::vector<size_t> starts;  // Offset of the start of each line
+        std::vector<bool> ascii;     // Line contains only ASCII characters
+    };
+
+    // Multiple substring replacement
+    // Defined in string-manip.cpp
+
+    class Replacer {
+    public:
+        Replacer() = default;
+        Replacer(std::initializer_list<std::pair<U8string, U8string>> list);
+        U8string operator()(const U8string& str) const;
+        bool empty() const noexcept { return targets.empty(); }
+        void insert(const U8string& target, const U8string& sub);
+    private:
+        std::vector<U8string> targets;
+        std::vector<U8string> subs;
+        uint16_t classes[256] = {};   // Byte equivalence classes; 0 for bytes in no target
+        size_t nclasses = 1;
+        std::vector<uint32_t> delta;  // Transition table, indexed by state * nclasses + class
+        std::vector<uint32_t> depth;  // Length of the target prefix matched in each state
+        std::vector<uint32_t> match;  // Index+1 of the longest target ending in each state, or 0
+        void build();
+    };
+
     // String manipulation functions
     // Defined in string-manip.cpp
 
@@ -429,15 +631,25 @@ namespace RS::Unicorn {
     bool str_partition(const U8string& str, U8string& prefix, U8string& suffix);
     bool str_partition_at(const U8string& str, U8string& prefix, U8string& suffix, const U8string& delim);
     bool str_partition_by(const U8string& str, U8string& prefix, U8string& suffix, const U8string& delim);
+    bool str_partition_by(const U8string& str, U8string& prefix, U8string& suffix, const CharSet& delim);
     U8string str_remove(const U8string& str, char32_t c);
     U8string str_remove(const U8string& str, const U8string& chars);
+    U8string str_remove(const U8string& str, const CharSet& chars);
     void str_remove_in(U8string& str, char32_t c);
     void str_remove_in(U8string& str, const U8string& chars);
+    void str_remove_in(U8string& str, const CharSet& chars);
+    U8string str_remove_if(const U8string& str, GcSet cats);
+    U8string str_remove_if_not(const U8string& str, GcSet cats);
+    void str_remove_in_if(U8string& str, GcSet cats);
+    void str_remove_in_if_not(U8string& str, GcSet cats);
     U8string str_replace(const U8string& str, const U8string& target, const U8string& sub, size_t n = npos);
     void str_replace_in(U8string& str, const U8string& target, const U8string& sub, size_t n = npos);
+    U8string str_replace_multi(const U8string& str, const Replacer& rep);
+    void str_replace_multi_in(U8string& str, const Replacer& rep);
     Strings str_splitv(const U8string& src);
     Strings str_splitv_at(const U8string& src, const U8string& delim);
     Strings str_splitv_by(const U8string& src, const U8string& delim);
+    Strings str_splitv_by(const U8string& src, const CharSet& delim);
     U8string str_squeeze(const U8string& str);
     U8string str_squeeze(const U8string& str, const U8string& chars);
     U8string str_squeeze_trim(const U8string& str);
@@ -446,22 +658,50 @@ namespace RS::Unicorn {
     void str_squeeze_in(U8string& str, const U8string& chars);
     void str_squeeze_trim_in(U8string& str);
     void str_squeeze_trim_in(U8string& str, const U8string& chars);
+    U8string str_squeeze_runs(const U8string& str, const CharSet& chars);
+    U8string str_squeeze_runs(const U8string& str, GcSet cats);
+    U8string str_squeeze_runs_trim(const U8string& str, const CharSet& chars);
+    U8string str_squeeze_runs_trim(const U8string& str, GcSet cats);
+    void str_squeeze_runs_in(U8string& str, const CharSet& chars);
+    void str_squeeze_runs_in(U8string& str, GcSet cats);
+    void str_squeeze_runs_trim_in(U8string& str, const CharSet& chars);
+    void str_squeeze_runs_trim_in(U8string& str, GcSet cats);
     U8string str_substring(const U8string& str, size_t offset, size_t count = npos);
     U8string utf_substring(const U8string& str, size_t index, size_t length = npos, uint32_t flags = 0);
     U8string str_translate(const U8string& str, const U8string& target, const U8string& sub);
+    U8string str_translate(const U8string& str, const CharMap& map);
     void str_translate_in(U8string& str, const U8string& target, const U8string& sub);
+    void str_translate_in(U8string& str, const CharMap& map);
     U8string str_trim(const U8string& str, const U8string& chars);
+    U8string str_trim(const U8string& str, const CharSet& chars);
     U8string str_trim(const U8string& str);
     U8string str_trim_left(const U8string& str, const U8string& chars);
+    U8string str_trim_left(const U8string& str, const CharSet& chars);
     U8string str_trim_left(const U8string& str);
     U8string str_trim_right(const U8string& str, const U8string& chars);
+    U8string str_trim_right(const U8string& str, const CharSet& chars);
     U8string str_trim_right(const U8string& str);
     void str_trim_in(U8string& str, const U8string& chars);
+    void str_trim_in(U8string& str, const CharSet& chars);
     void str_trim_in(U8string& str);
     void str_trim_left_in(U8string& str, const U8string& chars);
+    void str_trim_left_in(U8string& str, const CharSet& chars);
     void str_trim_left_in(U8string& str);
     void str_trim_right_in(U8string& str, const U8string& chars);
+    void str_trim_right_in(U8string& str, const CharSet& chars);
     void str_trim_right_in(U8string& str);
+    U8string str_trim_if(const U8string& str, GcSet cats);
+    U8string str_trim_left_if(const U8string& str, GcSet cats);
+    U8string str_trim_right_if(const U8string& str, GcSet cats);
+    U8string str_trim_if_not(const U8string& str, GcSet cats);
+    U8string str_trim_left_if_not(const U8string& str, GcSet cats);
+    U8string str_trim_right_if_not(const U8string& str, GcSet cats);
+    void str_trim_in_if(U8string& str, GcSet cats);
+    void str_trim_left_in_if(U8string& str, GcSet cats);
+    void str_trim_right_in_if(U8string& str, GcSet cats);
+    void str_trim_in_if_not(U8string& str, GcSet cats);
+    void str_trim_left_in_if_not(U8string& str, GcSet cats);
+    void str_trim_right_in_if_not(U8string& str, GcSet cats);
     U8string str_unify_lines(const U8string& str, const U8string& newline);
     U8string str_unify_lines(const U8string& str, char32_t newline);
     U8string str_unify_lines(const U8string& str);
@@ -472,6 +712,7 @@ namespace RS::Unicorn {
     struct Wrap {
 
         static constexpr Kwarg<bool> enforce = {};      // Enforce right margin strictly (default false)
+        static constexpr Kwarg<bool> optimal = {};      // Balance line lengths instead of filling each line (default false)
         static constexpr Kwarg<bool> preserve = {};     // Preserve layout on already indented lines (default false)
         static constexpr Kwarg<uint32_t> flags = {};    // Flags for string length (default 0)
         static constexpr Kwarg<size_t> margin = {};     // Margin for first line (default 0)
@@ -483,12 +724,30 @@ namespace RS::Unicorn {
 
     namespace UnicornDetail {
 
-        void str_wrap_helper(const U8string& src, U8string& dst, bool enforce, bool preserve, uint32_t flags, size_t margin, size_t margin2, size_t width, const U8string& newline);
+        // Write one field from a split function. A StringInserter receives
+        // the field as a view, so it can be constructed directly in the
+        // destination container without a temporary string.
+
+        template <typename OutIter>
+        void split_output(OutIter& dst, std::string_view field) {
+            *dst = U8string(field);
+            ++dst;
+        }
+
+        template <typename Container>
+        void split_output(StringInserter<Container>& dst, std::string_view field) {
+            *dst = field;
+            ++dst;
+        }
+
+        void str_wrap_helper(const U8string& src, U8string& dst, bool enforce, bool optimal, bool preserve, uint32_t flags,
+            size_t margin, size_t margin2, size_t width, const U8string& newline);
 
     }
 
     template <typename... Args> U8string str_wrap(const U8string& str, const Args&... args) {
         bool enforce = false;
+        bool optimal = false;
         bool preserve = false;
         uint32_t flags = 0;
         size_t margin = 0;
@@ -496,6 +755,7 @@ namespace RS::Unicorn {
         size_t width = npos;
         U8string newline = "\n";
         kwget(Wrap::enforce, enforce, args...);
+        kwget(Wrap::optimal, optimal, args...);
         kwget(Wrap::preserve, preserve, args...);
         kwget(Wrap::flags, flags, args...);
         kwget(Wrap::margin, margin, args...);
@@ -503,12 +763,13 @@ namespace RS::Unicorn {
         kwget(Wrap::width, width, args...);
         kwget(Wrap::newline, newline, args...);
         U8string result;
-        UnicornDetail::str_wrap_helper(str, result, enforce, preserve, flags, margin, margin2, width, newline);
+        UnicornDetail::str_wrap_helper(str, result, enforce, optimal, preserve, flags, margin, margin2, width, newline);
         return result;
     }
 
     template <typename... Args> void str_wrap_in(U8string& str, const Args&... args) {
         bool enforce = false;
+        bool optimal = false;
         bool preserve = false;
         uint32_t flags = 0;
         size_t margin = 0;
@@ -516,6 +777,7 @@ namespace RS::Unicorn {
         size_t width = npos;
         U8string newline = "\n";
         kwget(Wrap::enforce, enforce, args...);
+        kwget(Wrap::optimal, optimal, args...);
         kwget(Wrap::preserve, preserve, args...);
         kwget(Wrap::flags, flags, args...);
         kwget(Wrap::margin, margin, args...);
@@ -523,7 +785,7 @@ namespace RS::Unicorn {
         kwget(Wrap::width, width, args...);
         kwget(Wrap::newline, newline, args...);
         U8string result;
-        UnicornDetail::str_wrap_helper(str, result, enforce, preserve, flags, margin, margin2, width, newline);
+        UnicornDetail::str_wrap_helper(str, result, enforce, optimal, preserve, flags, margin, margin2, width, newline);
         str = std::move(result);
     }
 
@@ -659,36 +921,48 @@ namespace RS::Unicorn {
             if (j == range.end())
                 break;
             i = std::find_if(j, range.end(), char_is_white_space);
-            *dst++ = u_str(j, i);
+            UnicornDetail::split_output(dst, std::string_view(src).substr(j.offset(), i.offset() - j.offset()));
         }
     }
 
     template <typename OutIter>
     void str_split_at(const U8string& src, OutIter dst, const U8string& delim) {
+        std::string_view view(src);
         if (delim.empty()) {
-            *dst++ = src;
+            UnicornDetail::split_output(dst, view);
             return;
         }
         size_t i = 0, dsize = delim.size();
         for (;;) {
             auto j = src.find(delim, i);
             if (j == npos) {
-                *dst++ = src.substr(i);
+                UnicornDetail::split_output(dst, view.substr(i));
                 break;
             }
-            *dst++ = src.substr(i, j - i);
+            UnicornDetail::split_output(dst, view.substr(i, j - i));
             i = j + dsize;
         }
     }
 
+    template <typename OutIter>
+    void str_split_by(const U8string& src, OutIter dst, const CharSet& delim) {
+        auto i = utf_begin(src), j = i, e = utf_end(src);
+        while (i != e) {
+            j = str_find_first_not_of(i, e, delim);
+            if (j == e)
+                break;
+            i = str_find_first_of(j, e, delim);
+            UnicornDetail::split_output(dst, std::string_view(src).substr(j.offset(), i.offset() - j.offset()));
+        }
+    }
+
     template <typename OutIter>
     void str_split_by(const U8string& src, OutIter dst, const U8string& delim) {
         if (delim.empty()) {
-            *dst++ = src;
+            UnicornDetail::split_output(dst, src);
             return;
         }
-        auto u_delim = to_utf32(delim);
-        if (delim.size() == u_delim.size()) {
+        if (std::all_of(delim.begin(), delim.end(), [] (char c) { return uint8_t(c) < 0x80; })) {
             size_t i = 0, n = src.size();
             while (i < n) {
                 auto j = src.find_first_not_of(delim, i);
@@ -697,19 +971,10 @@ namespace RS::Unicorn {
                 i = src.find_first_of(delim, j);
                 if (i == npos)
                     i = n;
-                *dst++ = src.substr(j, i - j);
+                UnicornDetail::split_output(dst, std::string_view(src).substr(j, i - j));
             }
         } else {
-            auto match = [&] (char32_t c) { return u_delim.find(c) != npos; };
-            auto range = utf_range(src);
-            auto i = range.begin(), j = i;
-            while (i != range.end()) {
-                j = std::find_if_not(i, range.end(), match);
-                if (j == range.end())
-                    break;
-                i = std::find_if(j, range.end(), match);
-                *dst++ = u_str(j, i);
-            }
+            str_split_by(src, dst, CharSet(delim));
         }
     }
 
@@ -718,7 +983,7 @@ namespace RS::Unicorn {
         auto i = utf_begin(src), j = i, e = utf_end(src);
         while (i != e) {
             j = std::find_if(i, e, char_is_line_break);
-            *dst++ = u_str(i, j);
+            UnicornDetail::split_output(dst, std::string_view(src).substr(i.offset(), j.offset() - i.offset()));
             if (j == e)
                 break;
             char32_t c = *j;
@@ -805,14 +1070,22 @@ namespace RS::Unicorn {
     // Case mapping functions
     // Defined in string-case.cpp
 
-    U8string str_uppercase(const U8string& str);
-    U8string str_lowercase(const U8string& str);
-    U8string str_titlecase(const U8string& str);
-    U8string str_casefold(const U8string& str);
+    U8string str_uppercase(std::string_view str);
+    U8string str_lowercase(std::string_view str);
+    U8string str_titlecase(std::string_view str);
+    U8string str_casefold(std::string_view str);
     void str_uppercase_in(U8string& str);
     void str_lowercase_in(U8string& str);
     void str_titlecase_in(U8string& str);
     void str_casefold_in(U8string& str);
+    void str_uppercase_to(U8string& dst, std::string_view src);
+    void str_lowercase_to(U8string& dst, std::string_view src);
+    void str_titlecase_to(U8string& dst, std::string_view src);
+    void str_casefold_to(U8string& dst, std::string_view src);
+    void str_uppercase_to(PmrString& dst, std::string_view src);
+    void str_lowercase_to(PmrString& dst, std::string_view src);
+    void str_titlecase_to(PmrString& dst, std::string_view src);
+    void str_casefold_to(PmrString& dst, std::string_view src);
 
     // Escaping and quoting functions
     // Defined in string-escape.cpp
@@ -823,6 +1096,7 @@ namespace RS::Unicorn {
         static constexpr uint32_t nostdc  = 1ul << 1;  // Do not use standard C symbols such as `\n`
         static constexpr uint32_t pcre    = 1ul << 2;  // Use `\x{...}` instead of `\u` and `\U` (implies `nonascii`)
         static constexpr uint32_t punct   = 1ul << 3;  // Escape ASCII punctuation
+        static constexpr uint32_t json    = 1ul << 4;  // Use JSON escape codes (`\uXXXX` with surrogate pairs)
 
     };
 
@@ -842,96 +1116,103 @@ namespace RS::Unicorn {
     void str_unquote_in(U8string& str, char32_t quote = U'\"');
 
     // Type conversion functions
+    // Defined in string-conversion.cpp
+
+    struct Fields {
+
+        static constexpr uint32_t merge = 1ul << 8;  // Treat whitespace delimiters as padding (skips the Utf bits)
+
+    };
 
     namespace UnicornDetail {
 
+        size_t parse_integer(const char* ptr, size_t n, int base, unsigned long long& value, bool& neg, bool& over) noexcept;
+        size_t parse_float(const char* ptr, size_t n, float& t);
+        size_t parse_float(const char* ptr, size_t n, double& t);
+        size_t parse_float(const char* ptr, size_t n, long double& t);
+        bool next_field(std::string_view src, const CharSet& delim, bool merge, size_t& pos, size_t& start, size_t& len) noexcept;
+
+        // Convert the number at the start of str, returning its length; t
+        // is left unchanged if an exception is thrown
+
         template <typename T>
-        Utf8Iterator convert_str_to_int(T& t, const Utf8Iterator& start, uint32_t flags, int base) {
-            static const U8string dec_chars = "+-0123456789";
-            static const U8string hex_chars = "+-0123456789ABCDEFabcdef";
-            const U8string& src(start.source());
-            size_t offset = start.offset();
-            if (offset >= src.size()) {
+        size_t convert_str_to_int(T& t, std::string_view str, uint32_t flags, int base) {
+            if (str.empty()) {
                 if (flags & Utf::throws)
                     throw std::invalid_argument("Invalid integer (empty string)");
                 t = T(0);
-                return utf_end(src);
-            }
-            size_t endpos = src.find_first_not_of(base == 16 ? hex_chars : dec_chars, offset);
-            if (endpos == offset) {
-                if (flags & Utf::throws)
-                    throw std::invalid_argument("Invalid integer: " + quote(to_utf8(start.str())));
-                t = T(0);
-                return start;
+                return 0;
             }
-            if (endpos == npos)
-                endpos = src.size();
-            U8string fragment(src, offset, endpos - offset);
-            Utf8Iterator stop;
-            if (std::is_signed<T>::value) {
-                static constexpr auto min_value = static_cast<long long>(std::numeric_limits<T>::min());
-                static constexpr auto max_value = static_cast<long long>(std::numeric_limits<T>::max());
-                char* endptr = nullptr;
-                errno = 0;
-                long long value = strtoll(fragment.data(), &endptr, base);
-                int err = errno;
-                size_t len = endptr - fragment.data();
-                stop = utf_iterator(src, offset + len);
-                if ((flags & Utf::throws) && stop != utf_end(src))
-                    throw std::invalid_argument("Invalid integer: " + quote(fragment));
-                if (len == 0) {
-                    if (flags & Utf::throws)
-                        throw std::invalid_argument("Invalid integer: " + quote(u_str(start, utf_end(src))));
-                    t = T(0);
-                } else if (err == ERANGE || value < min_value || value > max_value) {
+            unsigned long long value = 0;
+            bool neg = false, over = false;
+            size_t len = parse_integer(str.data(), str.size(), base, value, neg, over);
+            if ((flags & Utf::throws) && len < str.size())
+                throw std::invalid_argument("Invalid integer: " + quote(U8string(str)));
+            T result = T(0);
+            if (len == 0) {
+                // Leave the result as zero
+            } else if (std::is_signed<T>::value) {
+                static constexpr auto max_value = static_cast<unsigned long long>(std::numeric_limits<T>::max());
+                if (over || value > max_value + unsigned(neg)) {
                     if (flags & Utf::throws)
-                        throw std::range_error("Integer out of range: " + quote(fragment));
-                    t = T(value > 0 ? max_value : min_value);
+                        throw std::range_error("Integer out of range: " + quote(U8string(str.substr(0, len))));
+                    result = neg ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+                } else if (neg && value > 0) {
+                    result = T(- T(value - 1) - 1);
                 } else {
-                    t = T(value);
+                    result = T(value);
                 }
             } else {
+                // Follow strtoull(), which negates a value with a minus sign
                 static constexpr auto max_value = static_cast<unsigned long long>(std::numeric_limits<T>::max());
-                char* endptr = nullptr;
-                errno = 0;
-                unsigned long long value = strtoull(fragment.data(), &endptr, base);
-                int err = errno;
-                size_t len = endptr - fragment.data();
-                stop = utf_iterator(src, offset + len);
-                if ((flags & Utf::throws) && stop != utf_end(src))
-                        throw std::invalid_argument("Invalid integer: " + quote(u_str(start, utf_end(src))));
-                if (len == 0) {
-                    if (flags & Utf::throws)
-                        throw std::invalid_argument("Invalid integer: " + quote(fragment));
-                    t = T(0);
-                } else if (err == ERANGE || value > max_value) {
+                if (neg)
+                    value = 0ull - value;
+                if (over || value > max_value) {
                     if (flags & Utf::throws)
-                        throw std::range_error("Integer out of range: " + quote(fragment));
-                    t = T(max_value);
+                        throw std::range_error("Integer out of range: " + quote(U8string(str.substr(0, len))));
+                    result = std::numeric_limits<T>::max();
                 } else {
-                    t = T(value);
+                    result = T(value);
                 }
             }
-            return stop;
+            t = result;
+            return len;
         }
 
         template <typename T>
-        struct FloatConversionTraits {
-            static constexpr long double huge_val = HUGE_VALL;
-            static long double str_to_t(const char* p, char** ep) noexcept { return strtold(p, ep); }
-        };
-
-        template <>
-        struct FloatConversionTraits<float> {
-            static constexpr float huge_val = HUGE_VALF;
-            static float str_to_t(const char* p, char** ep) noexcept { return strtof(p, ep); }
-        };
+        Utf8Iterator convert_str_to_int(T& t, const Utf8Iterator& start, uint32_t flags, int base) {
+            const U8string& src(start.source());
+            size_t offset = start.offset();
+            if (offset >= src.size()) {
+                convert_str_to_int(t, std::string_view(), flags, base);
+                return utf_end(src);
+            }
+            size_t len = convert_str_to_int(t, std::string_view(src).substr(offset), flags, base);
+            return len == 0 ? start : utf_iterator(src, offset + len);
+        }
 
-        template <>
-        struct FloatConversionTraits<double> {
-            static constexpr double huge_val = HUGE_VAL;
-            static double str_to_t(const char* p, char** ep) noexcept { return strtod(p, ep); }
-        };
+        template <typename T>
+        size_t convert_str_to_float(T& t, std::string_view str, uint32_t flags) {
+            static constexpr T max_value = std::numeric_limits<T>::max();
+            if (str.empty()) {
+                if (flags & Utf::throws)
+                    throw std::invalid_argument("Invalid number (empty string)");
+                t = T(0);
+                return 0;
+            }
+            T value = T(0);
+            size_t len = parse_float(str.data(), str.size(), value);
+            if ((flags & Utf::throws) && len < str.size())
+                throw std::invalid_argument("Invalid number: " + quote(U8string(str)));
+            if (std::isinf(value)) {
+                if (flags & Utf::throws)
+                    throw std::range_error("Number out of range: " + quote(U8string(str.substr(0, len))));
+                t = value > T(0) ? max_value : - max_value;
+            } else {
+                t = value;
+            }
+            return len;
+        }
 
     }
 
@@ -985,44 +1266,14 @@ namespace RS::Unicorn {
 
     template <typename T>
     Utf8Iterator str_to_float(T& t, const Utf8Iterator& start, uint32_t flags = 0) {
-        using traits = UnicornDetail::FloatConversionTraits<T>;
-        static constexpr T max_value = std::numeric_limits<T>::max();
         const U8string& src(start.source());
         size_t offset = start.offset();
         if (offset >= src.size()) {
-            if (flags & Utf::throws)
-                throw std::invalid_argument("Invalid number (empty string)");
-            t = T(0);
+            UnicornDetail::convert_str_to_float(t, std::string_view(), flags);
             return utf_end(src);
         }
-        size_t endpos = src.find_first_not_of("+-.0123456789Ee", offset);
-        if (endpos == offset) {
-            if (flags & Utf::throws)
-                throw std::invalid_argument("Invalid number: " + quote(start.str()));
-            t = T(0);
-            return start;
-        }
-        if (endpos == npos)
-            endpos = src.size();
-        U8string fragment(src, offset, endpos - offset);
-        char* endptr = nullptr;
-        T value = traits::str_to_t(fragment.data(), &endptr);
-        size_t len = endptr - fragment.data();
-        auto stop = utf_iterator(src, offset + len);
-        if ((flags & Utf::throws) && stop != utf_end(src))
-            throw std::invalid_argument("Invalid number: " + quote(u_str(start, utf_end(src))));
-        if (len == 0) {
-            if (flags & Utf::throws)
-                throw std::invalid_argument("Invalid number: " + quote(fragment));
-            t = T(0);
-        } else if (value == traits::huge_val || value == - traits::huge_val) {
-            if (flags & Utf::throws)
-                throw std::range_error("Number out of range: " + quote(fragment));
-            t = value > T(0) ? max_value : - max_value;
-        } else {
-            t = value;
-        }
-        return stop;
+        size_t len = UnicornDetail::convert_str_to_float(t, std::string_view(src).substr(offset), flags);
+        return len == 0 ? start : utf_iterator(src, offset + len);
     }
 
     template <typename T>
@@ -1044,4 +1295,27 @@ namespace RS::Unicorn {
         return t;
     }
 
+    template <typename T, typename OutIter>
+    size_t str_to_ints(std::string_view src, OutIter dst, const CharSet& delim, uint32_t flags = 0) {
+        size_t count = 0, pos = 0, start = 0, len = 0;
+        T t = T(0);
+        bool merge = flags & Fields::merge;
+        for (; UnicornDetail::next_field(src, delim, merge, pos, start, len); ++count) {
+            t = T(0);
+            UnicornDetail::convert_str_to_int(t, src.substr(start, len), flags, 10);
+            *dst++ = t;
+        }
+        return count;
+    }
+
+    template <typename T, typename OutIter>
+    size_t str_to_ints(std::string_view src, OutIter dst, const U8string& delim, uint32_t flags = 0) {
+        return str_to_ints<T>(src, dst, CharSet(delim), flags);
+    }
+
+    template <typename T, typename OutIter>
+    size_t str_to_ints(std::string_view src, OutIter dst) {
+        return str_to_ints<T>(src, dst, "\t\n\v\f\r ,", Fields::merge);
+    }
+
 }
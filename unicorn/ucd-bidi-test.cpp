@@ -0,0 +1,350 @@
+#include "unicorn/ucd-tables.hpp"
+
+// Interim subset until scripts/make-tables is run against the UCD, which
+// replaces this file with the full BidiTest.txt and BidiCharacterTest.txt
+// tables. The cases are in the same formats but were not taken from those
+// files: they are generated cases whose expected results were checked
+// against ICU's ubidi (229 class cases and 100 character cases).
+
+namespace RS::Unicorn::UnicornDetail {
+
+std::array<char const*, 4> const bidi_test_array[] {
+/*1*/ {{"L","3","0","0"}},
+/*2*/ {{"L FSI","3","0 0","0 1"}},
+/*3*/ {{"ES ON","3","0 0","0 1"}},
+/*4*/ {{"CS NSM","3","0 0","0 1"}},
+/*5*/ {{"S ES","3","0 0","0 1"}},
+/*6*/ {{"WS B","3","0 0","0 1"}},
+/*7*/ {{"RLI RLI","3","0 0","0 1"}},
+/*8*/ {{"PDI NSM ET","3","0 0 0","0 1 2"}},
+/*9*/ {{"S ON S","3","0 0 0","0 1 2"}},
+/*10*/ {{"NSM LRI PDI","3","0 0 0","0 1 2"}},
+/*11*/ {{"ET ET FSI S","3","0 0 0 0","0 1 2 3"}},
+/*12*/ {{"L S ES FSI FSI","3","0 0 0 0 0","0 1 2 3 4"}},
+/*13*/ {{"ES NSM S CS L NSM L","3","0 0 0 0 0 0 0","0 1 2 3 4 5 6"}},
+/*14*/ {{"L CS WS ET RLI LRE B","3","0 0 0 0 0 x 0","0 1 2 3 4 6"}},
+/*15*/ {{"ET S CS FSI RLI NSM WS BN B","3","0 0 0 0 2 3 0 x 0","0 1 2 3 4 5 6 8"}},
+/*16*/ {{"WS NSM L NSM LRE L","3","0 0 0 0 x 2","0 1 2 3 5"}},
+/*17*/ {{"WS ES PDI R ET AN RLE FSI","2","0 0 0 1 1 2 x 0","0 1 2 5 4 3 7"}},
+/*18*/ {{"ET L EN AN L R ON","3","0 0 0 2 0 1 0","0 1 2 3 4 5 6"}},
+/*19*/ {{"WS ON S LRE","3","0 0 0 x","0 1 2"}},
+/*20*/ {{"EN NSM EN PDF NSM FSI WS ES","3","0 0 0 x 0 0 2 2","0 1 2 4 5 6 7"}},
+/*21*/ {{"CS ET ET LRO LRI R RLE ON","3","0 0 0 x 2 5 x 5","0 1 2 4 7 5"}},
+/*22*/ {{"S WS R","2","0 0 1","0 1 2"}},
+/*23*/ {{"ET RLI LRI PDI FSI AN","3","0 0 1 1 1 4","0 1 5 4 3 2"}},
+/*24*/ {{"ES RLI RLI L RLO ES","3","0 0 1 4 x 5","0 1 3 5 2"}},
+/*25*/ {{"S RLI EN","3","0 0 2","0 1 2"}},
+/*26*/ {{"PDI LRI L PDI PDF B","3","0 0 2 0 x 0","0 1 2 3 5"}},
+/*27*/ {{"CS LRI ES FSI RLO L PDF B","3","0 0 2 2 x 5 x 0","0 1 2 3 5 7"}},
+/*28*/ {{"FSI S WS PDF ON ET S B","3","0 0 2 x 2 2 0 0","0 1 2 4 5 6 7"}},
+/*29*/ {{"NSM S LRO","3","0 0 x","0 1"}},
+/*30*/ {{"PDI CS RLO","3","0 0 x","0 1"}},
+/*31*/ {{"ES ES PDF S FSI S PDI S","3","0 0 x 0 0 0 0 0","0 1 3 4 5 6 7"}},
+/*32*/ {{"ET S RLE ON","3","0 0 x 1","0 1 3"}},
+/*33*/ {{"WS WS LRO AN S RLI","3","0 0 x 2 0 0","0 1 3 4 5"}},
+/*34*/ {{"NSM ES LRE AL RLI BN AN PDI","2","0 0 x 3 2 x 4 0","0 1 3 4 6 7"}},
+/*35*/ {{"ET ET BN LRO ON S","3","0 0 x x 2 0","0 1 4 5"}},
+/*36*/ {{"CS NSM LRO LRE LRE NSM ET","3","0 0 x x x 6 6","0 1 5 6"}},
+/*37*/ {{"RLI NSM","3","0 1","0 1"}},
+/*38*/ {{"ET AL LRI PDI S BN ET WS","2","0 1 0 0 0 x 0 0","0 1 2 3 4 6 7"}},
+/*39*/ {{"EN AL RLI BN RLI PDF","2","0 1 0 x 0 x","0 1 2 4"}},
+/*40*/ {{"FSI AL R NSM","3","0 1 1 1","0 3 2 1"}},
+/*41*/ {{"RLI CS FSI NSM FSI ET","3","0 1 1 2 2 4","0 3 4 5 2 1"}},
+/*42*/ {{"RLI FSI ON ET S RLO BN","3","0 1 2 2 0 x x","0 2 3 1 4"}},
+/*43*/ {{"CS R PDF RLI CS LRO","2","0 1 x 0 1 x","0 1 3 4"}},
+/*44*/ {{"L AL LRE LRE","3","0 1 x x","0 1"}},
+/*45*/ {{"LRI NSM","3","0 2","0 1"}},
+/*46*/ {{"L AN EN S PDI NSM","3","0 2 0 0 0 0","0 1 2 3 4 5"}},
+/*47*/ {{"ES AN ON LRE RLI PDI PDI S","3","0 2 0 x 0 0 0 0","0 1 2 4 5 6 7"}},
+/*48*/ {{"LRI ES NSM","3","0 2 2","0 1 2"}},
+/*49*/ {{"FSI NSM ET LRI ON","3","0 2 2 2 4","0 1 2 3 4"}},
+/*50*/ {{"FSI ON FSI RLO ET","3","0 2 2 x 5","0 1 2 4"}},
+/*51*/ {{"FSI LRI ON PDF ES LRE ES","3","0 2 4 x 4 x 6","0 1 2 4 6"}},
+/*52*/ {{"RLI L BN AN LRE","3","0 2 x 2 x","0 1 3"}},
+/*53*/ {{"LRI AL CS B","3","0 3 2 0","0 1 2 3"}},
+/*54*/ {{"EN RLO","3","0 x","0"}},
+/*55*/ {{"S BN","3","0 x","0"}},
+/*56*/ {{"RLI LRE","3","0 x","0"}},
+/*57*/ {{"RLI RLE RLI","3","0 x 0","0 2"}},
+/*58*/ {{"ES BN FSI PDI EN ES","3","0 x 0 0 0 0","0 2 3 4 5"}},
+/*59*/ {{"FSI PDF S AL FSI","3","0 x 0 1 0","0 2 3 4"}},
+/*60*/ {{"WS PDF CS RLO L","3","0 x 0 x 1","0 2 4"}},
+/*61*/ {{"WS PDF AL WS RLI S","2","0 x 1 0 0 0","0 2 3 4 5"}},
+/*62*/ {{"S RLO ES CS LRE","3","0 x 1 1 x","0 3 2"}},
+/*63*/ {{"EN PDF R LRE EN RLO","2","0 x 1 x 2 x","0 4 2"}},
+/*64*/ {{"ES BN AN S AN EN","3","0 x 2 0 2 0","0 2 3 4 5"}},
+/*65*/ {{"LRI PDF L RLI LRI FSI ES","3","0 x 2 2 3 4 6","0 2 3 5 6 4"}},
+/*66*/ {{"RLI LRO FSI WS LRI NSM CS FSI","3","0 x 2 4 4 6 6 0","0 2 3 4 5 6 7"}},
+/*67*/ {{"RLI LRE WS RLO RLO R LRI WS","3","0 x 2 x x 5 0 0","0 2 5 6 7"}},
+/*68*/ {{"FSI LRO ON","3","0 x 4","0 2"}},
+/*69*/ {{"S LRO RLE","3","0 x x","0"}},
+/*70*/ {{"ET RLO BN LRI L RLI WS FSI","3","0 x x 1 2 0 0 0","0 4 3 5 6 7"}},
+/*71*/ {{"WS RLO LRO ON LRO ON LRO B","3","0 x x 2 x 4 x 0","0 3 5 7"}},
+/*72*/ {{"ON BN RLO RLE EN AL EN","2","0 x x x 4 3 4","0 6 5 4"}},
+/*73*/ {{"R L","2","1 0","0 1"}},
+/*74*/ {{"R CS PDI","2","1 0 0","0 1 2"}},
+/*75*/ {{"R L EN WS CS AL LRI","2","1 0 0 0 0 1 0","0 1 2 3 4 5 6"}},
+/*76*/ {{"AL S AL CS ET LRE AN ES","2","1 0 1 0 0 x 4 2","0 1 2 3 4 6 7"}},
+/*77*/ {{"AL L BN","2","1 0 x","0 1"}},
+/*78*/ {{"AL LRI PDF RLE","2","1 0 x x","0 1"}},
+/*79*/ {{"AL ET","5","1 1","1 0"}},
+/*80*/ {{"ET R","5","1 1","1 0"}},
+/*81*/ {{"CS FSI","4","1 1","1 0"}},
+/*82*/ {{"S ON","4","1 1","1 0"}},
+/*83*/ {{"ON NSM","4","1 1","1 0"}},
+/*84*/ {{"FSI LRI","4","1 1","1 0"}},
+/*85*/ {{"R NSM FSI R LRI","2","1 1 0 1 0","1 0 2 3 4"}},
+/*86*/ {{"S PDI R","5","1 1 1","2 1 0"}},
+/*87*/ {{"CS CS AL","5","1 1 1","2 1 0"}},
+/*88*/ {{"R ES RLI FSI","5","1 1 1 1","3 2 1 0"}},
+/*89*/ {{"AL ET AL AL FSI ON PDI B","2","1 1 1 1 0 2 0 0","3 2 1 0 4 5 6 7"}},
+/*90*/ {{"ET NSM WS ET FSI PDI AL","5","1 1 1 1 1 1 1","6 5 4 3 2 1 0"}},
+/*91*/ {{"AL ON FSI PDI RLI NSM","5","1 1 1 1 1 3","5 4 3 2 1 0"}},
+/*92*/ {{"PDI WS S WS L BN BN","4","1 1 1 1 2 x x","4 3 2 1 0"}},
+/*93*/ {{"ET AL PDI ET RLE WS","5","1 1 1 1 x 1","5 3 2 1 0"}},
+/*94*/ {{"ES WS ET CS LRE RLE BN LRE B","4","1 1 1 1 x x x x 1","8 3 2 1 0"}},
+/*95*/ {{"ES AL NSM L NSM FSI PDI LRE","5","1 1 1 2 2 1 1 x","6 5 3 4 2 1 0"}},
+/*96*/ {{"ON R RLI LRI CS ES LRI","5","1 1 1 3 4 4 1","6 4 5 3 2 1 0"}},
+/*97*/ {{"CS CS CS LRO LRI","4","1 1 1 x 1","4 2 1 0"}},
+/*98*/ {{"ET LRI PDI LRE FSI ET EN","4","1 1 1 x 2 4 4","4 5 6 2 1 0"}},
+/*99*/ {{"WS NSM PDI BN LRO WS NSM","4","1 1 1 x x 2 2","5 6 2 1 0"}},
+/*100*/ {{"PDI CS EN","4","1 1 2","2 1 0"}},
+/*101*/ {{"ES FSI EN PDI AN RLI B","4","1 1 2 1 2 1 1","6 5 4 3 2 1 0"}},
+/*102*/ {{"CS CS L NSM ES","4","1 1 2 2 1","4 2 3 1 0"}},
+/*103*/ {{"LRI S RLI AL R WS AN BN","4","1 1 2 3 3 3 4 x","2 6 5 4 3 1 0"}},
+/*104*/ {{"LRI S ET BN ES AL PDF ES","4","1 1 2 x 2 3 x 2","2 4 5 7 1 0"}},
+/*105*/ {{"AL RLI AL R NSM LRI AN ON","5","1 1 3 3 3 3 6 4","6 7 5 4 3 2 1 0"}},
+/*106*/ {{"R RLI CS LRE BN","5","1 1 3 x x","2 1 0"}},
+/*107*/ {{"S LRI PDF","4","1 1 x","1 0"}},
+/*108*/ {{"ET FSI PDF","4","1 1 x","1 0"}},
+/*109*/ {{"PDI S BN WS","4","1 1 x 1","3 1 0"}},
+/*110*/ {{"ON AL BN LRI WS ES PDI ES","5","1 1 x 1 2 2 1 1","7 6 4 5 3 1 0"}},
+/*111*/ {{"R FSI PDF CS S RLI L","5","1 1 x 2 1 2 4","5 6 4 3 1 0"}},
+/*112*/ {{"PDI S RLO ON RLI","4","1 1 x 3 1","4 3 1 0"}},
+/*113*/ {{"S ET LRE AN RLE RLE","4","1 1 x 4 x x","3 1 0"}},
+/*114*/ {{"PDI ET RLO BN AL PDI ET","5","1 1 x x 3 3 3","6 5 4 1 0"}},
+/*115*/ {{"CS AL RLO RLE RLE ES","5","1 1 x x x 7","5 1 0"}},
+/*116*/ {{"ON L","4","1 2","1 0"}},
+/*117*/ {{"R AN ES ET WS LRE FSI NSM","2","1 2 0 0 0 x 2 4","1 0 2 3 4 6 7"}},
+/*118*/ {{"WS AN LRI","4","1 2 1","2 1 0"}},
+/*119*/ {{"R EN PDI FSI PDF","5","1 2 1 1 x","3 2 1 0"}},
+/*120*/ {{"ES EN FSI LRE B","4","1 2 1 x 1","4 2 1 0"}},
+/*121*/ {{"S AN AN","4","1 2 2","1 2 0"}},
+/*122*/ {{"LRI ET L ES","4","1 2 2 2","1 2 3 0"}},
+/*123*/ {{"LRI EN ES AL LRO LRE CS","4","1 2 2 3 x x 6","1 2 6 3 0"}},
+/*124*/ {{"WS EN AN LRE LRE RLI LRI FSI","4","1 2 2 x x 1 1 1","7 6 5 1 2 0"}},
+/*125*/ {{"FSI LRI ON PDF ES LRE ES","4","1 2 4 x 4 x 6","1 2 4 6 0"}},
+/*126*/ {{"ON ET BN EN ET AN ON R","5","1 2 x 2 2 2 1 1","7 6 1 3 4 5 0"}},
+/*127*/ {{"ON AN RLO BN AL CS","5","1 2 x x 3 3","1 5 4 0"}},
+/*128*/ {{"FSI AL AL","4","1 3 3","2 1 0"}},
+/*129*/ {{"FSI R FSI ES ET LRE","4","1 3 3 4 4 x","3 4 2 1 0"}},
+/*130*/ {{"FSI R RLE","4","1 3 x","1 0"}},
+/*131*/ {{"FSI AN FSI","4","1 4 1","2 1 0"}},
+/*132*/ {{"RLI L BN AN LRE","4","1 4 x 4 x","1 3 0"}},
+/*133*/ {{"ET PDF","4","1 x","0"}},
+/*134*/ {{"WS LRO","4","1 x","0"}},
+/*135*/ {{"FSI RLO","4","1 x","0"}},
+/*136*/ {{"WS PDF S","4","1 x 1","2 0"}},
+/*137*/ {{"ON BN NSM ES FSI","4","1 x 1 1 1","4 3 2 0"}},
+/*138*/ {{"AL PDF LRI S NSM AN AN","5","1 x 1 1 2 4 4","4 5 6 3 2 0"}},
+/*139*/ {{"S BN RLI R PDI AN","4","1 x 1 3 1 2","5 4 3 2 0"}},
+/*140*/ {{"ET BN ES PDF PDF","4","1 x 1 x x","2 0"}},
+/*141*/ {{"ES LRO L ON","4","1 x 2 2","2 3 0"}},
+/*142*/ {{"WS LRO ON LRI AN CS","4","1 x 2 2 6 4","2 3 4 5 0"}},
+/*143*/ {{"PDI LRO EN RLO","4","1 x 2 x","2 0"}},
+/*144*/ {{"ES RLE ES","4","1 x 3","2 0"}},
+/*145*/ {{"R RLO AN NSM PDI ON LRO S","5","1 x 3 3 3 3 x 1","7 5 4 3 2 0"}},
+/*146*/ {{"R RLE CS AN LRE ES BN","5","1 x 3 4 x 4 x","3 5 2 0"}},
+/*147*/ {{"FSI LRE L S RLI LRI LRI","4","1 x 4 1 1 1 1","6 5 4 3 2 0"}},
+/*148*/ {{"RLI RLE ET RLI R PDF BN","4","1 x 5 5 7 x x","4 3 2 0"}},
+/*149*/ {{"RLI RLE RLE","4","1 x x","0"}},
+/*150*/ {{"NSM BN BN NSM RLO","4","1 x x 1 x","3 0"}},
+/*151*/ {{"S LRO RLE ET ON B","4","1 x x 3 3 1","5 4 3 0"}},
+/*152*/ {{"ON RLE RLE ET","4","1 x x 5","3 0"}},
+/*153*/ {{"AL LRO LRE LRE R L NSM","7","1 x x x 7 6 6","4 5 6 0"}},
+/*154*/ {{"AN PDI","3","2 0","0 1"}},
+/*155*/ {{"AN RLI LRI AL","3","2 0 1 3","0 1 3 2"}},
+/*156*/ {{"AN ON RLE LRE AN NSM R","2","2 0 x x 4 4 3","0 1 6 4 5"}},
+/*157*/ {{"EN PDI","4","2 1","1 0"}},
+/*158*/ {{"AN ON RLI","4","2 1 1","2 1 0"}},
+/*159*/ {{"L WS CS WS ON LRE","4","2 1 1 1 1 x","4 3 2 1 0"}},
+/*160*/ {{"AN ON R EN WS PDI ES NSM","5","2 1 1 2 1 1 1 1","7 6 5 4 3 2 1 0"}},
+/*161*/ {{"AN AL ET RLO R LRI S","2","2 1 1 x 1 0 0","4 2 1 0 5 6"}},
+/*162*/ {{"L LRI EN PDI S RLE FSI ET","4","2 1 2 1 1 x 3 4","7 6 4 3 2 1 0"}},
+/*163*/ {{"L RLI ET ES","4","2 1 3 3","3 2 1 0"}},
+/*164*/ {{"AN ES PDF WS B","4","2 1 x 1 1","4 3 1 0"}},
+/*165*/ {{"L FSI LRO WS NSM","4","2 1 x 4 4","3 4 1 0"}},
+/*166*/ {{"EN EN","4","2 2","0 1"}},
+/*167*/ {{"L NSM ES LRI WS WS CS","4","2 2 1 1 2 2 2","4 5 6 3 2 0 1"}},
+/*168*/ {{"EN EN L ET LRI FSI B","4","2 2 2 1 1 1 1","6 5 4 3 0 1 2"}},
+/*169*/ {{"EN AN PDF ET FSI LRE NSM","4","2 2 x 1 1 x 4","6 4 3 0 1"}},
+/*170*/ {{"L RLO","4","2 x","0"}},
+/*171*/ {{"AN PDF LRI","4","2 x 1","2 0"}},
+/*172*/ {{"AN BN FSI BN PDF RLO CS WS B","4","2 x 1 x x x 3 1 1","8 7 6 2 0"}},
+/*173*/ {{"EN LRO PDI LRE EN RLI CS","4","2 x 2 x 4 4 5","0 2 4 5 6"}},
+/*174*/ {{"AN LRO BN RLI RLI LRI LRO FSI","3","2 x x 0 0 0 x 0","0 3 4 5 7"}},
+/*175*/ {{"PDF","7","x",""}},
+/*176*/ {{"RLE WS","3","x 0","1"}},
+/*177*/ {{"LRO PDI","3","x 0","1"}},
+/*178*/ {{"BN L L","3","x 0 0","1 2"}},
+/*179*/ {{"PDF L PDI RLI ES ON B","3","x 0 0 0 1 1 0","1 2 3 5 4 6"}},
+/*180*/ {{"BN ON ON LRE","3","x 0 0 x","1 2"}},
+/*181*/ {{"BN ON R RLE ET RLI WS","2","x 0 1 x 1 0 0","1 4 2 5 6"}},
+/*182*/ {{"BN FSI ON PDF NSM RLE B","3","x 0 2 x 2 x 0","1 2 4 6"}},
+/*183*/ {{"PDF LRI PDF PDI PDI ON B","3","x 0 x 0 0 0 0","1 3 4 5 6"}},
+/*184*/ {{"LRE S RLO LRE RLI RLI","3","x 0 x x 0 0","1 4 5"}},
+/*185*/ {{"LRE FSI","4","x 1","1"}},
+/*186*/ {{"PDF ON","4","x 1","1"}},
+/*187*/ {{"RLO LRI","4","x 1","1"}},
+/*188*/ {{"RLE ES S RLE ET WS ES","3","x 1 0 x 3 3 3","1 2 6 5 4"}},
+/*189*/ {{"RLO R R S LRI BN ON PDF","2","x 1 1 0 1 x 2 x","2 1 3 6 4"}},
+/*190*/ {{"RLE ES NSM CS ON EN PDF LRE","3","x 1 1 1 1 2 x x","5 4 3 2 1"}},
+/*191*/ {{"BN ET AL NSM BN L","5","x 1 1 1 x 2","5 3 2 1"}},
+/*192*/ {{"RLE AL FSI EN ON R","2","x 1 1 4 3 3","5 4 3 2 1"}},
+/*193*/ {{"LRE PDI S PDF BN R AL","5","x 1 1 x x 1 1","6 5 2 1"}},
+/*194*/ {{"RLO FSI ET ET","3","x 1 2 2","2 3 1"}},
+/*195*/ {{"PDF WS EN LRO NSM L FSI","4","x 1 2 x 2 2 1","6 2 4 5 1"}},
+/*196*/ {{"PDF LRI AN PDI PDI L R","4","x 1 4 1 1 2 1","6 5 4 3 2 1"}},
+/*197*/ {{"LRO WS LRO FSI WS","4","x 1 x 1 1","4 3 1"}},
+/*198*/ {{"RLE ON RLO NSM ET B","3","x 1 x 3 3 0","4 3 1 5"}},
+/*199*/ {{"RLE WS RLO BN ON PDF LRE CS","3","x 1 x x 3 x x 2","4 7 1"}},
+/*200*/ {{"LRO R","7","x 2","1"}},
+/*201*/ {{"PDF EN WS","4","x 2 1","2 1"}},
+/*202*/ {{"LRE L S RLE ET","4","x 2 1 x 3","4 2 1"}},
+/*203*/ {{"LRO ES AN PDI","4","x 2 2 1","3 1 2"}},
+/*204*/ {{"LRO ON ET EN PDF B","3","x 2 2 2 x 0","1 2 3 5"}},
+/*205*/ {{"LRO PDI AN PDF L EN","3","x 2 2 x 0 0","1 2 4 5"}},
+/*206*/ {{"LRO FSI ES PDI NSM NSM FSI PDF","4","x 2 4 2 2 2 1 x","6 1 2 3 4 5"}},
+/*207*/ {{"LRO NSM PDF FSI FSI","4","x 2 x 1 1","4 3 1"}},
+/*208*/ {{"LRO EN LRE NSM WS PDF","4","x 2 x 4 1 x","4 1 3"}},
+/*209*/ {{"RLE ES","4","x 3","1"}},
+/*210*/ {{"RLE ET S BN WS","4","x 3 1 x 1","4 2 1"}},
+/*211*/ {{"LRE R CS ON R FSI ET PDF","7","x 3 3 3 3 2 4 x","4 3 2 1 5 6"}},
+/*212*/ {{"RLO L LRI AL WS B","4","x 3 3 5 1 1","5 4 3 2 1"}},
+/*213*/ {{"RLO FSI EN L CS","4","x 3 4 4 4","2 3 4 1"}},
+/*214*/ {{"RLE FSI RLO EN PDI EN","4","x 3 x 5 3 4","5 4 3 1"}},
+/*215*/ {{"LRE AN LRI PDF CS NSM FSI","4","x 4 2 x 4 4 1","6 1 2 4 5"}},
+/*216*/ {{"BN PDF","7","x x",""}},
+/*217*/ {{"LRO LRO","7","x x",""}},
+/*218*/ {{"LRE PDF ET LRI CS AL AL","3","x x 0 0 2 3 3","2 3 4 6 5"}},
+/*219*/ {{"RLO PDF R LRI PDF WS CS","2","x x 1 0 x 2 2","2 3 5 6"}},
+/*220*/ {{"BN BN FSI ON LRO LRO LRE","4","x x 1 2 x x x","3 2"}},
+/*221*/ {{"BN RLE L ON RLI WS","3","x x 2 1 0 0","3 2 4 5"}},
+/*222*/ {{"BN LRE RLI EN BN PDI FSI","3","x x 2 4 x 0 0","2 3 5 6"}},
+/*223*/ {{"RLE BN LRI ET","4","x x 3 4","3 2"}},
+/*224*/ {{"LRE LRO CS","7","x x 4","2"}},
+/*225*/ {{"RLE LRE EN AN NSM L B","4","x x 4 6 6 4 1","6 2 3 4 5"}},
+/*226*/ {{"LRE RLO BN","7","x x x",""}},
+/*227*/ {{"RLO LRO RLO AN NSM","3","x x x 3 3","4 3"}},
+/*228*/ {{"RLO RLO LRE CS ON FSI AL B","4","x x x 6 6 6 7 1","7 3 4 5 6"}},
+/*229*/ {{"PDF RLE BN RLO RLO BN","7","x x x x x x",""}},
+};
+
+const Irange<std::array<char const*, 4> const*> bidi_test_table {std::begin(bidi_test_array), std::end(bidi_test_array)};
+
+std::array<char const*, 5> const bidi_character_test_array[] {
+/*1*/ {{"0660 05D0 0024 202B 002D 2067 05D1 202D 002C 2066 0300 3008 007B","0","0","2 1 1 x 1 1 3 x 4 4 6 6 6","8 9 10 11 12 6 5 4 2 1 0"}},
+/*2*/ {{"0009 0031 0032 2069 2067 202C 2069","0","0","0 0 0 0 0 x 0","0 1 2 3 4 6"}},
+/*3*/ {{"003A 0021 0062 202D 202E 3008","0","0","0 0 0 x x 3","0 1 2 5"}},
+/*4*/ {{"0627 2068 003A","0","0","1 0 2","0 1 2"}},
+/*5*/ {{"2068 0627","2","0","0 1","0 1"}},
+/*6*/ {{"0029 202B 202A 005D","0","0","0 x x 2","0 3"}},
+/*7*/ {{"3008 202C 003A 0021 202E 0025 0024 003A 0061 0024 2066 3009 3008 0061","1","1","1 x 1 1 x 3 3 3 3 3 3 4 4 4","11 12 13 10 9 8 7 6 5 3 2 0"}},
+/*8*/ {{"05D0 202C 2068 05D0 002D 202E 007D 003A 007B","1","1","1 x 1 3 3 x 5 5 5","8 7 6 4 3 2 0"}},
+/*9*/ {{"0062 2068 2067 0062 0029 002B 0025 007D 2069","0","0","0 0 2 4 3 3 3 3 0","0 1 2 7 6 5 4 3 8"}},
+/*10*/ {{"007B 3008 0021","1","1","1 1 1","2 1 0"}},
+/*11*/ {{"0062 0031 002E 3009 002B 2067 0029 0627 0025 007B 0009 002D 2068 3008 007B","1","1","2 2 1 1 1 1 3 3 3 3 1 3 3 4 4","13 14 12 11 10 9 8 7 6 5 4 3 2 0 1"}},
+/*12*/ {{"002E 002C 202C","2","0","0 0 x","0 1"}},
+/*13*/ {{"002C 00AD 202A 007D 3008 0025 0025 0301 0020 202C 202A","1","1","1 x x 2 2 2 2 2 1 x x","8 3 4 5 6 7 0"}},
+/*14*/ {{"3008 202A 003A 202B 007D 202D 0031 0028 0020 0660 202D 0062 0021 007B","2","0","0 x 2 x 3 x 4 4 4 4 x 6 6 6","0 2 6 7 8 9 11 12 13 4"}},
+/*15*/ {{"0021 0020","0","0","0 0","0 1"}},
+/*16*/ {{"2069 2069 202E 005D 002D 2066 003A 3009 0032 0660 005B","1","1","1 1 x 3 3 3 4 4 4 6 4","6 7 8 9 10 5 4 3 1 0"}},
+/*17*/ {{"0029 003A 202E 2066 002E 0627 003A 202A 005D","1","1","1 1 x 3 4 5 4 x 6","4 5 6 8 3 1 0"}},
+/*18*/ {{"202C 0029 007D 05D1 0021 007B 0009 002D 005D","1","1","x 1 1 1 1 1 1 1 1","8 7 6 5 4 3 2 1"}},
+/*19*/ {{"0024 202C 007D 002D 0300 0300","0","0","0 x 0 0 0 0","0 2 3 4 5"}},
+/*20*/ {{"202B 3009 2066 002E 0032 002D 0301 202A 0062 0031 05D1 2066 0024 002D","2","0","x 1 1 2 2 2 2 x 4 4 5 4 6 6","3 4 5 6 8 9 10 11 12 13 2 1"}},
+/*21*/ {{"002E 005B 202B 202C 002B 0009 007B 002E","0","0","0 0 x x 0 0 0 0","0 1 4 5 6 7"}},
+/*22*/ {{"0024 0032 002C 202C","1","1","2 2 1 x","2 0 1"}},
+/*23*/ {{"0020 0627 0061 3008 005D 0031 0301 0627 0029 005D 005D 3009 202D","1","1","1 1 2 1 1 2 2 1 1 1 1 1 x","11 10 9 8 7 5 6 4 3 2 1 0"}},
+/*24*/ {{"0627 005B 0020 3009 0024 005B 0029 002D 005D 0021 003A 0020 0032 05D1","2","1","1 1 1 1 1 1 1 1 1 1 1 1 2 1","13 12 11 10 9 8 7 6 5 4 3 2 1 0"}},
+/*25*/ {{"05D0 3008 0061 002B 0032 2069 0061 202C 2068 0062 2066 0021","1","1","1 1 2 2 2 2 2 x 1 2 2 4","9 10 11 8 2 3 4 5 6 1 0"}},
+/*26*/ {{"3009 0024 2068 2067","2","0","0 0 0 0","0 1 2 3"}},
+/*27*/ {{"0020 3008 0029 0024 0032 2068","1","1","1 1 1 2 2 1","5 3 4 2 1 0"}},
+/*28*/ {{"002E 202D 0024 2068 05D0 2066 007D 3008 0025 002C","2","0","0 x 2 2 3 3 4 4 4 4","0 2 3 6 7 8 9 5 4"}},
+/*29*/ {{"0062 202B 003A 007B 2068 2067 202D 0028 202B 002B 002C","2","0","0 x 1 1 1 2 x 4 x 5 5","0 5 7 10 9 4 3 2"}},
+/*30*/ {{"0627 003A 3008 0032 007B 05D1 0300 2067 2066 0031 005D 0021 0029","0","0","1 1 1 2 1 1 1 0 1 2 2 2 2","6 5 4 3 2 1 0 7 9 10 11 12 8"}},
+/*31*/ {{"0021 0300 002D 0009 0031 0025 2069 002C 007D 05D1 0020 0020 2069 0024 0025","1","1","1 1 1 1 2 2 1 1 1 1 1 1 1 1 1","14 13 12 11 10 9 8 7 6 4 5 3 2 1 0"}},
+/*32*/ {{"2066 005D 0028","2","0","0 2 2","0 1 2"}},
+/*33*/ {{"0025 202B 002C 202C 0021 0009","0","0","0 x 1 x 0 0","0 2 4 5"}},
+/*34*/ {{"202A 0024 0031 0062 0021 0009 0020 2067 005B 005B 0660","1","1","x 2 2 2 2 1 2 2 3 3 4","6 7 10 9 8 5 1 2 3 4"}},
+/*35*/ {{"0029 0020 003A 007D 2069","1","1","1 1 1 1 1","4 3 2 1 0"}},
+/*36*/ {{"0021 202E 202B 0025 2069 202B 05D0 0028 2066 0300 05D1 0024","2","1","1 x x 5 5 x 7 7 7 8 9 8","9 10 11 8 7 6 4 3 0"}},
+/*37*/ {{"202D 007B 2067 3008 0062 0031","0","0","x 2 2 3 4 4","1 2 4 5 3"}},
+/*38*/ {{"0301 05D1 0061 0062 202D 0028 0020 002C 007D 202A 0061 0627 0028 0061","2","1","1 1 2 2 x 2 2 2 2 x 4 5 4 4","2 3 5 6 7 8 10 11 12 13 1 0"}},
+/*39*/ {{"2068 002B 202E","0","0","0 2 x","0 1"}},
+/*40*/ {{"202B 00AD 3008 3009 007B 2067 202E","0","0","x x 1 1 1 0 x","4 3 2 5"}},
+/*41*/ {{"0009 002C 00AD 002E 0032 202A 0061 202A 202D 202B","2","0","0 0 x 0 0 x 2 x x x","0 1 3 4 6"}},
+/*42*/ {{"0021 002D 0032 2068 0061 0009 0032 3009 202E 0061","2","0","0 0 0 0 2 0 2 2 x 3","0 1 2 3 4 5 6 7 9"}},
+/*43*/ {{"05D0 0028 007B 2066 0009 002E 0301 2067 202A 0031 202A 0029","2","1","1 1 1 1 1 2 2 2 x 4 x 6","5 6 7 9 11 4 3 2 1 0"}},
+/*44*/ {{"007D 003A 0029 0009 0009 007D 005D 2069 0009 0009 05D0 002B","0","0","0 0 0 0 0 0 0 0 0 0 1 0","0 1 2 3 4 5 6 7 8 9 10 11"}},
+/*45*/ {{"0660 003A 0020 2068 0061 0660 0031 3008 2067 202C","1","1","2 1 1 1 2 4 2 2 1 x","8 4 5 6 7 3 2 1 0"}},
+/*46*/ {{"0301 0061","1","1","1 2","1 0"}},
+/*47*/ {{"005D 0028 003A 002E 0028 0061 05D1 0031 2066 0020 002D 3008 002D 0660 003A","2","0","0 0 0 0 0 0 1 2 0 2 2 2 2 4 2","0 1 2 3 4 5 7 6 8 9 10 11 12 13 14"}},
+/*48*/ {{"0062 202E 0020 0025 0028 0029 2069","0","0","0 x 1 1 1 1 0","0 5 4 3 2 6"}},
+/*49*/ {{"2069 0024 0029 202D 0020 3009 005B 0025 0061 3008 0020","0","0","0 0 0 x 2 2 2 2 2 2 0","0 1 2 4 5 6 7 8 9 10"}},
+/*50*/ {{"3009 3008 202C 0028 007B","2","0","0 0 x 0 0","0 1 3 4"}},
+/*51*/ {{"007D 0032 0024 3008 002C 0020 00AD 0032 202B","1","1","1 2 2 1 1 1 x 2 x","7 5 4 3 1 2 0"}},
+/*52*/ {{"0029 002B 0062 0062 2067 003A","1","1","1 1 2 2 1 3","5 4 2 3 1 0"}},
+/*53*/ {{"3008 0028 3008 0031 002C 005B","2","0","0 0 0 0 0 0","0 1 2 3 4 5"}},
+/*54*/ {{"202C 2069 0300 2066 2066 0024 202D 002C 3008 0029","2","0","x 0 0 0 2 4 x 6 6 6","1 2 3 4 5 7 8 9"}},
+/*55*/ {{"2066 0021 2068 0032 007D 0028","2","0","0 2 2 4 4 4","0 1 2 3 4 5"}},
+/*56*/ {{"202D 0300 0029 0627 202D 05D0 0025 0009 202B 002C 05D1 2068 05D0 0301","2","1","x 2 2 2 x 4 4 1 x 5 5 5 7 7","13 12 11 10 9 7 1 2 3 5 6"}},
+/*57*/ {{"05D1 0009 0300 202B","2","1","1 1 1 x","2 1 0"}},
+/*58*/ {{"202C 003A 2068 0024 0009 3008 002D 002B 0032 2069 202C 0061 202D","1","1","x 1 1 2 1 2 2 2 2 1 x 2 x","11 9 5 6 7 8 4 3 2 1"}},
+/*59*/ {{"002E 0028","0","0","0 0","0 1"}},
+/*60*/ {{"0300 0301 202E 003A 0300 0031 0301 00AD 0660 002E 0025 0028 0020 0062 0627","1","1","1 1 x 3 3 3 3 x 3 3 3 3 3 3 3","14 13 12 11 10 9 8 6 5 4 3 1 0"}},
+/*61*/ {{"00AD 2069 0029 0025 0028 002E 0627 0031 05D1 002B 0028 007B 0024 2069 0029","2","1","x 1 1 1 1 1 1 2 1 1 1 1 1 1 1","14 13 12 11 10 9 8 7 6 5 4 3 2 1"}},
+/*62*/ {{"0021 202A 0300 202C 005B 00AD 0660 007B 05D0 0062 0300 202B","1","1","1 x 2 x 1 x 2 1 1 2 2 x","9 10 8 7 6 4 2 0"}},
+/*63*/ {{"0660 2068 05D1 2069 3009","1","1","2 1 3 1 1","4 3 2 1 0"}},
+/*64*/ {{"202B 2068 0009 0660 0062 0009 002D 0020 05D0 0062 2066 005B 0031 0020 002B","0","0","x 0 0 4 2 0 2 2 3 2 2 4 4 4 4","1 2 3 4 5 6 7 8 9 10 11 12 13 14"}},
+/*65*/ {{"202E 007D","1","1","x 3","1"}},
+/*66*/ {{"002B 3009 0028 2066 002B 005D 202A","2","0","0 0 0 0 2 2 x","0 1 2 3 4 5"}},
+/*67*/ {{"202D 00AD 003A 2067 2068 0021 202D 0009","1","1","x x 2 2 3 4 x 1","7 2 3 5 4"}},
+/*68*/ {{"2068 0029 0031 05D0 2067 202D 0024 0062 0031","0","0","0 1 2 1 1 x 4 4 4","0 6 7 8 4 3 2 1"}},
+/*69*/ {{"2066 0032 007B 002B 0031 0029","1","1","1 2 2 2 2 2","1 2 3 4 5 0"}},
+/*70*/ {{"0024 00AD 0031 0301 2067 0061","1","1","2 x 2 2 1 4","5 4 0 2 3"}},
+/*71*/ {{"003A 0024 0020 2069 202B 3009","1","1","1 1 1 1 x 3","5 3 2 1 0"}},
+/*72*/ {{"0660 0009 202A 0020 2068 2066 202B 202E 0061","2","0","2 0 x 2 2 4 x x 9","0 1 3 4 5 8"}},
+/*73*/ {{"0032 005B","0","0","0 0","0 1"}},
+/*74*/ {{"002D 05D1 202C 2068 007B 002D 2069 202E","1","1","1 1 x 1 2 2 1 x","6 4 5 3 1 0"}},
+/*75*/ {{"05D0 007B 202C 0028 007B 007D 2068 00AD","2","1","1 1 x 1 1 1 1 x","6 5 4 3 1 0"}},
+/*76*/ {{"202B 2066 202A","1","1","x 1 x","1"}},
+/*77*/ {{"202E 003A 2066 005B 00AD 0028 0029","2","0","x 1 1 2 x 2 2","3 5 6 2 1"}},
+/*78*/ {{"05D0 00AD 003A 0009","1","1","1 x 1 1","3 2 0"}},
+/*79*/ {{"0025 0031","0","0","0 0","0 1"}},
+/*80*/ {{"202A 002D 002E 0028 202D 0028","2","0","x 2 2 2 x 4","1 2 3 5"}},
+/*81*/ {{"005D 0009","0","0","0 0","0 1"}},
+/*82*/ {{"3008 3009 202E 202C 0031 3008 005B 0025 002C 05D0","1","1","1 1 x x 2 1 1 1 1 1","9 8 7 6 5 4 1 0"}},
+/*83*/ {{"0032 007D 0028 0020 0301 2069 0028 0028 002B 0025 202E 0062 0627","1","1","2 1 1 1 1 1 1 1 1 1 x 3 3","12 11 9 8 7 6 5 4 3 2 1 0"}},
+/*84*/ {{"007D 3008 0029 005D 0062 2069 0031","0","0","0 0 0 0 0 0 0","0 1 2 3 4 5 6"}},
+/*85*/ {{"0028 0031 202A 0061 202D 002D 0660 003A 0028 0021","1","1","1 2 x 2 x 4 4 4 4 4","1 3 5 6 7 8 9 0"}},
+/*86*/ {{"202C 002E 0024 0029 005B 002B 0021 0032 0032 007D","0","0","x 0 0 0 0 0 0 0 0 0","1 2 3 4 5 6 7 8 9"}},
+/*87*/ {{"202E 0024 202A 0021 202B 202C 2066 002D 007D 0009 2069","1","1","x 3 x 4 x x 4 6 6 1 1","10 9 3 6 7 8 1"}},
+/*88*/ {{"2068 2066 0021 002E","2","0","0 2 4 4","0 1 2 3"}},
+/*89*/ {{"202C 2066 202E","2","0","x 0 x","1"}},
+/*90*/ {{"202B 0301 002C 2067","1","1","x 3 3 1","3 2 1"}},
+/*91*/ {{"002E 0021 002C 202C","1","1","1 1 1 x","2 1 0"}},
+/*92*/ {{"0032 202D 2068 002E 0032 002B 0024 202B 0020 0025 003A 2068","2","0","0 x 2 4 4 4 4 x 5 5 5 0","0 2 3 4 5 6 10 9 8 11"}},
+/*93*/ {{"003A 202D 202D 0300 0627 002E 003A","2","1","1 x x 4 4 4 4","3 4 5 6 0"}},
+/*94*/ {{"0024 2066 3008 3009 005B 05D1 0627 0300 202E 202C 002E 0024 202E 202A","2","0","0 0 2 2 2 3 3 3 x x 2 2 x x","0 1 2 3 4 7 6 5 10 11"}},
+/*95*/ {{"2067 0009 007D 202D 002C 007D 0029 0028 05D1 0032 0028","2","0","0 0 1 x 2 2 2 2 2 2 2","0 1 4 5 6 7 8 9 10 2"}},
+/*96*/ {{"0029 2066 0627","2","0","0 0 3","0 1 2"}},
+/*97*/ {{"002B 202C 202D 05D0 0009 005D 2068 002C","0","0","0 x x 2 0 2 2 4","0 3 4 5 6 7"}},
+/*98*/ {{"003A 2069 0301 3008 0062","1","1","1 1 1 1 2","4 3 2 1 0"}},
+/*99*/ {{"007D 0031 202C 202A 0062 0029 0024 3008","0","0","0 0 x x 2 2 2 2","0 1 4 5 6 7"}},
+/*100*/ {{"0028 0029","1","1","1 1","1 0"}},
+};
+
+const Irange<std::array<char const*, 5> const*> bidi_character_test_table {std::begin(bidi_character_test_array), std::end(bidi_character_test_array)};
+
+}
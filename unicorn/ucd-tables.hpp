@@ -4,6 +4,7 @@
 #pragma once
 
 #include "rs-core/common.hpp"
+#include "unicorn/core.hpp"
 #include "unicorn/property-values.hpp"
 #include <algorithm>
 #include <array>
@@ -37,10 +38,16 @@ namespace RS::Unicorn::UnicornDetail {
         T second;
     };
 
+    struct NameChunk {
+        char32_t code;    // First code point in chunk
+        uint32_t offset;  // Offset of first entry in phrasebook
+    };
+
     // Lookup functions
 
     template <typename T, typename K, typename V>
     V table_lookup(Irange<const T*> table, K key, V def) noexcept {
+        UNICORN_STAT(table_lookups, 1);
         T t;
         t.key = key;
         auto it = std::lower_bound(table.begin(), table.end(), t);
@@ -72,6 +79,7 @@ namespace RS::Unicorn::UnicornDetail {
 
     template <typename K>
     bool sparse_set_lookup(Irange<const KeyValue<K, K>*> table, K key) noexcept {
+        UNICORN_STAT(table_lookups, 1);
         if (table.begin() == table.end())
             return false;
         KeyValue<K, K> t;
@@ -86,6 +94,7 @@ namespace RS::Unicorn::UnicornDetail {
     template <typename T, typename K>
     typename T::mapped_type sparse_table_lookup(Irange<const T*> table, K key) noexcept {
         using V = typename T::mapped_type;
+        UNICORN_STAT(table_lookups, 1);
         if (table.begin() == table.end())
             return V();
         T t {key, V()};
@@ -95,9 +104,16 @@ namespace RS::Unicorn::UnicornDetail {
         return it->value;
     }
 
+    inline uint8_t two_stage_lookup(Irange<const uint16_t*> stage1, Irange<const uint8_t*> stage2, char32_t key) noexcept {
+        UNICORN_STAT(table_lookups, 1);
+        return stage2.begin()[(size_t(stage1.begin()[key >> 8]) << 8) + (key & 0xff)];
+    }
+
     // General character property tables
 
     extern const TableView<char32_t, uint16_t> general_category_table;
+    extern const Irange<uint16_t const*> general_category_stage1_table;
+    extern const Irange<uint8_t const*> general_category_stage2_table;
     extern const TableView<char32_t, char32_t> default_ignorable_table;
     extern const TableView<char32_t, char32_t> soft_dotted_table;
     extern const TableView<char32_t, char32_t> white_space_table;
@@ -140,9 +156,13 @@ namespace RS::Unicorn::UnicornDetail {
 
     // Character name tables
 
-    extern const char* const main_names_data;
-    extern const size_t main_names_compressed;
-    extern const size_t main_names_expanded;
+    extern const size_t name_chunk_size;
+    extern const char* const name_words_data;
+    extern const Irange<uint32_t const*> name_word_offsets_table;
+    extern const char* const name_phrasebook_data;
+    extern const size_t name_phrasebook_size;
+    extern const Irange<NameChunk const*> name_chunks_table;
+    extern const Irange<uint16_t const*> name_index_table;
     extern const TableView<char32_t, char const*> corrected_names_table;
 
     // Decomposition tables
@@ -167,6 +187,14 @@ namespace RS::Unicorn::UnicornDetail {
 
     extern const TableView<char32_t, uint32_t> scripts_table;
     extern const TableView<char32_t, char const*> script_extensions_table;
+    extern const Irange<uint16_t const*> script_id_stage1_table;
+    extern const Irange<uint8_t const*> script_id_stage2_table;
+    extern const Irange<uint16_t const*> script_extension_stage1_table;
+    extern const Irange<uint8_t const*> script_extension_stage2_table;
+    extern const Irange<uint16_t const*> script_extension_offsets_table;
+    extern const Irange<uint8_t const*> script_extension_lists_table;
+    extern const Irange<char const* const*> script_names_table;
+    extern const TableView<uint32_t, uint8_t> script_codes_table;
 
     // Text segmentation property tables
 
@@ -180,6 +208,11 @@ namespace RS::Unicorn::UnicornDetail {
     extern const TableView<char32_t, East_Asian_Width> east_asian_width_table;
     extern const TableView<char32_t, Hangul_Syllable_Type> hangul_syllable_type_table;
 
+    // Bidi test tables
+
+    extern const Irange<const std::array<char const*, 4>*> bidi_test_table;
+    extern const Irange<const std::array<char const*, 5>*> bidi_character_test_table;
+
     // Normalization test tables
 
     extern const Irange<const std::array<char const*, 5>*> normalization_test_table;
@@ -4,7 +4,11 @@
 #include "rs-core/unit-test.hpp"
 #include <algorithm>
 #include <iterator>
+#include <random>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 using namespace RS;
 using namespace RS::Unicorn;
@@ -396,6 +400,62 @@ namespace {
 
     }
 
+    void check_view_iterators() {
+
+        // A view into the middle of a larger buffer, which must not be
+        // read beyond its ends
+
+        const U8string buf = "[" + c8 + "]";
+        std::string_view v8(buf.data() + 1, c8.size());
+        std::u16string_view v16 = c16;
+        Utf8ViewIterator i8;
+        Utf8ViewRange r8;
+        Utf16ViewRange r16;
+        std::u32string s32;
+        U8string s8;
+
+        TEST_EQUAL(i8.str(), "");
+        TEST(i8 == Utf8ViewIterator());
+        TRY(r8 = utf_range(v8));
+        TRY(i8 = r8.first);  TEST_EQUAL(*i8, 0x4d);      TEST_EQUAL(i8.str(), "\x4d");              TEST_EQUAL(i8.offset(), 0);
+        TRY(++i8);           TEST_EQUAL(*i8, 0x430);     TEST_EQUAL(i8.str(), "\xd0\xb0");          TEST_EQUAL(i8.offset(), 1);
+        TRY(++i8);           TEST_EQUAL(*i8, 0x4e8c);    TEST_EQUAL(i8.str(), "\xe4\xba\x8c");      TEST_EQUAL(i8.offset(), 3);
+        TRY(++i8);           TEST_EQUAL(*i8, 0x10302);   TEST_EQUAL(i8.str(), "\xf0\x90\x8c\x82");  TEST_EQUAL(i8.offset(), 6);
+        TRY(++i8);           TEST_EQUAL(*i8, 0x10fffd);  TEST_EQUAL(i8.str(), "\xf4\x8f\xbf\xbd");  TEST_EQUAL(i8.offset(), 10);
+        TRY(++i8);           TEST(i8 == r8.second);      TEST_EQUAL(i8.str(), "");                  TEST_EQUAL(i8.offset(), 14);
+        TRY(--i8);           TEST_EQUAL(*i8, 0x10fffd);  TEST_EQUAL(i8.str(), "\xf4\x8f\xbf\xbd");  TEST_EQUAL(i8.offset(), 10);
+        TRY(--i8);           TEST_EQUAL(*i8, 0x10302);   TEST_EQUAL(i8.str(), "\xf0\x90\x8c\x82");  TEST_EQUAL(i8.offset(), 6);
+        TRY(i8 = i8.offset_by(-6));  TEST_EQUAL(*i8, 0x4d);
+        TEST(i8 == r8.first);
+        TEST(i8.source().data() == buf.data() + 1);
+
+        TRY(std::copy(r8.begin(), r8.end(), overwrite(s32)));  TEST_EQUAL(s32, c32);
+        TRY(r16 = utf_range(v16));
+        TRY(std::copy(r16.begin(), r16.end(), overwrite(s32)));  TEST_EQUAL(s32, c32);
+        TRY(std::copy(utf_iterator(v8, 3), utf_iterator(v8, 10), overwrite(s32)));  TEST_EQUAL(s32, (std::u32string{0x4e8c,0x10302}));
+        TEST_EQUAL(u_view(utf_iterator(v8, 1), utf_iterator(v8, 6)), "\xd0\xb0\xe4\xba\x8c");
+        TEST_EQUAL(u_str(utf_range(v8)), c8);
+
+        TRY(recode(v8, s32));             TEST_EQUAL(s32, c32);
+        TRY(s8 = recode<char>(v16));      TEST_EQUAL(s8, c8);
+        TRY(s32 = recode<char32_t>(v16));  TEST_EQUAL(s32, c32);
+
+        TEST(valid_string(v8));
+        TEST(valid_string(v16));
+        TEST(! valid_string(std::string_view(x8)));
+        TEST(! valid_string(std::string_view(x8).substr(3, 5)));
+        TEST(valid_string(std::string_view(x8).substr(0, 5)));
+        TEST_EQUAL(valid_count(std::string_view(x8)), 5);
+        TEST_EQUAL(valid_count(v8), npos);
+        TRY(check_string(v8));
+        TEST_THROW(check_string(std::string_view(x8)), EncodingError);
+
+        std::string_view vx(x8);
+        TRY(std::copy(utf_begin(vx, Utf::replace), utf_end(vx, Utf::replace), overwrite(s32)));  TEST_EQUAL(s32, y32);
+        TEST_THROW(std::copy(utf_begin(vx, Utf::throws), utf_end(vx, Utf::throws), overwrite(s32)), EncodingError);
+
+    }
+
     void check_implicit_recoding() {
 
         U8string s8;
@@ -752,6 +812,107 @@ namespace {
 
     }
 
+    void check_parallel_conversion() {
+
+        using namespace UnicornDetail;
+
+        // Chunk boundaries must fall where a sequential decoder would start
+        // a new character, including in the middle of invalid sequences
+
+        const uint8_t units8[] = {0x41, 0x7f, 0x80, 0x9f, 0xa0, 0xbf, 0xc0, 0xc2, 0xdf, 0xe0, 0xe1, 0xed, 0xef, 0xf0, 0xf1, 0xf4, 0xf5, 0xff};
+        const char16_t units16[] = {0x41, 0xd7ff, 0xd800, 0xdbff, 0xdc00, 0xdfff, 0xe000};
+        std::mt19937 rng(42);
+        size_t bad8 = 0, bad16 = 0;
+
+        for (int i = 0; i < 1000; ++i) {
+            std::string s8;
+            std::u16string s16;
+            for (int j = 0; j < 20; ++j) {
+                s8 += char(units8[rng() % std::size(units8)]);
+                s16 += units16[rng() % std::size(units16)];
+            }
+            std::vector<bool> starts8(s8.size() + 1), starts16(s16.size() + 1);
+            char32_t u = 0;
+            for (size_t pos = 0; pos < s8.size(); pos += UtfEncoding<char>::decode(s8.data() + pos, s8.size() - pos, u))
+                starts8[pos] = true;
+            for (size_t pos = 0; pos < s16.size(); pos += UtfEncoding<char16_t>::decode(s16.data() + pos, s16.size() - pos, u))
+                starts16[pos] = true;
+            starts8.back() = starts16.back() = true;
+            for (size_t pos = 0; pos <= s8.size(); ++pos)
+                if (! starts8[utf_chunk_boundary(s8.data(), s8.size(), pos)])
+                    ++bad8;
+            for (size_t pos = 0; pos <= s16.size(); ++pos)
+                if (! starts16[utf_chunk_boundary(s16.data(), s16.size(), pos)])
+                    ++bad16;
+        }
+
+        TEST_EQUAL(bad8, 0);
+        TEST_EQUAL(bad16, 0);
+
+        // Strings big enough to be divided into several chunks (c8 is 14
+        // bytes long, so every 15th byte starts a line)
+
+        U8string big8, s8;
+        std::u16string big16, s16;
+        std::u32string big32, s32;
+
+        while (big8.size() < 2'000'000)
+            big8 += c8 + '\n';
+        TRY(big16 = to_utf16(big8));
+        TRY(big32 = to_utf32(big8));
+
+        TRY(parallel_recode(big8, s16, 0, 4));                   TEST(s16 == big16);
+        TRY(parallel_recode(big8, s32, Utf::throws, 4));         TEST(s32 == big32);
+        TRY(parallel_recode(big16, s8, 0, 4));                   TEST(s8 == big8);
+        TRY(parallel_recode(big32, s16, Utf::throws, 4));        TEST(s16 == big16);
+        TRY(s8 = parallel_recode<char>(big32, Utf::replace, 4)); TEST(s8 == big8);
+        TRY(s32 = parallel_recode<char32_t>(big16));             TEST(s32 == big32);
+        TRY(s16 = parallel_recode<char16_t>(c8, 0, 4));          TEST_EQUAL(s16, c16);
+
+        TEST_EQUAL(parallel_validate(big8, 4), npos);
+        TEST_EQUAL(parallel_validate(big16, 4), npos);
+        TEST_EQUAL(parallel_validate(big32, 4), npos);
+        TEST_EQUAL(parallel_validate(x8, 4), 5);
+        TEST_EQUAL(parallel_validate(std::string_view(x8)), 5);
+
+        // Errors in later chunks are reported relative to the whole string
+
+        std::string bad = big8;
+        bad[1'200'000] = '\xff';
+        bad[1'500'001] = 'x';
+        TEST_EQUAL(valid_count(bad), 1'200'000);
+        TEST_EQUAL(parallel_validate(bad, 4), 1'200'000);
+        TRY(s8 = parallel_recode<char>(bad, Utf::replace, 4));
+        TEST(s8 == sanitize(bad));
+        TRY(s32 = parallel_recode<char32_t>(bad, Utf::replace, 4));
+        TEST(s32 == to_utf32(bad, Utf::replace));
+        TEST_THROW_EQUAL(parallel_recode(bad, s16, Utf::throws, 4),
+            EncodingError, "Encoding error (UTF-8); offset 1200000; hex ff");
+        TEST_THROW_EQUAL(parallel_recode<char32_t>(bad, Utf::throws, 4),
+            EncodingError, "Encoding error (UTF-8); offset 1200000; hex ff");
+
+        std::u16string bad16x = big16;
+        bad16x[700'001] = 0xd800;
+        TEST_EQUAL(parallel_validate(bad16x, 4), valid_count(bad16x));
+        TRY(s16 = parallel_recode<char16_t>(bad16x, Utf::replace, 4));
+        TEST(s16 == sanitize(bad16x));
+        TEST_THROW_EQUAL(parallel_recode<char>(bad16x, Utf::throws, 4),
+            EncodingError, "Encoding error (UTF-16); offset " + dec(valid_count(bad16x)) + "; hex d800");
+
+        // Worker threads are reused between calls; callers on other threads
+        // while the pool is busy must still get the right answer
+
+        std::vector<std::u32string> results(4);
+        std::vector<std::thread> callers;
+        for (auto& r: results)
+            callers.emplace_back([&big8, &r] { r = parallel_recode<char32_t>(big8, 0, 4); });
+        for (auto& t: callers)
+            t.join();
+        for (auto& r: results)
+            TEST(r == big32);
+
+    }
+
 }
 
 TEST_MODULE(unicorn, utf) {
@@ -760,9 +921,11 @@ TEST_MODULE(unicorn, utf) {
     check_basic_utilities();
     check_decoding_iterators();
     check_decoding_ranges();
+    check_view_iterators();
     check_implicit_recoding();
     check_explicit_recoding();
     check_string_validation();
     check_error_handling();
+    check_parallel_conversion();
 
 }
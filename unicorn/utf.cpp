@@ -1,4 +1,9 @@
 #include "unicorn/utf.hpp"
+#include "rs-core/thread.hpp"
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
 
 using namespace std::literals;
 
@@ -7,6 +12,7 @@ namespace RS::Unicorn {
     namespace {
 
         constexpr auto not_unicode = char32_t(-1);
+        constexpr size_t min_parallel_chunk = 256 * 1024;
 
     }
 
@@ -170,4 +176,122 @@ namespace RS::Unicorn {
             return UnicornDetail::UtfEncoding<char16_t>::encode(src, dst);
     }
 
+    // Parallel UTF conversion functions
+
+    namespace UnicornDetail {
+
+        size_t parallel_chunk_count(size_t bytes, size_t threads) noexcept {
+            if (threads == 0)
+                threads = Thread::cpu_threads();
+            return clamp(bytes / min_parallel_chunk, 1, std::max(threads, size_t(1)));
+        }
+
+        // Worker threads are kept between calls, so that the parallel
+        // functions do not pay for thread creation on every call. The pool
+        // grows to the largest number of workers requested so far, up to
+        // one per hardware thread (counting the calling thread, which also
+        // takes tasks); any further tasks wait for a free worker. One job
+        // runs at a time; a call made while the pool is busy falls back to
+        // temporary threads.
+
+        class WorkerPool {
+        public:
+            using job_type = std::function<void(size_t)>;
+            ~WorkerPool() noexcept;
+            bool try_run(size_t n, const job_type& f, std::vector<std::exception_ptr>& errors);
+            static WorkerPool& instance() { static WorkerPool pool; return pool; }
+        private:
+            std::mutex busy_mutex;
+            std::mutex mutex;
+            std::condition_variable work_cv;
+            std::condition_variable done_cv;
+            std::vector<std::unique_ptr<Thread>> workers;
+            const job_type* job = nullptr;
+            std::vector<std::exception_ptr>* job_errors = nullptr;
+            size_t next = 0, total = 0, pending = 0;
+            bool stop = false;
+            void run_task(std::unique_lock<std::mutex>& lock);
+            void work_loop();
+        };
+
+        WorkerPool::~WorkerPool() noexcept {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stop = true;
+            }
+            work_cv.notify_all();
+            for (auto& w: workers)
+                w->wait();
+        }
+
+        bool WorkerPool::try_run(size_t n, const job_type& f, std::vector<std::exception_ptr>& errors) {
+            std::unique_lock<std::mutex> busy(busy_mutex, std::try_to_lock);
+            if (! busy)
+                return false;
+            std::unique_lock<std::mutex> lock(mutex);
+            size_t max_workers = Thread::cpu_threads();
+            while (workers.size() + 1 < std::min(n, max_workers))
+                workers.push_back(std::make_unique<Thread>([this] { work_loop(); }));
+            job = &f;
+            job_errors = &errors;
+            next = 0;
+            total = pending = n;
+            work_cv.notify_all();
+            while (next < total)
+                run_task(lock);
+            done_cv.wait(lock, [this] { return pending == 0; });
+            job = nullptr;
+            job_errors = nullptr;
+            return true;
+        }
+
+        // Called with the lock held, and returns with it held
+
+        void WorkerPool::run_task(std::unique_lock<std::mutex>& lock) {
+            size_t i = next++;
+            auto& f = *job;
+            auto& errors = *job_errors;
+            lock.unlock();
+            try { f(i); }
+            catch (...) { errors[i] = std::current_exception(); }
+            lock.lock();
+            if (--pending == 0)
+                done_cv.notify_all();
+        }
+
+        void WorkerPool::work_loop() {
+            std::unique_lock<std::mutex> lock(mutex);
+            for (;;) {
+                work_cv.wait(lock, [this] { return stop || (job && next < total); });
+                if (stop)
+                    return;
+                run_task(lock);
+            }
+        }
+
+        void parallel_run(size_t n, const std::function<void(size_t)>& f) {
+            if (n == 1) {
+                f(0);
+                return;
+            }
+            std::vector<std::exception_ptr> errors(n);
+            if (! WorkerPool::instance().try_run(n, f, errors)) {
+                std::vector<std::unique_ptr<Thread>> workers;
+                for (size_t i = 0; i < n; ++i) {
+                    auto ep = &errors[i];
+                    workers.push_back(std::make_unique<Thread>([&f, ep, i] {
+                        try { f(i); }
+                        catch (...) { *ep = std::current_exception(); }
+                    }));
+                }
+                for (auto& w: workers)
+                    w->wait();
+            }
+            for (auto& e: errors)
+                if (e)
+                    std::rethrow_exception(e);
+        }
+
+    }
+
 }
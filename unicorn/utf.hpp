@@ -4,8 +4,11 @@
 #include "unicorn/character.hpp"
 #include <algorithm>
 #include <cstring>
+#include <functional>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 namespace RS::Unicorn {
 
@@ -178,6 +181,52 @@ namespace RS::Unicorn {
 
     // UTF decoding iterator
 
+    namespace UnicornDetail {
+
+        // Decoding steps shared by the UTF iterators. These decode the
+        // character at src+ofs, or the one immediately before it (stepping
+        // ofs back), and update the iterator state.
+
+        template <typename C>
+        void utf_decode_next(const C* src, size_t size, size_t ofs, uint32_t fset, size_t& units, char32_t& u, bool& ok) {
+            units = 0;
+            u = 0;
+            ok = false;
+            if (ofs == size) {
+                // do nothing
+            } else if (fset & Utf::ignore) {
+                units = UtfEncoding<C>::decode_fast(src + ofs, size - ofs, u);
+                ok = true;
+            } else {
+                units = UtfEncoding<C>::decode(src + ofs, size - ofs, u);
+                ok = char_is_unicode(u);
+                if (! ok) {
+                    u = replacement_char;
+                    if (fset & Utf::throws)
+                        throw EncodingError(UtfEncoding<C>::name(), ofs, src + ofs, units);
+                }
+            }
+        }
+
+        template <typename C>
+        void utf_decode_prev(const C* src, size_t& ofs, uint32_t fset, size_t& units, char32_t& u, bool& ok) {
+            units = 0;
+            u = 0;
+            ok = false;
+            if (ofs == 0)
+                return;
+            units = UtfEncoding<C>::decode_prev(src, ofs, u);
+            ofs -= units;
+            ok = (fset & Utf::ignore) || char_is_unicode(u);
+            if (! ok) {
+                u = replacement_char;
+                if (fset & Utf::throws)
+                    throw EncodingError(UtfEncoding<C>::name(), ofs, src + ofs, units);
+            }
+        }
+
+    }
+
     template <typename C>
     class UtfIterator:
     public BidirectionalIterator<UtfIterator<C>, const char32_t> {
@@ -210,44 +259,14 @@ namespace RS::Unicorn {
 
     template <typename C>
     UtfIterator<C>& UtfIterator<C>::operator++() {
-        using namespace UnicornDetail;
         ofs = std::min(ofs + units, sptr->size());
-        units = 0;
-        u = 0;
-        ok = false;
-        if (ofs == sptr->size()) {
-            // do nothing
-        } else if (fset & Utf::ignore) {
-            units = UtfEncoding<C>::decode_fast(sptr->data() + ofs, sptr->size() - ofs, u);
-            ok = true;
-        } else {
-            units = UtfEncoding<C>::decode(sptr->data() + ofs, sptr->size() - ofs, u);
-            ok = char_is_unicode(u);
-            if (! ok) {
-                u = replacement_char;
-                if (fset & Utf::throws)
-                    throw EncodingError(UtfEncoding<C>::name(), ofs, sptr->data() + ofs, units);
-            }
-        }
+        UnicornDetail::utf_decode_next(sptr->data(), sptr->size(), ofs, fset, units, u, ok);
         return *this;
     }
 
     template <typename C>
     UtfIterator<C>& UtfIterator<C>::operator--() {
-        using namespace UnicornDetail;
-        units = 0;
-        u = 0;
-        ok = false;
-        if (ofs == 0)
-            return *this;
-        units = UtfEncoding<C>::decode_prev(sptr->data(), ofs, u);
-        ofs -= units;
-        ok = (fset & Utf::ignore) || char_is_unicode(u);
-        if (! ok) {
-            u = replacement_char;
-            if (fset & Utf::throws)
-                throw EncodingError(UtfEncoding<C>::name(), ofs, sptr->data() + ofs, units);
-        }
+        UnicornDetail::utf_decode_prev(sptr->data(), ofs, fset, units, u, ok);
         return *this;
     }
 
@@ -309,6 +328,111 @@ namespace RS::Unicorn {
         return u_str(range.begin(), range.end());
     }
 
+    // UTF decoding iterator over a string view
+
+    template <typename C>
+    class UtfViewIterator:
+    public BidirectionalIterator<UtfViewIterator<C>, const char32_t> {
+    public:
+        using code_unit = C;
+        using string_type = std::basic_string<C>;
+        using view_type = std::basic_string_view<C>;
+        UtfViewIterator() = default;
+        explicit UtfViewIterator(view_type src): ptr(src.data()), len(src.size()) { ++*this; }
+        UtfViewIterator(view_type src, size_t offset, uint32_t flags = 0):
+            ptr(src.data()), len(src.size()), ofs(std::min(offset, len)), fset(flags) { if (ibits(fset & Utf::mask) == 0) fset |= Utf::ignore; ++*this; }
+        const char32_t& operator*() const noexcept { return u; }
+        UtfViewIterator& operator++();
+        UtfViewIterator& operator--();
+        view_type source() const noexcept { return {ptr, len}; }
+        size_t offset() const noexcept { return ofs; }
+        size_t count() const noexcept { return units; }
+        UtfViewIterator offset_by(ptrdiff_t n) const noexcept;
+        Irange<const C*> range() const noexcept { return {ptr + ofs, ptr + ofs + units}; }
+        string_type str() const { return string_type(view_type(ptr + ofs, units)); }
+        bool valid() const noexcept { return ok; }
+        friend bool operator==(const UtfViewIterator& lhs, const UtfViewIterator& rhs) noexcept { return lhs.ofs == rhs.ofs; }
+    private:
+        const C* ptr = nullptr;       // Source data
+        size_t len = 0;               // Length of source
+        size_t ofs = 0;               // Offset of current character in source
+        size_t units = 0;             // Code units in current character
+        char32_t u = 0;               // Current decoded character
+        uint32_t fset = Utf::ignore;  // Error handling flag
+        bool ok = false;              // Current character is valid
+    };
+
+    template <typename C>
+    UtfViewIterator<C>& UtfViewIterator<C>::operator++() {
+        ofs = std::min(ofs + units, len);
+        UnicornDetail::utf_decode_next(ptr, len, ofs, fset, units, u, ok);
+        return *this;
+    }
+
+    template <typename C>
+    UtfViewIterator<C>& UtfViewIterator<C>::operator--() {
+        UnicornDetail::utf_decode_prev(ptr, ofs, fset, units, u, ok);
+        return *this;
+    }
+
+    template <typename C>
+    UtfViewIterator<C> UtfViewIterator<C>::offset_by(ptrdiff_t n) const noexcept {
+        auto i = *this;
+        i.ofs = size_t(clamp(ptrdiff_t(ofs) + n, 0, len));
+        i.units = 0;
+        ++i;
+        return i;
+    }
+
+    using Utf8ViewIterator = UtfViewIterator<char>;
+    using Utf8ViewRange = Irange<Utf8ViewIterator>;
+    using Utf16ViewIterator = UtfViewIterator<char16_t>;
+    using Utf16ViewRange = Irange<Utf16ViewIterator>;
+    using Utf32ViewIterator = UtfViewIterator<char32_t>;
+    using Utf32ViewRange = Irange<Utf32ViewIterator>;
+    using WcharViewIterator = UtfViewIterator<wchar_t>;
+    using WcharViewRange = Irange<WcharViewIterator>;
+
+    template <typename C>
+    UtfViewIterator<C> utf_begin(std::basic_string_view<C> src, uint32_t flags = 0) {
+        return {src, 0, flags};
+    }
+
+    template <typename C>
+    UtfViewIterator<C> utf_end(std::basic_string_view<C> src, uint32_t flags = 0) {
+        return {src, src.size(), flags};
+    }
+
+    template <typename C>
+    UtfViewIterator<C> utf_iterator(std::basic_string_view<C> src, size_t offset, uint32_t flags = 0) {
+        return {src, offset, flags};
+    }
+
+    template <typename C>
+    Irange<UtfViewIterator<C>> utf_range(std::basic_string_view<C> src, uint32_t flags = 0) {
+        return {utf_begin(src, flags), utf_end(src, flags)};
+    }
+
+    template <typename C>
+    std::basic_string_view<C> u_view(const UtfViewIterator<C>& i, const UtfViewIterator<C>& j) {
+        return i.source().substr(i.offset(), j.offset() - i.offset());
+    }
+
+    template <typename C>
+    std::basic_string_view<C> u_view(const Irange<UtfViewIterator<C>>& range) {
+        return u_view(range.begin(), range.end());
+    }
+
+    template <typename C>
+    std::basic_string<C> u_str(const UtfViewIterator<C>& i, const UtfViewIterator<C>& j) {
+        return std::basic_string<C>(u_view(i, j));
+    }
+
+    template <typename C>
+    std::basic_string<C> u_str(const Irange<UtfViewIterator<C>>& range) {
+        return u_str(range.begin(), range.end());
+    }
+
     // UTF encoding iterator
 
     template <typename C>
@@ -364,6 +488,20 @@ namespace RS::Unicorn {
         return {dst, flags};
     }
 
+    namespace UnicornDetail {
+
+        // Append UTF-8 to a string with any allocator, with the same
+        // behaviour as a UtfWriter with the default flags
+
+        template <typename S>
+        void append_utf8(S& dst, const char32_t* src, size_t n) {
+            char buf[UtfEncoding<char>::max_units];
+            for (size_t i = 0; i < n; ++i)
+                dst.append(buf, UtfEncoding<char>::encode(src[i], buf));
+        }
+
+    }
+
     // UTF conversion functions
 
     namespace UnicornDetail {
@@ -515,10 +653,22 @@ namespace RS::Unicorn {
 
     };
 
+    namespace UnicornDetail {
+
+        template <typename C1, typename C2>
+        void recode_helper(const C1* src, size_t n, std::basic_string<C2>& dst, uint32_t flags) {
+            UNICORN_STAT(recode_calls, 1);
+            UNICORN_STAT(recode_bytes, n == npos ? 0 : n * sizeof(C1));
+            UNICORN_STAT_BUFFER(dst);
+            Recode<C1, C2>()(src, n, dst, flags);
+        }
+
+    }
+
     template <typename C1, typename C2>
     void recode(const std::basic_string<C1>& src, std::basic_string<C2>& dst, uint32_t flags = 0) {
         std::basic_string<C2> result;
-        UnicornDetail::Recode<C1, C2>()(src.data(), src.size(), result, flags);
+        UnicornDetail::recode_helper(src.data(), src.size(), result, flags);
         dst = std::move(result);
     }
 
@@ -526,21 +676,21 @@ namespace RS::Unicorn {
     void recode(const std::basic_string<C1>& src, size_t offset, std::basic_string<C2>& dst, uint32_t flags = 0) {
         std::basic_string<C2> result;
         if (offset < src.size())
-            UnicornDetail::Recode<C1, C2>()(src.data() + offset, src.size() - offset, result, flags);
+            UnicornDetail::recode_helper(src.data() + offset, src.size() - offset, result, flags);
         dst = std::move(result);
     }
 
     template <typename C1, typename C2>
     void recode(const C1* src, size_t count, std::basic_string<C2>& dst, uint32_t flags = 0) {
         std::basic_string<C2> result;
-        UnicornDetail::Recode<C1, C2>()(src, count, result, flags);
+        UnicornDetail::recode_helper(src, count, result, flags);
         dst = std::move(result);
     }
 
     template <typename C2, typename C1>
     std::basic_string<C2> recode(const std::basic_string<C1>& src, uint32_t flags = 0) {
         std::basic_string<C2> result;
-        UnicornDetail::Recode<C1, C2>()(src.data(), src.size(), result, flags);
+        UnicornDetail::recode_helper(src.data(), src.size(), result, flags);
         return result;
     }
 
@@ -548,7 +698,21 @@ namespace RS::Unicorn {
     std::basic_string<C2> recode(const std::basic_string<C1>& src, size_t offset, uint32_t flags) {
         std::basic_string<C2> result;
         if (offset < src.size())
-            UnicornDetail::Recode<C1, C2>()(src.data() + offset, src.size() - offset, result, flags);
+            UnicornDetail::recode_helper(src.data() + offset, src.size() - offset, result, flags);
+        return result;
+    }
+
+    template <typename C1, typename C2>
+    void recode(std::basic_string_view<C1> src, std::basic_string<C2>& dst, uint32_t flags = 0) {
+        std::basic_string<C2> result;
+        UnicornDetail::recode_helper(src.data(), src.size(), result, flags);
+        dst = std::move(result);
+    }
+
+    template <typename C2, typename C1>
+    std::basic_string<C2> recode(std::basic_string_view<C1> src, uint32_t flags = 0) {
+        std::basic_string<C2> result;
+        UnicornDetail::recode_helper(src.data(), src.size(), result, flags);
         return result;
     }
 
@@ -580,7 +744,7 @@ namespace RS::Unicorn {
     // UTF validation functions
 
     template <typename C>
-    void check_string(const std::basic_string<C>& str) {
+    void check_string(std::basic_string_view<C> str) {
         using namespace UnicornDetail;
         auto data = str.data();
         size_t pos = 0, size = str.size();
@@ -594,7 +758,12 @@ namespace RS::Unicorn {
     }
 
     template <typename C>
-    bool valid_string(const std::basic_string<C>& str) noexcept {
+    void check_string(const std::basic_string<C>& str) {
+        check_string(std::basic_string_view<C>(str));
+    }
+
+    template <typename C>
+    bool valid_string(std::basic_string_view<C> str) noexcept {
         using namespace UnicornDetail;
         auto data = str.data();
         size_t pos = 0, size = str.size();
@@ -609,6 +778,11 @@ namespace RS::Unicorn {
         return true;
     }
 
+    template <typename C>
+    bool valid_string(const std::basic_string<C>& str) noexcept {
+        return valid_string(std::basic_string_view<C>(str));
+    }
+
     template <typename C>
     std::basic_string<C> sanitize(const std::basic_string<C>& str) {
         std::basic_string<C> result;
@@ -624,7 +798,7 @@ namespace RS::Unicorn {
     }
 
     template <typename C>
-    size_t valid_count(const std::basic_string<C>& str) noexcept {
+    size_t valid_count(std::basic_string_view<C> str) noexcept {
         using namespace UnicornDetail;
         auto data = str.data();
         size_t pos = 0, size = str.size();
@@ -638,4 +812,125 @@ namespace RS::Unicorn {
         return npos;
     }
 
+    template <typename C>
+    size_t valid_count(const std::basic_string<C>& str) noexcept {
+        return valid_count(std::basic_string_view<C>(str));
+    }
+
+    // Parallel UTF conversion functions
+
+    namespace UnicornDetail {
+
+        // The input is divided into chunks that end at positions where a
+        // sequential decoder would start a new character, so each chunk
+        // decodes exactly as it would as part of the whole string. In UTF-8
+        // that is any byte that is not a continuation byte, or one that
+        // follows three continuation bytes (no encoded character or error
+        // sequence is longer than that); in UTF-16 it is anywhere except
+        // between the two halves of a surrogate pair.
+
+        template <typename C>
+        size_t utf_chunk_boundary(const C* src, size_t n, size_t pos) noexcept {
+            if (sizeof(C) == 1) {
+                for (size_t i = 0; i < 3 && pos < n && is_nonstart_unit(src[pos]); ++i)
+                    ++pos;
+            } else if (sizeof(C) == 2) {
+                if (pos > 0 && pos < n && char_is_high_surrogate(src[pos - 1]) && char_is_low_surrogate(src[pos]))
+                    ++pos;
+            }
+            return pos;
+        }
+
+        size_t parallel_chunk_count(size_t bytes, size_t threads) noexcept;
+        void parallel_run(size_t n, const std::function<void(size_t)>& f);
+
+        template <typename C>
+        std::vector<size_t> utf_chunks(const C* src, size_t n, size_t threads) {
+            size_t n_chunks = parallel_chunk_count(n * sizeof(C), threads);
+            std::vector<size_t> cuts(n_chunks + 1, n);
+            cuts[0] = 0;
+            for (size_t i = 1; i < n_chunks; ++i)
+                cuts[i] = std::max(cuts[i - 1], utf_chunk_boundary(src, n, i * (n / n_chunks)));
+            return cuts;
+        }
+
+        template <typename C1, typename C2>
+        void parallel_recode_helper(const C1* src, size_t n, std::basic_string<C2>& dst, uint32_t flags, size_t threads) {
+            auto cuts = utf_chunks(src, n, threads);
+            size_t n_chunks = cuts.size() - 1;
+            if (n_chunks == 1) {
+                recode_helper(src, n, dst, flags);
+                return;
+            }
+            std::vector<std::basic_string<C2>> parts(n_chunks);
+            parallel_run(n_chunks, [&] (size_t i) {
+                try {
+                    recode_helper(src + cuts[i], cuts[i + 1] - cuts[i], parts[i], flags);
+                }
+                catch (const EncodingError& ex) {
+                    // Report the error relative to the whole string
+                    size_t pos = cuts[i] + ex.offset();
+                    char32_t u = 0;
+                    auto rc = UtfEncoding<C1>::decode(src + pos, cuts[i + 1] - pos, u);
+                    throw EncodingError(UtfEncoding<C1>::name(), pos, src + pos, rc);
+                }
+            });
+            std::vector<size_t> offsets(n_chunks + 1, dst.size());
+            for (size_t i = 0; i < n_chunks; ++i)
+                offsets[i + 1] = offsets[i] + parts[i].size();
+            dst.resize(offsets.back());
+            parallel_run(n_chunks, [&] (size_t i) {
+                if (! parts[i].empty())
+                    memcpy(&dst[offsets[i]], parts[i].data(), parts[i].size() * sizeof(C2));
+                parts[i] = {};
+            });
+        }
+
+    }
+
+    template <typename C1, typename C2>
+    void parallel_recode(std::basic_string_view<C1> src, std::basic_string<C2>& dst, uint32_t flags = 0, size_t threads = 0) {
+        std::basic_string<C2> result;
+        UnicornDetail::parallel_recode_helper(src.data(), src.size(), result, flags, threads);
+        dst = std::move(result);
+    }
+
+    template <typename C1, typename C2>
+    void parallel_recode(const std::basic_string<C1>& src, std::basic_string<C2>& dst, uint32_t flags = 0, size_t threads = 0) {
+        parallel_recode(std::basic_string_view<C1>(src), dst, flags, threads);
+    }
+
+    template <typename C2, typename C1>
+    std::basic_string<C2> parallel_recode(std::basic_string_view<C1> src, uint32_t flags = 0, size_t threads = 0) {
+        std::basic_string<C2> result;
+        UnicornDetail::parallel_recode_helper(src.data(), src.size(), result, flags, threads);
+        return result;
+    }
+
+    template <typename C2, typename C1>
+    std::basic_string<C2> parallel_recode(const std::basic_string<C1>& src, uint32_t flags = 0, size_t threads = 0) {
+        return parallel_recode<C2>(std::basic_string_view<C1>(src), flags, threads);
+    }
+
+    template <typename C>
+    size_t parallel_validate(std::basic_string_view<C> str, size_t threads = 0) {
+        auto cuts = UnicornDetail::utf_chunks(str.data(), str.size(), threads);
+        size_t n_chunks = cuts.size() - 1;
+        if (n_chunks == 1)
+            return valid_count(str);
+        std::vector<size_t> found(n_chunks, npos);
+        UnicornDetail::parallel_run(n_chunks, [&] (size_t i) {
+            found[i] = valid_count(str.substr(cuts[i], cuts[i + 1] - cuts[i]));
+        });
+        for (size_t i = 0; i < n_chunks; ++i)
+            if (found[i] != npos)
+                return cuts[i] + found[i];
+        return npos;
+    }
+
+    template <typename C>
+    size_t parallel_validate(const std::basic_string<C>& str, size_t threads = 0) {
+        return parallel_validate(std::basic_string_view<C>(str), threads);
+    }
+
 }